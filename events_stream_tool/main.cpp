@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/events_stream.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace OCLRT;
+
+int main(int argc, const char *argv[]) {
+    if (argc != 3 || (strcmp(argv[2], "dot") != 0 && strcmp(argv[2], "critical-path") != 0 && strcmp(argv[2], "stalls") != 0)) {
+        std::cerr << "Usage: events_stream_tool <EventsTrackerStreamFile> dot|critical-path|stalls\n"
+                     "  dot            - prints dependency graph of events in DOT format\n"
+                     "  critical-path  - prints chain of events which completed last, with wait, queued and executing times in ns\n"
+                     "  stalls         - prints time each command lost to dependencies, submission, CSR batching, GPU queue,\n"
+                     "                   execution and completion notify in ns, followed by totals over critical path\n";
+        return 1;
+    }
+
+    std::ifstream streamFile(argv[1], std::ios::binary);
+    std::vector<char> stream((std::istreambuf_iterator<char>(streamFile)), std::istreambuf_iterator<char>());
+    std::vector<EventsStream::RecordData> records;
+    if (!EventsStream::readRecords(stream.data(), stream.size(), records)) {
+        std::cerr << "Error: " << argv[1] << " is not a valid events stream\n";
+        return 1;
+    }
+
+    EventsStreamGraph graph;
+    graph.build(records);
+    if (strcmp(argv[2], "dot") == 0) {
+        graph.dumpDot(std::cout);
+    } else if (strcmp(argv[2], "critical-path") == 0) {
+        graph.dumpCriticalPath(std::cout);
+    } else {
+        graph.dumpStalls(std::cout);
+    }
+    return 0;
+}
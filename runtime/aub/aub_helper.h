@@ -27,6 +27,23 @@ class AubHelper : public NonCopyableOrMovableClass {
             return false;
         }
     }
+    static bool isGpuWritableAllocationType(const GraphicsAllocation::AllocationType &type) {
+        switch (type) {
+        case GraphicsAllocation::AllocationType::COMMAND_BUFFER:
+        case GraphicsAllocation::AllocationType::LINEAR_STREAM:
+        case GraphicsAllocation::AllocationType::CONSTANT_SURFACE:
+        case GraphicsAllocation::AllocationType::FILL_PATTERN:
+        case GraphicsAllocation::AllocationType::KERNEL_ISA:
+        case GraphicsAllocation::AllocationType::INSTRUCTION_HEAP:
+        case GraphicsAllocation::AllocationType::INDIRECT_OBJECT_HEAP:
+        case GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP:
+        case GraphicsAllocation::AllocationType::DYNAMIC_STATE_HEAP:
+        case GraphicsAllocation::AllocationType::INTERNAL_HEAP:
+            return false;
+        default:
+            return true;
+        }
+    }
     static int getMemTrace(uint64_t pdEntryBits);
     static uint64_t getPTEntryBits(uint64_t pdEntryBits);
     static void checkPTEAddress(uint64_t address);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,9 @@
 #include <cstdio>
 #include <cstdint>
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #ifndef BIT
 #define BIT(x) (((uint64_t)1) << (x))
@@ -19,6 +21,7 @@
 
 namespace OCLRT {
 class AubHelper;
+class AsyncFileWriter;
 }
 
 namespace AubMemDump {
@@ -121,6 +124,8 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    AubFileStream();
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -140,9 +145,30 @@ struct AubFileStream : public AubStream {
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
 
+    enum class PageDumpState : uint32_t {
+        NotDumped,
+        EntryDumped,
+        EntryAndContentDumped
+    };
+    struct DumpedPage {
+        uint64_t physAddress;
+        uint64_t entryBits;
+        size_t size;
+        uint64_t contentHash;
+    };
+    // Used with AUBDumpIncrementalResidency, records write of page region to this file and returns what was already there
+    PageDumpState trackPageWrite(uint64_t gpuAddress, uint64_t physAddress, uint64_t entryBits, const void *memory, size_t size);
+    void invalidateDumpedPages(uint64_t gpuAddress, size_t size);
+    // keeps entries of pages, so only memory is written again on their next dump
+    void invalidateDumpedContent(uint64_t gpuAddress, size_t size);
+
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    // set with AUBDumpAsyncWriteBufferSize, declared after fileHandle so pending writes reach file before it is closed
+    std::unique_ptr<OCLRT::AsyncFileWriter> asyncWriter;
+    // keyed by 4K aligned gpu address, page tables are shared by all contexts writing to file
+    std::unordered_map<uint64_t, DumpedPage> dumpedPages;
 };
 
 template <int addressingBits>
@@ -438,6 +438,48 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoB
     Kernel *kernRightLeftover;
 };
 
+template <typename HWFamily>
+class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferScatter> : public BuiltinDispatchInfoBuilder {
+  public:
+    BuiltInOp(BuiltIns &kernelsLib, Context &context, Device &device)
+        : BuiltinDispatchInfoBuilder(kernelsLib), kernCopyScatter(nullptr), kernFillScatter(nullptr) {
+        populate(context, device,
+                 EBuiltInOps::CopyBufferScatter,
+                 "",
+                 "CopyBufferToBufferScatter", kernCopyScatter,
+                 "FillBufferScatter", kernFillScatter);
+    }
+
+    bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
+        DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::NoSplit> kernelNoSplit1DBuilder;
+
+        DEBUG_BREAK_IF((operationParams.dstMemObj == nullptr) || (operationParams.transferDescriptorsAlloc == nullptr));
+        auto descriptorsAlloc = operationParams.transferDescriptorsAlloc;
+        uint32_t argIndex = 0;
+
+        // Set-up ISA, fills have no source buffer and read patterns stored after descriptors
+        if (operationParams.srcMemObj) {
+            kernelNoSplit1DBuilder.setKernel(kernCopyScatter);
+            kernelNoSplit1DBuilder.setArg(argIndex++, operationParams.srcMemObj);
+        } else {
+            kernelNoSplit1DBuilder.setKernel(kernFillScatter);
+        }
+        kernelNoSplit1DBuilder.setArg(argIndex++, operationParams.dstMemObj);
+        kernelNoSplit1DBuilder.setArgSvm(argIndex++, descriptorsAlloc->getUnderlyingBufferSize(), descriptorsAlloc->getUnderlyingBuffer(), descriptorsAlloc, CL_MEM_READ_ONLY);
+        kernelNoSplit1DBuilder.setArg(argIndex++, operationParams.transferDescriptorsCount);
+
+        // Set-up work sizes, one work item per transferred byte
+        kernelNoSplit1DBuilder.setDispatchGeometry(Vec3<size_t>{operationParams.size.x, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
+        kernelNoSplit1DBuilder.bake(multiDispatchInfo);
+
+        return true;
+    }
+
+  protected:
+    Kernel *kernCopyScatter;
+    Kernel *kernFillScatter;
+};
+
 template <typename HWFamily>
 class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToImage3d> : public BuiltinDispatchInfoBuilder {
   public:
@@ -750,6 +792,9 @@ BuiltinDispatchInfoBuilder &BuiltIns::getBuiltinDispatchInfoBuilder(EBuiltInOps
     case EBuiltInOps::FillBuffer:
         std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::FillBuffer>>(*this, context, device); });
         break;
+    case EBuiltInOps::CopyBufferScatter:
+        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferScatter>>(*this, context, device); });
+        break;
     case EBuiltInOps::CopyBufferToImage3d:
         std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToImage3d>>(*this, context, device); });
         break;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,7 @@ enum class EBuiltInOps : uint32_t {
     FillImage1d,
     FillImage2d,
     FillImage3d,
+    CopyBufferScatter,
     VmeBlockMotionEstimateIntel,
     VmeBlockAdvancedMotionEstimateCheckIntel,
     VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel,
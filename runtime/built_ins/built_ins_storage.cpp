@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,8 @@ const char *getBuiltinAsString(EBuiltInOps builtin) {
         return "fill_image2d.igdrcl_built_in";
     case EBuiltInOps::FillImage3d:
         return "fill_image3d.igdrcl_built_in";
+    case EBuiltInOps::CopyBufferScatter:
+        return "copy_buffer_scatter.igdrcl_built_in";
     case EBuiltInOps::VmeBlockMotionEstimateIntel:
         return "vme_block_motion_estimate_intel.igdrcl_built_in";
     case EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel:
@@ -1,5 +1,5 @@
 #
-# Copyright (C) 2018 Intel Corporation
+# Copyright (C) 2018-2019 Intel Corporation
 #
 # SPDX-License-Identifier: MIT
 #
@@ -12,6 +12,7 @@ add_subdirectory(registry)
 set(GENERATED_BUILTINS
   "aux_translation"
   "copy_buffer_rect"
+  "copy_buffer_scatter"
   "copy_buffer_to_buffer"
   "copy_buffer_to_image3d"
   "copy_image3d_to_buffer"
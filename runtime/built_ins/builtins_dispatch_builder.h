@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,8 @@ class BuiltinDispatchInfoBuilder {
         MemObj *dstMemObj = nullptr;
         GraphicsAllocation *srcSvmAlloc = nullptr;
         GraphicsAllocation *dstSvmAlloc = nullptr;
+        GraphicsAllocation *transferDescriptorsAlloc = nullptr;
+        uint32_t transferDescriptorsCount = 0;
         const MemObjsForAuxTranslation *memObjsForAuxTranslation = nullptr;
         AuxTranslationDirection auxTranslationDirection = AuxTranslationDirection::None;
         Vec3<size_t> srcOffset = {0, 0, 0};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,15 @@ static RegisterEmbeddedResource registerCopyBufferRectSrc(
 #include "runtime/built_ins/kernels/copy_buffer_rect.igdrcl_built_in"
         ));
 
+static RegisterEmbeddedResource registerCopyBufferScatterSrc(
+    createBuiltinResourceName(
+        EBuiltInOps::CopyBufferScatter,
+        BuiltinCode::getExtension(BuiltinCode::ECodeType::Source))
+        .c_str(),
+    std::string(
+#include "runtime/built_ins/kernels/copy_buffer_scatter.igdrcl_built_in"
+        ));
+
 static RegisterEmbeddedResource registerFillBufferSrc(
     createBuiltinResourceName(
         EBuiltInOps::FillBuffer,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/event/user_event.h"
 #include "runtime/event/event_builder.h"
+#include "runtime/gmm_helper/gmm.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/array_count.h"
@@ -26,6 +27,7 @@
 #include "runtime/mem_obj/image.h"
 #include "runtime/helpers/surface_formats.h"
 #include "runtime/memory_manager/internal_allocation_storage.h"
+#include "runtime/os_interface/page_write_tracker.h"
 #include "runtime/helpers/string.h"
 #include "CL/cl_ext.h"
 #include "runtime/utilities/api_intercept.h"
@@ -74,6 +76,8 @@ CommandQueue::CommandQueue(Context *context, Device *deviceId, const cl_queue_pr
 }
 
 CommandQueue::~CommandQueue() {
+    recordedCommandList.reset();
+
     if (virtualEvent) {
         UNRECOVERABLE_IF(this->virtualEvent->getCommandQueue() != this && this->virtualEvent->getCommandQueue() != nullptr);
         virtualEvent->setCurrentCmdQVirtualEvent(false);
@@ -125,6 +129,8 @@ bool CommandQueue::isCompleted(uint32_t taskCount) const {
 
 void CommandQueue::waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) {
     WAIT_ENTER()
+    TRACE_SCOPE(Wait, __FUNCTION__, taskCountToWait);
+    METRICS_SCOPE(MetricHistogram::WaitTime);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Waiting for taskCount:", taskCountToWait);
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "Current taskCount:", getHwTag());
@@ -338,7 +344,7 @@ bool CommandQueue::sendPerfCountersConfig() {
     return getPerfCounters()->sendPmRegsCfgCommands(perfConfigurationData, &perfCountersRegsCfgHandle, &perfCountersRegsCfgPending);
 }
 
-cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest) {
+cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest, bool blocking) {
     cl_int retVal = CL_SUCCESS;
 
     MapInfo unmapInfo;
@@ -347,7 +353,10 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
     }
 
     if (!unmapInfo.readOnly) {
-        if (memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
+        if (memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER && unmapInfo.writeTracker) {
+            auto buffer = castToObject<Buffer>(memObj);
+            retVal = enqueueWriteTrackedRangesForUnmap(buffer, unmapInfo, eventsRequest, blocking);
+        } else if (memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
             auto buffer = castToObject<Buffer>(memObj);
             retVal = enqueueWriteBuffer(buffer, CL_TRUE, unmapInfo.offset[0], unmapInfo.size[0], mappedPtr,
                                         eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
@@ -384,6 +393,31 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
     return retVal;
 }
 
+cl_int CommandQueue::enqueueWriteTrackedRangesForUnmap(Buffer *buffer, MapInfo &unmapInfo, EventsRequest &eventsRequest, bool blocking) {
+    unmapInfo.writeTracker->stop();
+    auto writtenRanges = unmapInfo.writeTracker->getWrittenRanges();
+    if (writtenRanges.empty()) {
+        return enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+    }
+
+    // dependencies are passed to the first write and output event to the last one,
+    // in-order queue keeps writes ordered so only blocking unmap waits, once after the last write
+    cl_int retVal = CL_SUCCESS;
+    for (size_t i = 0; i < writtenRanges.size() && retVal == CL_SUCCESS; i++) {
+        bool firstWrite = (i == 0);
+        bool lastWrite = (i + 1 == writtenRanges.size());
+        retVal = enqueueWriteBuffer(buffer, CL_FALSE, unmapInfo.offset[0] + writtenRanges[i].offset, writtenRanges[i].size,
+                                    ptrOffset(unmapInfo.ptr, writtenRanges[i].offset),
+                                    firstWrite ? eventsRequest.numEventsInWaitList : 0,
+                                    firstWrite ? eventsRequest.eventWaitList : nullptr,
+                                    lastWrite ? eventsRequest.outEvent : nullptr);
+    }
+    if (blocking && retVal == CL_SUCCESS) {
+        retVal = finish(true);
+    }
+    return retVal;
+}
+
 void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
     void *returnPtr = ptrOffset(transferProperties.memObj->getBasePtrForMap(),
                                 transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset);
@@ -413,6 +447,10 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
         transferProperties.memObj->removeMappedPtr(returnPtr);
         return nullptr;
     }
+    if (isMapWriteTrackingAllowed(transferProperties)) {
+        auto mappedPtrLength = transferProperties.memObj->calculateMappedPtrLength(transferProperties.size);
+        transferProperties.memObj->setMappedPtrWriteTracker(returnPtr, PageWriteTracker::create(returnPtr, mappedPtrLength));
+    }
     if (eventsRequest.outEvent) {
         auto event = castToObject<Event>(*eventsRequest.outEvent);
         event->setCmdType(transferProperties.cmdType);
@@ -433,7 +471,7 @@ cl_int CommandQueue::enqueueUnmapMemObject(TransferProperties &transferPropertie
     if (transferProperties.memObj->mappingOnCpuAllowed()) {
         cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
     } else {
-        retVal = enqueueWriteMemObjForUnmap(transferProperties.memObj, transferProperties.ptr, eventsRequest);
+        retVal = enqueueWriteMemObjForUnmap(transferProperties.memObj, transferProperties.ptr, eventsRequest, transferProperties.blocking);
     }
     return retVal;
 }
@@ -543,6 +581,67 @@ bool CommandQueue::setupDebugSurface(Kernel *kernel) {
     return true;
 }
 
+bool CommandQueue::isBlitEnqueueAllowed(MemObj *srcMemObj, MemObj *dstMemObj, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (!device->getBlitterEngine() || !getCommandStreamReceiver().peekTimestampPacketWriteEnabled() ||
+        isProfilingEnabled() || isPerfCountersEnabled() || isQueueBlocked()) {
+        return false;
+    }
+
+    for (auto memObj : {srcMemObj, dstMemObj}) {
+        if (memObj) {
+            auto gmm = memObj->getGraphicsAllocation()->gmm;
+            if (gmm && gmm->isRenderCompressed) {
+                return false;
+            }
+        }
+    }
+
+    // blitter waits only for timestamp packets, dependencies have to be already submitted
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto event = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (event->isUserEvent() || !event->getTimestampPacketNodes() || event->peekTaskCount() == Event::eventNotReady) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandQueue::isMapWriteTrackingAllowed(const TransferProperties &transferProperties) const {
+    // writes can be tracked only after blocking read completed and only in driver owned map storage
+    return DebugManager.flags.EnableMapWriteTracking.get() && transferProperties.blocking &&
+           transferProperties.mapFlags != CL_MAP_READ &&
+           transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER &&
+           !(transferProperties.memObj->getFlags() & CL_MEM_USE_HOST_PTR);
+}
+
+bool CommandQueue::isTransferCoalescingAllowed(cl_uint numEventsInWaitList, cl_event *event) {
+    // coalesced transfers are submitted later, nothing may observe them individually
+    return DebugManager.flags.EnableTransferCoalescing.get() && numEventsInWaitList == 0 && event == nullptr &&
+           !recordedCommandList && !isProfilingEnabled() && !isPerfCountersEnabled() && !isQueueBlocked();
+}
+
+cl_int CommandQueue::beginRecording() {
+    if (recordedCommandList || isProfilingEnabled() || isPerfCountersEnabled() ||
+        getCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        return CL_INVALID_OPERATION;
+    }
+    dispatchCoalescedTransfers();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+    recordedCommandList.reset(new RecordedCommandList(*this));
+    return CL_SUCCESS;
+}
+
+std::unique_ptr<RecordedCommandList> CommandQueue::endRecording(cl_int &errcodeRet) {
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+    std::unique_ptr<RecordedCommandList> commandList(recordedCommandList.release());
+    if (!commandList || !commandList->isValid() || commandList->getDispatches().empty()) {
+        errcodeRet = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    errcodeRet = CL_SUCCESS;
+    return commandList;
+}
+
 IndirectHeap &CommandQueue::getIndirectHeap(IndirectHeap::Type heapType, size_t minRequiredSize) {
     return getCommandStreamReceiver().getIndirectHeap(heapType, minRequiredSize);
 }
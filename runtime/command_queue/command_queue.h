@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "runtime/command_queue/recorded_command_list.h"
+#include "runtime/command_queue/transfer_coalescer.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/engine_control.h"
 #include "runtime/helpers/task_information.h"
@@ -191,6 +193,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return CL_SUCCESS;
     }
 
+    virtual cl_int enqueueRecordedCommandList(RecordedCommandList &commandList) {
+        return CL_SUCCESS;
+    }
+
     virtual cl_int enqueueSVMMigrateMem(cl_uint numSvmPointers,
                                         const void **svmPointers,
                                         const size_t *sizes,
@@ -303,6 +309,14 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     void *cpuDataTransferHandler(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &retVal);
 
+    bool isBlitEnqueueAllowed(MemObj *srcMemObj, MemObj *dstMemObj, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+
+    bool isTransferCoalescingAllowed(cl_uint numEventsInWaitList, cl_event *event);
+
+    virtual void dispatchCoalescedTransfers() {}
+
+    TransferCoalescer &getTransferCoalescer() { return transferCoalescer; }
+
     virtual cl_int finish(bool dcFlush) { return CL_SUCCESS; }
 
     virtual cl_int flush() { return CL_SUCCESS; }
@@ -394,6 +408,13 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL bool setupDebugSurface(Kernel *kernel);
 
+    // While recording, enqueued kernels are encoded into a RecordedCommandList instead of being submitted.
+    // The returned list can be submitted repeatedly with enqueueRecordedCommandList and has to be
+    // released before the queue is destroyed.
+    cl_int beginRecording();
+    std::unique_ptr<RecordedCommandList> endRecording(cl_int &errcodeRet);
+    RecordedCommandList *peekRecordedCommandList() const { return recordedCommandList.get(); }
+
     // taskCount of last task
     uint32_t taskCount = 0;
 
@@ -409,7 +430,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
   protected:
     void *enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
-    cl_int enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest);
+    cl_int enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest, bool blocking);
+    cl_int enqueueWriteTrackedRangesForUnmap(Buffer *buffer, MapInfo &unmapInfo, EventsRequest &eventsRequest, bool blocking);
+    bool isMapWriteTrackingAllowed(const TransferProperties &transferProperties) const;
 
     void *enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
     cl_int enqueueUnmapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest);
@@ -432,6 +455,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     QueueThrottle throttle = QueueThrottle::MEDIUM;
     uint32_t engineId = 0;
 
+    std::unique_ptr<RecordedCommandList> recordedCommandList;
+
     bool perfCountersEnabled = false;
     cl_uint perfCountersConfig = std::numeric_limits<uint32_t>::max();
     uint32_t perfCountersUserRegistersNumber = 0;
@@ -446,6 +471,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
 
+    TransferCoalescer transferCoalescer;
+
   private:
     void providePerformanceHint(TransferProperties &transferProperties);
 };
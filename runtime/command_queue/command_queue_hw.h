@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 
 namespace OCLRT {
 
+struct BlitProperties;
 class EventBuilder;
 
 template <typename GfxFamily>
@@ -57,12 +58,20 @@ class CommandQueueHw : public CommandQueue {
         }
     }
 
+    ~CommandQueueHw() override {
+        dispatchCoalescedTransfers();
+    }
+
     static CommandQueue *create(Context *context,
                                 Device *device,
                                 const cl_queue_properties *properties) {
         return new CommandQueueHw<GfxFamily>(context, device, properties);
     }
 
+    cl_int enqueueRecordedCommandList(RecordedCommandList &commandList) override;
+
+    void dispatchCoalescedTransfers() override;
+
     MOCKABLE_VIRTUAL void notifyEnqueueReadBuffer(Buffer *buffer, bool blockingRead);
     MOCKABLE_VIRTUAL void notifyEnqueueReadImage(Image *image, bool blockingRead);
 
@@ -331,6 +340,20 @@ class CommandQueueHw : public CommandQueue {
                         EventBuilder &externalEventBuilder,
                         std::unique_ptr<PrintfHandler> printfHandler);
 
+    template <uint32_t commandType>
+    void enqueueBlit(Surface **surfacesForResidency,
+                     size_t surfacesCount,
+                     BlitProperties &blitProperties,
+                     bool blocking,
+                     cl_uint numEventsInWaitList,
+                     const cl_event *eventWaitList,
+                     cl_event *event);
+
+    template <uint32_t commandType>
+    bool recordCommands(const MultiDispatchInfo &multiDispatchInfo,
+                        cl_uint numEventsInWaitList,
+                        cl_event *event);
+
   protected:
     MOCKABLE_VIRTUAL void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &dispatchInfo){};
     size_t calculateHostPtrSizeForImage(const size_t *region, size_t rowPitch, size_t slicePitch, Image *image);
@@ -339,6 +362,7 @@ class CommandQueueHw : public CommandQueue {
     bool isTaskLevelUpdateRequired(const uint32_t &taskLevel, const cl_event *eventWaitList, const cl_uint &numEventsInWaitList, unsigned int commandType);
     void obtainTaskLevelAndBlockedStatus(unsigned int &taskLevel, cl_uint &numEventsInWaitList, const cl_event *&eventWaitList, bool &blockQueue, unsigned int commandType) override;
     void forceDispatchScheduler(OCLRT::MultiDispatchInfo &multiDispatchInfo);
+    void applyTunedLocalWorkSize(MultiDispatchInfo &multiDispatchInfo, bool profilingRequired);
     static void computeOffsetsValueForRectCommands(size_t *bufferOffset,
                                                    size_t *hostOffset,
                                                    const size_t *bufferOrigin,
@@ -7,6 +7,7 @@
 
 #include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/command_queue/enqueue_barrier.h"
+#include "runtime/command_queue/enqueue_coalesced_transfers.h"
 #include "runtime/command_queue/enqueue_copy_buffer.h"
 #include "runtime/command_queue/enqueue_copy_buffer_rect.h"
 #include "runtime/command_queue/enqueue_copy_buffer_to_image.h"
@@ -21,6 +22,7 @@
 #include "runtime/command_queue/enqueue_read_buffer.h"
 #include "runtime/command_queue/enqueue_read_buffer_rect.h"
 #include "runtime/command_queue/enqueue_read_image.h"
+#include "runtime/command_queue/enqueue_recorded_command_list.h"
 #include "runtime/command_queue/enqueue_write_buffer.h"
 #include "runtime/command_queue/enqueue_write_buffer_rect.h"
 #include "runtime/command_queue/enqueue_write_image.h"
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,10 +11,13 @@
 #include "runtime/device/device.h"
 #include "runtime/event/event.h"
 #include "runtime/event/event_builder.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/helpers/get_info.h"
 #include "runtime/helpers/mipmap.h"
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/image.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "runtime/utilities/metrics_registry.h"
 
 namespace OCLRT {
 void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &retVal) {
@@ -26,6 +29,12 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
     bool mapOperation = transferProperties.cmdType == CL_COMMAND_MAP_BUFFER || transferProperties.cmdType == CL_COMMAND_MAP_IMAGE;
     ErrorCodeHelper err(&retVal, CL_SUCCESS);
 
+    dispatchCoalescedTransfers();
+    if (recordedCommandList) {
+        // transfer is done immediately on CPU, out of order with recorded commands
+        recordedCommandList->invalidate();
+    }
+
     if (mapOperation) {
         returnPtr = ptrOffset(transferProperties.memObj->getCpuAddressForMapping(),
                               transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset);
@@ -102,6 +111,7 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         }
 
         UNRECOVERABLE_IF((transferProperties.memObj->isMemObjZeroCopy() == false) && isMipMapped(transferProperties.memObj));
+        auto cpuCopyEngine = device->getExecutionEnvironment()->getCpuCopyEngine();
         switch (transferProperties.cmdType) {
         case CL_COMMAND_MAP_BUFFER:
             if (!transferProperties.memObj->isMemObjZeroCopy()) {
@@ -128,11 +138,38 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            MetricsRegistry::increment(MetricCounter::CpuCopiedBytes, transferProperties.size[0]);
+            if (cpuCopyEngine) {
+                cpuCopyEngine->copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            } else {
+                memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            }
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            MetricsRegistry::increment(MetricCounter::CpuCopiedBytes, transferProperties.size[0]);
+            if (cpuCopyEngine) {
+                cpuCopyEngine->copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
+            } else {
+                memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            }
+            eventCompleted = true;
+            break;
+        case CL_COMMAND_FILL_BUFFER:
+            if (cpuCopyEngine) {
+                cpuCopyEngine->fill(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.patternSize);
+            } else {
+                CpuCopyEngine::fillPattern(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.patternSize,
+                                           transferProperties.size[0] >= CpuCopyEngine::defaultNonTemporalThreshold);
+            }
+            eventCompleted = true;
+            break;
+        case CL_COMMAND_READ_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->readTiledDataOnCpu(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.size, transferProperties.offset);
+            eventCompleted = true;
+            break;
+        case CL_COMMAND_WRITE_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->writeTiledDataOnCpu(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.size, transferProperties.offset);
             eventCompleted = true;
             break;
         case CL_COMMAND_MARKER:
@@ -188,6 +225,9 @@ void CommandQueue::providePerformanceHint(TransferProperties &transferProperties
         break;
     case CL_COMMAND_WRITE_BUFFER:
         context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_BAD_INTEL, CL_ENQUEUE_WRITE_BUFFER_REQUIRES_COPY_DATA, static_cast<cl_mem>(transferProperties.memObj), transferProperties.ptr);
+        break;
+    case CL_COMMAND_WRITE_IMAGE:
+        context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, CL_ENQUEUE_WRITE_IMAGE_REQUIRES_COPY_DATA, static_cast<cl_mem>(transferProperties.memObj));
     }
 }
 } // namespace OCLRT
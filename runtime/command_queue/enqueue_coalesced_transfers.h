@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/built_ins/built_ins.h"
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/transfer_coalescer.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/string.h"
+#include "runtime/mem_obj/buffer.h"
+#include "runtime/memory_manager/internal_allocation_storage.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/memory_manager/surface.h"
+
+namespace OCLRT {
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::dispatchCoalescedTransfers() {
+    auto transfers = transferCoalescer.takePending();
+    if (!transfers) {
+        return;
+    }
+
+    auto memoryManager = getDevice().getMemoryManager();
+    DEBUG_BREAK_IF(nullptr == memoryManager);
+
+    // fill patterns are placed right after descriptors
+    auto descriptorsSize = transfers->descriptors.size() * sizeof(TransferDescriptor);
+    auto allocationSize = alignUp(descriptorsSize + transfers->patterns.size(), MemoryConstants::cacheLineSize);
+    auto descriptorsAllocation = memoryManager->allocateGraphicsMemoryWithProperties({allocationSize, GraphicsAllocation::AllocationType::FILL_PATTERN});
+    auto descriptorsBuffer = descriptorsAllocation->getUnderlyingBuffer();
+    memcpy_s(descriptorsBuffer, allocationSize, transfers->descriptors.data(), descriptorsSize);
+    if (!transfers->patterns.empty()) {
+        memcpy_s(ptrOffset(descriptorsBuffer, descriptorsSize), allocationSize - descriptorsSize, transfers->patterns.data(), transfers->patterns.size());
+    }
+
+    MultiDispatchInfo dispatchInfo;
+
+    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferScatter,
+                                                                                                        this->getContext(), this->getDevice());
+    BuiltInOwnershipWrapper builtInLock(builder, this->context);
+
+    BuiltinDispatchInfoBuilder::BuiltinOpParams dc;
+    dc.srcMemObj = transfers->srcBuffer;
+    dc.dstMemObj = transfers->dstBuffer;
+    dc.transferDescriptorsAlloc = descriptorsAllocation;
+    dc.transferDescriptorsCount = static_cast<uint32_t>(transfers->descriptors.size());
+    dc.size = {transfers->workItemsCount, 0, 0};
+    builder.buildDispatchInfos(dispatchInfo, dc);
+
+    MemObjSurface s1(transfers->dstBuffer);
+    GeneralSurface s2(descriptorsAllocation);
+    if (transfers->srcBuffer) {
+        MemObjSurface s3(transfers->srcBuffer);
+        Surface *surfaces[] = {&s1, &s2, &s3};
+        enqueueHandler<CL_COMMAND_COPY_BUFFER>(surfaces, false, dispatchInfo, 0, nullptr, nullptr);
+    } else {
+        Surface *surfaces[] = {&s1, &s2};
+        enqueueHandler<CL_COMMAND_FILL_BUFFER>(surfaces, false, dispatchInfo, 0, nullptr, nullptr);
+    }
+
+    auto storageForAllocation = getCommandStreamReceiver().getInternalAllocationStorage();
+    storageForAllocation->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(descriptorsAllocation), TEMPORARY_ALLOCATION, taskCount);
+}
+} // namespace OCLRT
@@ -18,6 +18,7 @@
 #include "runtime/event/event_builder.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/array_count.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/dispatch_info_builder.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/options.h"
@@ -32,6 +33,7 @@
 #include "runtime/program/block_kernel_manager.h"
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/trace_recorder.h"
 #include <algorithm>
 #include <new>
 
@@ -94,10 +96,40 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             }
         }
 
+        if (commandType == CL_COMMAND_NDRANGE_KERNEL) {
+            applyTunedLocalWorkSize(multiDispatchInfo, isProfilingEnabled() && event != nullptr);
+        }
+
         enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
     }
 }
 
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::applyTunedLocalWorkSize(MultiDispatchInfo &multiDispatchInfo, bool profilingRequired) {
+    if (multiDispatchInfo.size() != 1 || multiDispatchInfo.peekParentKernel()) {
+        return;
+    }
+    auto &dispatchInfo = *multiDispatchInfo.begin();
+    auto localWorkSizeTuner = dispatchInfo.getKernel()->getLocalWorkSizeTuner();
+    if (localWorkSizeTuner == nullptr || dispatchInfo.getEnqueuedWorkgroupSize().x != 0) {
+        return;
+    }
+
+    auto localWorkSizeTuningKey = createLocalWorkSizeCacheKey(dispatchInfo);
+    auto localWorkSize = dispatchInfo.getLocalWorkgroupSize();
+    bool trialRequired = false;
+    // timestamps of user profiled enqueues belong to the event, such enqueues and recorded ones only reuse tuned values
+    if (profilingRequired || recordedCommandList) {
+        localWorkSizeTuner->findTunedLocalWorkSize(localWorkSizeTuningKey, localWorkSize);
+    } else {
+        localWorkSize = localWorkSizeTuner->selectLocalWorkSize(localWorkSizeTuningKey, localWorkSize, trialRequired);
+    }
+    if (localWorkSize != dispatchInfo.getLocalWorkgroupSize()) {
+        overrideLocalWorkSize(dispatchInfo, localWorkSize);
+    }
+    multiDispatchInfo.setLocalWorkSizeTrialRequired(trialRequired);
+}
+
 template <typename GfxFamily>
 void CommandQueueHw<GfxFamily>::forceDispatchScheduler(OCLRT::MultiDispatchInfo &multiDispatchInfo) {
     BuiltIns &builtIns = *getDevice().getExecutionEnvironment()->getBuiltIns();
@@ -133,6 +165,12 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    dispatchCoalescedTransfers();
+
+    if (recordedCommandList && recordCommands<commandType>(multiDispatchInfo, numEventsInWaitList, event)) {
+        return;
+    }
+
     if (multiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
         enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo,
                                           numEventsInWaitList, eventWaitList, event);
@@ -153,6 +191,9 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     TimeStampData queueTimeStamp;
     if (isProfilingEnabled() && event) {
         this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
+        if (TraceRecorder::getEnabledInstance()) {
+            this->getDevice().getGpuTimeline().addSample(queueTimeStamp, TraceRecorder::getTimestamp());
+        }
     }
 
     EventBuilder eventBuilder;
@@ -182,7 +223,23 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     auto taskLevel = 0u;
     obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
 
-    auto &commandStream = getCommandStream<GfxFamily, commandType>(*this, numEventsInWaitList, profilingRequired, perfCountersRequired, multiDispatchInfo);
+    LocalWorkSizeTuner *localWorkSizeTuner = nullptr;
+    LocalWorkSizeTuner::Key localWorkSizeTuningKey;
+    TagNode<HwTimeStamps> *localWorkSizeTrialTimeStamps = nullptr;
+    if (multiDispatchInfo.isLocalWorkSizeTrialRequired()) {
+        auto &dispatchInfo = *multiDispatchInfo.begin();
+        localWorkSizeTuner = dispatchInfo.getKernel()->getLocalWorkSizeTuner();
+        localWorkSizeTuningKey = createLocalWorkSizeCacheKey(dispatchInfo);
+        // blocked enqueue is submitted later, its duration is not measured
+        if (blockQueue) {
+            localWorkSizeTuner->cancelTrial(localWorkSizeTuningKey, dispatchInfo.getLocalWorkgroupSize());
+        } else {
+            localWorkSizeTrialTimeStamps = getCommandStreamReceiver().getEventTsAllocator()->getTag();
+        }
+    }
+
+    auto &commandStream = getCommandStream<GfxFamily, commandType>(*this, numEventsInWaitList, profilingRequired || localWorkSizeTrialTimeStamps,
+                                                                  perfCountersRequired, multiDispatchInfo);
     auto commandStreamStart = commandStream.getUsed();
 
     DBG_LOG(EventsDebugEnable, "blockQueue", blockQueue, "virtualEvent", virtualEvent, "taskLevel", taskLevel);
@@ -239,6 +296,10 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             }
         }
 
+        if (localWorkSizeTrialTimeStamps) {
+            hwTimeStamps = localWorkSizeTrialTimeStamps;
+        }
+
         if (parentKernel) {
             parentKernel->createReflectionSurface();
             parentKernel->patchDefaultDeviceQueue(context->getDefaultDeviceQueue());
@@ -264,6 +325,10 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             blockQueue,
             commandType);
 
+        if (localWorkSizeTrialTimeStamps) {
+            getCommandStreamReceiver().makeResident(*localWorkSizeTrialTimeStamps->getGraphicsAllocation());
+        }
+
         if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
             for (auto &dispatchInfo : multiDispatchInfo) {
                 for (auto &patchInfoData : dispatchInfo.getKernel()->getPatchInfoDataList()) {
@@ -403,6 +468,11 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     }
     updateFromCompletionStamp(completionStamp);
 
+    if (localWorkSizeTrialTimeStamps) {
+        localWorkSizeTuner->addTrial(localWorkSizeTuningKey, multiDispatchInfo.begin()->getLocalWorkgroupSize(), localWorkSizeTrialTimeStamps,
+                                     getCommandStreamReceiver().getTagAddress(), completionStamp.taskCount);
+    }
+
     if (eventBuilder.getEvent()) {
         eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
         DebugManager.log(DebugManager.flags.EventsDebugEnable.get(), "updateCompletionStamp Event", eventBuilder.getEvent(), "taskLevel", eventBuilder.getEvent()->taskLevel.load());
@@ -719,6 +789,110 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
     this->virtualEvent = eventBuilder->getEvent();
 }
 
+template <typename GfxFamily>
+template <uint32_t commandType>
+void CommandQueueHw<GfxFamily>::enqueueBlit(
+    Surface **surfaces,
+    size_t surfaceCount,
+    BlitProperties &blitProperties,
+    bool blocking,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+    using MI_ATOMIC = typename GfxFamily::MI_ATOMIC;
+
+    dispatchCoalescedTransfers();
+
+    auto &blitCommandStreamReceiver = *device->getBlitterEngine()->commandStreamReceiver;
+    auto commandStreamRecieverOwnership = getCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.create<Event>(this, commandType, Event::eventNotReady, 0);
+        *event = eventBuilder.getEvent();
+        DBG_LOG(EventsDebugEnable, "enqueueBlit commandType", commandType, "output Event", eventBuilder.getEvent());
+    }
+
+    auto blockQueue = false;
+    auto taskLevel = 0u;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
+    DEBUG_BREAK_IF(blockQueue);
+
+    if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
+        blocking = true;
+    }
+
+    // blitter waits on packets of previous enqueues, batched compute work has to be submitted first
+    getCommandStreamReceiver().flushBatchedSubmissions();
+
+    TimestampPacketContainer previousTimestampPacketNodes;
+    obtainNewTimestampPacketNodes(1, previousTimestampPacketNodes);
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->addTimestampPacketNodes(*timestampPacketContainer);
+    }
+
+    blitProperties.outputTimestampPacket = timestampPacketContainer.get();
+    blitProperties.timestampPacketDependencies.push_back(&previousTimestampPacketNodes);
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto waitlistEvent = castToObjectOrAbort<Event>(eventWaitList[i]);
+        blitProperties.timestampPacketDependencies.push_back(waitlistEvent->getTimestampPacketNodes());
+    }
+
+    blitCommandStreamReceiver.blitBuffer(blitProperties);
+
+    // compute engine waits for the blit, so queue and event task counts cover its completion
+    auto &commandStream = getCS(timestampPacketContainer->peekNodes().size() * (sizeof(MI_SEMAPHORE_WAIT) + sizeof(MI_ATOMIC)));
+    auto commandStreamStart = commandStream.getUsed();
+    for (auto &node : timestampPacketContainer->peekNodes()) {
+        TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(commandStream, *node->tag);
+    }
+    timestampPacketContainer->makeResident(getCommandStreamReceiver());
+
+    for (auto surface : CreateRange(surfaces, surfaceCount)) {
+        surface->makeResident(getCommandStreamReceiver());
+    }
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.blocking = blocking;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.lowPriority = (QueuePriority::LOW == priority);
+    dispatchFlags.throttle = getThrottle();
+    dispatchFlags.flushStampReference = this->flushStamp->getStampReference();
+    dispatchFlags.preemptionMode = PreemptionHelper::taskPreemptionMode(*device, nullptr);
+    dispatchFlags.outOfOrderExecutionAllowed = !eventBuilder.getEvent() || getCommandStreamReceiver().isNTo1SubmissionModelEnabled();
+
+    if (gtpinIsGTPinInitialized()) {
+        gtpinNotifyPreFlushTask(this);
+    }
+
+    CompletionStamp completionStamp = getCommandStreamReceiver().flushTask(
+        commandStream,
+        commandStreamStart,
+        getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 0u),
+        getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 0u),
+        getIndirectHeap(IndirectHeap::SURFACE_STATE, 0u),
+        taskLevel,
+        dispatchFlags,
+        *device);
+
+    updateFromCompletionStamp(completionStamp);
+
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+
+    queueOwnership.unlock();
+    commandStreamRecieverOwnership.unlock();
+
+    if (blocking) {
+        waitUntilComplete(taskCount, flushStamp->peekStamp(), false);
+        getCommandStreamReceiver().waitForTaskCountAndCleanAllocationList(completionStamp.taskCount, TEMPORARY_ALLOCATION);
+    }
+}
+
 template <typename GfxFamily>
 void CommandQueueHw<GfxFamily>::computeOffsetsValueForRectCommands(size_t *bufferOffset,
                                                                    size_t *hostOffset,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/memory_manager/surface.h"
@@ -29,6 +30,33 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     const cl_event *eventWaitList,
     cl_event *event) {
 
+    if (isBlitEnqueueAllowed(srcBuffer, dstBuffer, numEventsInWaitList, eventWaitList)) {
+        MemObjSurface s1(srcBuffer);
+        MemObjSurface s2(dstBuffer);
+        Surface *surfaces[] = {&s1, &s2};
+
+        BlitProperties blitProperties;
+        blitProperties.srcAllocation = srcBuffer->getGraphicsAllocation();
+        blitProperties.dstAllocation = dstBuffer->getGraphicsAllocation();
+        blitProperties.srcGpuAddress = blitProperties.srcAllocation->getGpuAddress() + srcBuffer->getOffset() + srcOffset;
+        blitProperties.dstGpuAddress = blitProperties.dstAllocation->getGpuAddress() + dstBuffer->getOffset() + dstOffset;
+        blitProperties.copySize = size;
+
+        enqueueBlit<CL_COMMAND_COPY_BUFFER>(surfaces, arrayCount(surfaces), blitProperties, false, numEventsInWaitList, eventWaitList, event);
+        return CL_SUCCESS;
+    }
+
+    if (isTransferCoalescingAllowed(numEventsInWaitList, event) &&
+        TransferCoalescer::isCopyCoalescable(srcBuffer, dstBuffer, srcOffset, dstOffset, size)) {
+        while (!transferCoalescer.addCopy(srcBuffer, dstBuffer, srcOffset, dstOffset, size)) {
+            dispatchCoalescedTransfers();
+        }
+        if (transferCoalescer.isFull()) {
+            dispatchCoalescedTransfers();
+        }
+        return CL_SUCCESS;
+    }
+
     MultiDispatchInfo dispatchInfo;
 
     auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
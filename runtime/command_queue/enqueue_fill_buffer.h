@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,29 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     cl_uint numEventsInWaitList,
     const cl_event *eventWaitList,
     cl_event *event) {
+    auto &commandStreamReceiver = getCommandStreamReceiver();
+    bool commandStreamReceiverIdle = *commandStreamReceiver.getTagAddress() >= commandStreamReceiver.peekTaskCount();
+    if (buffer->isFillOnCpuAllowed(numEventsInWaitList, size) && commandStreamReceiverIdle && !isQueueBlocked() &&
+        context->getDevice(0)->getDeviceInfo().cpuCopyAllowed) {
+        cl_int retVal = CL_SUCCESS;
+        TransferProperties transferProperties(buffer, CL_COMMAND_FILL_BUFFER, 0, true, &offset, &size, const_cast<void *>(pattern));
+        transferProperties.patternSize = patternSize;
+        EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+        cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+        return retVal;
+    }
+
+    if (isTransferCoalescingAllowed(numEventsInWaitList, event) &&
+        TransferCoalescer::isFillCoalescable(patternSize, offset, size)) {
+        while (!transferCoalescer.addFill(buffer, pattern, patternSize, offset, size)) {
+            dispatchCoalescedTransfers();
+        }
+        if (transferCoalescer.isFull()) {
+            dispatchCoalescedTransfers();
+        }
+        return CL_SUCCESS;
+    }
+
     auto memoryManager = getDevice().getMemoryManager();
     DEBUG_BREAK_IF(nullptr == memoryManager);
 
@@ -10,6 +10,7 @@
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/cache_policy.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/mem_obj/buffer.h"
@@ -78,6 +79,26 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
 
         return CL_SUCCESS;
     }
+    if (size != 0 && isBlitEnqueueAllowed(buffer, nullptr, numEventsInWaitList, eventWaitList)) {
+        MemObjSurface bufferSurf(buffer);
+        HostPtrSurface hostPtrSurf(ptr, size);
+        Surface *surfaces[] = {&bufferSurf, &hostPtrSurf};
+
+        if (!getCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, getDevice(), true)) {
+            return CL_OUT_OF_RESOURCES;
+        }
+
+        BlitProperties blitProperties;
+        blitProperties.srcAllocation = buffer->getGraphicsAllocation();
+        blitProperties.dstAllocation = hostPtrSurf.getAllocation();
+        blitProperties.srcGpuAddress = blitProperties.srcAllocation->getGpuAddress() + buffer->getOffset() + offset;
+        blitProperties.dstGpuAddress = blitProperties.dstAllocation->getGpuAddress();
+        blitProperties.copySize = size;
+
+        enqueueBlit<CL_COMMAND_READ_BUFFER>(surfaces, arrayCount(surfaces), blitProperties, blockingRead == CL_TRUE, numEventsInWaitList, eventWaitList, event);
+        return CL_SUCCESS;
+    }
+
     auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
                                                                                                         this->getContext(), this->getDevice());
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
@@ -67,6 +67,16 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
         return CL_SUCCESS;
     }
 
+    if (srcImage->isTiledReadWriteOnCpuAllowed(blockingRead, numEventsInWaitList, region) && context->getDevice(0)->getDeviceInfo().cpuCopyAllowed) {
+        cl_int retVal = CL_SUCCESS;
+        TransferProperties transferProperties(srcImage, CL_COMMAND_READ_IMAGE, 0, true, const_cast<size_t *>(origin), const_cast<size_t *>(region), ptr);
+        transferProperties.hostRowPitch = inputRowPitch;
+        transferProperties.hostSlicePitch = inputSlicePitch;
+        EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+        cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+        return retVal;
+    }
+
     auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer,
                                                                                                         this->getContext(), this->getDevice());
 
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/gpgpu_walker.h"
+#include "runtime/command_queue/hardware_interface.h"
+#include "runtime/command_queue/recorded_command_list.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/kernel_commands.h"
+#include "runtime/helpers/preamble.h"
+#include "runtime/helpers/preemption.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/program/program.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+template <typename GfxFamily>
+template <uint32_t commandType>
+bool CommandQueueHw<GfxFamily>::recordCommands(const MultiDispatchInfo &multiDispatchInfo,
+                                               cl_uint numEventsInWaitList,
+                                               cl_event *event) {
+    using KCH = KernelCommandsHelper<GfxFamily>;
+    using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+    auto &commandList = *recordedCommandList;
+    if (!commandList.isValid()) {
+        return false;
+    }
+
+    // only self-contained kernel dispatches can be replayed without re-encoding
+    auto kernel = multiDispatchInfo.peekMainKernel();
+    bool recordable = commandType == CL_COMMAND_NDRANGE_KERNEL &&
+                      multiDispatchInfo.size() == 1 &&
+                      numEventsInWaitList == 0 &&
+                      event == nullptr &&
+                      multiDispatchInfo.peekParentKernel() == nullptr &&
+                      !isQueueBlocked() &&
+                      !kernel->isAuxTranslationRequired() &&
+                      !multiDispatchInfo.usesStatelessPrintfSurface() &&
+                      !kernel->getProgram()->isKernelDebugEnabled() &&
+                      !KCH::inlineDataProgrammingRequired(*kernel);
+
+    auto &commandStream = commandList.getCommandStream();
+    auto &dsh = commandList.getIndirectHeap(IndirectHeap::DYNAMIC_STATE);
+    auto &ioh = commandList.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    auto &ssh = commandList.getIndirectHeap(IndirectHeap::SURFACE_STATE);
+
+    if (recordable) {
+        auto requiredSizeCS = EnqueueOperation<GfxFamily>::getSizeRequiredCS(commandType, false, false, *this, kernel) +
+                              sizeof(MI_BATCH_BUFFER_END);
+        recordable = commandStream.getAvailableSpace() >= requiredSizeCS &&
+                     dsh.getAvailableSpace() >= KCH::getTotalSizeRequiredDSH(multiDispatchInfo) + KCH::alignInterfaceDescriptorData &&
+                     ioh.getAvailableSpace() >= KCH::getTotalSizeRequiredIOH(multiDispatchInfo) + WALKER_TYPE<GfxFamily>::INDIRECTDATASTARTADDRESS_ALIGN_SIZE &&
+                     ssh.getAvailableSpace() >= KCH::getTotalSizeRequiredSSH(multiDispatchInfo) + BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE;
+    }
+
+    // command is executed immediately by caller, so list recorded around it can't be replayed in order
+    if (!recordable) {
+        commandList.invalidate();
+        return false;
+    }
+
+    auto iohUsedBefore = ioh.getUsed();
+    auto sshUsedBefore = ssh.getUsed();
+    auto preemption = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
+
+    HardwareInterface<GfxFamily>::dispatchWalker(
+        *this,
+        multiDispatchInfo,
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        preemption,
+        false,
+        commandType);
+
+    commandList.addDispatch(*kernel,
+                            alignUp(iohUsedBefore, WALKER_TYPE<GfxFamily>::INDIRECTDATASTARTADDRESS_ALIGN_SIZE),
+                            alignUp(sshUsedBefore, BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE),
+                            ssh.getUsed() != sshUsedBefore);
+
+    commandList.slmUsed |= multiDispatchInfo.usesSlm();
+    commandList.requiresCoherency |= kernel->requiresCoherency();
+    commandList.mediaSamplerRequired |= kernel->isVmeKernel();
+    commandList.specialPipelineSelectMode |= kernel->requiresSpecialPipelineSelectMode();
+    commandList.numGrfRequired = std::max(commandList.numGrfRequired, kernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired);
+    commandList.requiredScratchSize = std::max(commandList.requiredScratchSize, multiDispatchInfo.getRequiredScratchSize());
+    if (commandList.getDispatches().size() == 1) {
+        commandList.preemptionMode = preemption;
+    } else {
+        commandList.preemptionMode = std::min(commandList.preemptionMode, preemption);
+    }
+    return true;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueRecordedCommandList(RecordedCommandList &commandList) {
+    using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+    using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
+
+    if (&commandList.getCommandQueue() != this || !commandList.isValid() || commandList.getDispatches().empty() ||
+        commandList.hasChangedLocalMemorySize() || recordedCommandList || isQueueBlocked()) {
+        return CL_INVALID_OPERATION;
+    }
+    dispatchCoalescedTransfers();
+
+    auto &recordedCommandStream = commandList.getCommandStream();
+    if (!commandList.isClosed()) {
+        *recordedCommandStream.getSpaceForCmd<MI_BATCH_BUFFER_END>() = GfxFamily::cmdInitBatchBufferEnd;
+        commandList.close();
+    }
+
+    // recorded heaps are reused by every submission, so the previous one has to retire before arguments are refreshed
+    if (commandList.hasStaleKernelArguments(sizeof(RENDER_SURFACE_STATE))) {
+        waitUntilComplete(commandList.peekLastTaskCount(), this->flushStamp->peekStamp(), false);
+        commandList.patchKernelArguments(sizeof(RENDER_SURFACE_STATE));
+    }
+
+    auto &commandStreamReceiver = getCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    auto blockQueue = false;
+    auto taskLevel = 0u;
+    cl_uint numEventsInWaitList = 0;
+    const cl_event *eventWaitList = nullptr;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+
+    auto &commandStream = getCS(sizeof(MI_BATCH_BUFFER_START));
+    auto commandStreamStart = commandStream.getUsed();
+    auto bbStart = commandStream.getSpaceForCmd<MI_BATCH_BUFFER_START>();
+    *bbStart = GfxFamily::cmdInitBatchBufferStart;
+    bbStart->setBatchBufferStartAddressGraphicsaddress472(recordedCommandStream.getGraphicsAllocation()->getGpuAddress());
+    bbStart->setAddressSpaceIndicator(MI_BATCH_BUFFER_START::ADDRESS_SPACE_INDICATOR_PPGTT);
+    bbStart->setSecondLevelBatchBuffer(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH);
+
+    commandStreamReceiver.makeResident(*recordedCommandStream.getGraphicsAllocation());
+    for (auto &dispatch : commandList.getDispatches()) {
+        dispatch.kernel->makeResident(commandStreamReceiver);
+    }
+    commandStreamReceiver.setRequiredScratchSize(commandList.requiredScratchSize);
+    commandStreamReceiver.requestThreadArbitrationPolicy(commandList.getDispatches()[0].kernel->getThreadArbitrationPolicy<GfxFamily>());
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.useSLM = commandList.slmUsed;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.GSBA32BitRequired = true;
+    dispatchFlags.mediaSamplerRequired = commandList.mediaSamplerRequired;
+    dispatchFlags.requiresCoherency = commandList.requiresCoherency;
+    dispatchFlags.lowPriority = (QueuePriority::LOW == priority);
+    dispatchFlags.throttle = getThrottle();
+    dispatchFlags.flushStampReference = this->flushStamp->getStampReference();
+    dispatchFlags.preemptionMode = commandList.preemptionMode;
+    dispatchFlags.outOfOrderExecutionAllowed = true;
+    dispatchFlags.numGrfRequired = commandList.numGrfRequired;
+    dispatchFlags.specialPipelineSelectMode = commandList.specialPipelineSelectMode;
+
+    CompletionStamp completionStamp = commandStreamReceiver.flushTask(
+        commandStream,
+        commandStreamStart,
+        commandList.getIndirectHeap(IndirectHeap::DYNAMIC_STATE),
+        commandList.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT),
+        commandList.getIndirectHeap(IndirectHeap::SURFACE_STATE),
+        taskLevel,
+        dispatchFlags,
+        *device);
+
+    updateFromCompletionStamp(completionStamp);
+    commandList.setLastTaskCount(completionStamp.taskCount);
+    return CL_SUCCESS;
+}
+} // namespace OCLRT
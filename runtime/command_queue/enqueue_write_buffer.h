@@ -9,6 +9,7 @@
 #include "hw_cmds.h"
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/string.h"
 #include "runtime/mem_obj/buffer.h"
@@ -77,6 +78,26 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
         return CL_SUCCESS;
     }
+    if (size != 0 && isBlitEnqueueAllowed(nullptr, buffer, numEventsInWaitList, eventWaitList)) {
+        HostPtrSurface hostPtrSurf(const_cast<void *>(ptr), size, true);
+        MemObjSurface bufferSurf(buffer);
+        Surface *surfaces[] = {&bufferSurf, &hostPtrSurf};
+
+        if (!getCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, getDevice(), false)) {
+            return CL_OUT_OF_RESOURCES;
+        }
+
+        BlitProperties blitProperties;
+        blitProperties.srcAllocation = hostPtrSurf.getAllocation();
+        blitProperties.dstAllocation = buffer->getGraphicsAllocation();
+        blitProperties.srcGpuAddress = blitProperties.srcAllocation->getGpuAddress();
+        blitProperties.dstGpuAddress = blitProperties.dstAllocation->getGpuAddress() + buffer->getOffset() + offset;
+        blitProperties.copySize = size;
+
+        enqueueBlit<CL_COMMAND_WRITE_BUFFER>(surfaces, arrayCount(surfaces), blitProperties, blockingWrite == CL_TRUE, numEventsInWaitList, eventWaitList, event);
+        return CL_SUCCESS;
+    }
+
     auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
                                                                                                         this->getContext(), this->getDevice());
 
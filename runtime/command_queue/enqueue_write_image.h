@@ -61,6 +61,17 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
 
         return CL_SUCCESS;
     }
+
+    if (dstImage->isTiledReadWriteOnCpuAllowed(blockingWrite, numEventsInWaitList, region) && context->getDevice(0)->getDeviceInfo().cpuCopyAllowed) {
+        cl_int retVal = CL_SUCCESS;
+        TransferProperties transferProperties(dstImage, CL_COMMAND_WRITE_IMAGE, 0, true, const_cast<size_t *>(origin), const_cast<size_t *>(region), const_cast<void *>(ptr));
+        transferProperties.hostRowPitch = inputRowPitch;
+        transferProperties.hostSlicePitch = inputSlicePitch;
+        EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+        cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+        return retVal;
+    }
+
     auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d,
                                                                                                         this->getContext(), this->getDevice());
 
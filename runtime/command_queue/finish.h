@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@ namespace OCLRT {
 
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::finish(bool dcFlush) {
+    dispatchCoalescedTransfers();
     getCommandStreamReceiver().flushBatchedSubmissions();
 
     //as long as queue is blocked we need to stall.
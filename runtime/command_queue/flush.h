@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 namespace OCLRT {
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::flush() {
+    dispatchCoalescedTransfers();
     getCommandStreamReceiver().flushBatchedSubmissions();
     return CL_SUCCESS;
 }
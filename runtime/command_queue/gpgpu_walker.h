@@ -80,6 +80,9 @@ void computeWorkgroupSizeSquared(
     size_t simdSize,
     const uint32_t workDim);
 
+LocalWorkSizeCache::Key createLocalWorkSizeCacheKey(
+    const DispatchInfo &dispatchInfo);
+
 Vec3<size_t> computeWorkgroupSize(
     const DispatchInfo &dispatchInfo);
 
@@ -97,6 +100,10 @@ Vec3<size_t> generateWorkgroupsNumber(
 Vec3<size_t> generateWorkgroupsNumber(
     const DispatchInfo &dispatchInfo);
 
+void overrideLocalWorkSize(
+    DispatchInfo &dispatchInfo,
+    const Vec3<size_t> &lws);
+
 inline uint32_t calculateDispatchDim(Vec3<size_t> dispatchSize, Vec3<size_t> dispatchOffset) {
     return std::max(1U, std::max(dispatchSize.getSimplifiedDim(), dispatchOffset.getSimplifiedDim()));
 }
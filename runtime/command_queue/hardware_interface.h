@@ -12,6 +12,7 @@
 namespace OCLRT {
 
 class CommandQueue;
+class CommandStreamReceiver;
 class DispatchInfo;
 class IndirectHeap;
 class Kernel;
@@ -93,7 +94,8 @@ class HardwareInterface {
         const DispatchInfo &dispatchInfo,
         size_t offsetInterfaceDescriptorTable,
         Vec3<size_t> &numberOfWorkgroups,
-        Vec3<size_t> &startOfWorkgroups);
+        Vec3<size_t> &startOfWorkgroups,
+        CommandStreamReceiver *indirectDataOwner);
 
     static WALKER_TYPE<GfxFamily> *allocateWalkerSpace(LinearStream &commandStream,
                                                        const Kernel &kernel);
@@ -49,7 +49,14 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     }
 
     // Allocate command stream and indirect heaps
-    if (blockQueue) {
+    auto recordedCommandList = commandQueue.peekRecordedCommandList();
+    bool recordedDispatch = recordedCommandList && recordedCommandList->isValid();
+    if (recordedDispatch) {
+        commandStream = &recordedCommandList->getCommandStream();
+        dsh = &recordedCommandList->getIndirectHeap(IndirectHeap::DYNAMIC_STATE);
+        ioh = &recordedCommandList->getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+        ssh = &recordedCommandList->getIndirectHeap(IndirectHeap::SURFACE_STATE);
+    } else if (blockQueue) {
         using KCH = KernelCommandsHelper<GfxFamily>;
         commandStream = new LinearStream(alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize),
                                          MemoryConstants::pageSize);
@@ -125,6 +132,12 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
         pPipeControlCmd->setCommandStreamerStallEnable(true);
     }
 
+    // indirect data of dispatches recorded into command list heaps or blocked ones is not owned by the command stream receiver heap
+    CommandStreamReceiver *indirectDataOwner = nullptr;
+    if (!blockQueue && !parentKernel && !recordedDispatch) {
+        indirectDataOwner = &commandQueue.getCommandStreamReceiver();
+    }
+
     size_t currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
         auto &kernel = *dispatchInfo.getKernel();
@@ -204,7 +217,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
         programWalker(*commandStream, kernel, commandQueue, currentTimestampPacketNodes, *dsh, *ioh, *ssh, globalWorkSizes,
                       localWorkSizes, preemptionMode, currentDispatchIndex, interfaceDescriptorIndex, dispatchInfo,
-                      offsetInterfaceDescriptorTable, numberOfWorkgroups, startOfWorkgroups);
+                      offsetInterfaceDescriptorTable, numberOfWorkgroups, startOfWorkgroups, indirectDataOwner);
 
         dispatchWorkarounds(commandStream, commandQueue, kernel, false);
         if (dispatchInfo.isPipeControlRequired()) {
@@ -101,7 +101,8 @@ inline void HardwareInterface<GfxFamily>::programWalker(
     const DispatchInfo &dispatchInfo,
     size_t offsetInterfaceDescriptorTable,
     Vec3<size_t> &numberOfWorkgroups,
-    Vec3<size_t> &startOfWorkgroups) {
+    Vec3<size_t> &startOfWorkgroups,
+    CommandStreamReceiver *indirectDataOwner) {
 
     auto walkerCmd = allocateWalkerSpace(commandStream, kernel);
     uint32_t dim = dispatchInfo.getDim();
@@ -129,7 +130,8 @@ inline void HardwareInterface<GfxFamily>::programWalker(
         preemptionMode,
         walkerCmd,
         nullptr,
-        true);
+        true,
+        indirectDataOwner);
 
     GpgpuWalkerHelper<GfxFamily>::setGpgpuWalkerThreadData(walkerCmd, globalOffsets, startWorkGroups,
                                                            numWorkGroups, localWorkSizes, simd, dim,
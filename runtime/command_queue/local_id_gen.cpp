@@ -15,19 +15,39 @@ namespace OCLRT {
 
 struct uint16x8_t;
 struct uint16x16_t;
+struct uint16x32_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
-// Must be 32byte aligned for AVX2 usage
-ALIGNAS(32)
+// Must be 64byte aligned for AVX512 usage
+ALIGNAS(64)
 const uint16_t initialLocalID[] = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
 
+// Lane offsets from the first local ID of a GRF in layout for images.
+// First row is used for SIMD8 (X delta 2), second for SIMD16/32 (X delta 4).
+ALIGNAS(64)
+const uint16_t initialLocalIDForImagesX[2][32] = {
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+     0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
+    {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+     0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3}};
+
+ALIGNAS(64)
+const uint16_t initialLocalIDForImagesY[2][32] = {
+    {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+     8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+     4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7}};
+
 // Lookup table for generating LocalIDs based on the SIMD of the kernel
 void (*LocalIDHelper::generateSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder) = generateLocalIDsSimd<uint16x8_t, 8>;
 void (*LocalIDHelper::generateSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder) = generateLocalIDsSimd<uint16x8_t, 16>;
 void (*LocalIDHelper::generateSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder) = generateLocalIDsSimd<uint16x8_t, 32>;
+void (*LocalIDHelper::generateWithLayoutForImagesSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize) = generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 8>;
+void (*LocalIDHelper::generateWithLayoutForImagesSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize) = generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 16>;
+void (*LocalIDHelper::generateWithLayoutForImagesSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize) = generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 32>;
 
 // Initialize the lookup table based on CPU capabilities
 LocalIDHelper::LocalIDHelper() {
@@ -36,6 +56,14 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd8 = generateLocalIDsSimd<uint16x8_t, 8>;
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
+        LocalIDHelper::generateWithLayoutForImagesSimd16 = generateLocalIDsWithLayoutForImagesSimd<uint16x16_t, 16>;
+        LocalIDHelper::generateWithLayoutForImagesSimd32 = generateLocalIDsWithLayoutForImagesSimd<uint16x16_t, 32>;
+    }
+    // a single AVX512 register covers a whole SIMD32 GRF pair
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw);
+    if (supportsAVX512) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+        LocalIDHelper::generateWithLayoutForImagesSimd32 = generateLocalIDsWithLayoutForImagesSimd<uint16x32_t, 32>;
     }
 }
 
@@ -66,51 +94,48 @@ bool isCompatibleWithLayoutForImages(const std::array<uint16_t, 3> &localWorkgro
            localWorkgroupSize.at(2) == 1u;
 }
 
-inline void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd) {
-    uint8_t rowWidth = simd == 32u ? 32u : 16u;
-    uint8_t xDelta = simd == 8u ? 2u : 4u;                                                    // difference between corresponding values in consecutive X rows
-    uint8_t yDelta = (simd == 8u || localWorkgroupSize.at(1) == 4u) ? 4u : rowWidth / xDelta; // difference between corresponding values in consecutive Y rows
+void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd) {
+    if (simd == 32) {
+        LocalIDHelper::generateWithLayoutForImagesSimd32(b, localWorkgroupSize);
+    } else if (simd == 16) {
+        LocalIDHelper::generateWithLayoutForImagesSimd16(b, localWorkgroupSize);
+    } else {
+        LocalIDHelper::generateWithLayoutForImagesSimd8(b, localWorkgroupSize);
+    }
+}
 
-    auto buffer = reinterpret_cast<uint16_t *>(b);
-    uint16_t offset = 0u;
-    auto numGrfs = (localWorkgroupSize.at(0) * localWorkgroupSize.at(1) * localWorkgroupSize.at(2) + (simd - 1)) / simd;
+// Fills a single GRF of the layout for images lane by lane, handling Y wrapping inside the GRF
+void generateLocalIDsWithLayoutForImagesGrf(uint16_t *rowX, uint16_t *rowY, uint16_t *rowZ, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                            uint16_t simd, uint16_t &x, uint16_t &y, uint16_t yDelta) {
+    uint8_t xDelta = simd == 8u ? 2u : 4u;
     uint8_t xMask = simd == 8u ? 0b1 : 0b11;
-    uint16_t x = 0u;
-    uint16_t y = 0u;
-    for (auto grfId = 0; grfId < numGrfs; grfId++) {
-        auto rowX = buffer + offset;
-        auto rowY = buffer + offset + rowWidth;
-        auto rowZ = buffer + offset + 2 * rowWidth;
-        uint16_t extraX = 0u;
-        uint16_t extraY = 0u;
+    uint16_t extraX = 0u;
+    uint16_t extraY = 0u;
 
-        for (uint8_t i = 0u; i < simd; i++) {
-            if (i > 0) {
-                extraX++;
-                if (extraX == xDelta) {
-                    extraX = 0u;
-                }
-                if ((i & xMask) == 0) {
-                    extraY++;
-                    if (y + extraY == localWorkgroupSize.at(1)) {
-                        extraY = 0;
-                        x += xDelta;
-                    }
-                }
+    for (uint8_t i = 0u; i < simd; i++) {
+        if (i > 0) {
+            extraX++;
+            if (extraX == xDelta) {
+                extraX = 0u;
             }
-            if (x == localWorkgroupSize.at(0)) {
-                x = 0u;
-                y += yDelta;
-                if (y >= localWorkgroupSize.at(1)) {
-                    y = 0u;
+            if ((i & xMask) == 0) {
+                extraY++;
+                if (y + extraY == localWorkgroupSize.at(1)) {
+                    extraY = 0;
+                    x += xDelta;
                 }
             }
-            rowX[i] = x + extraX;
-            rowY[i] = y + extraY;
-            rowZ[i] = 0u;
         }
-        x += xDelta;
-        offset += 3 * rowWidth;
+        if (x == localWorkgroupSize.at(0)) {
+            x = 0u;
+            y += yDelta;
+            if (y >= localWorkgroupSize.at(1)) {
+                y = 0u;
+            }
+        }
+        rowX[i] = x + extraX;
+        rowY[i] = y + extraY;
+        rowZ[i] = 0u;
     }
 }
 } // namespace OCLRT
@@ -50,6 +50,9 @@ struct LocalIDHelper {
     static void (*generateSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
     static void (*generateSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
     static void (*generateSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
+    static void (*generateWithLayoutForImagesSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize);
+    static void (*generateWithLayoutForImagesSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize);
+    static void (*generateWithLayoutForImagesSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize);
 
     static LocalIDHelper initializer;
 
@@ -58,14 +61,21 @@ struct LocalIDHelper {
 };
 
 extern const uint16_t initialLocalID[];
+extern const uint16_t initialLocalIDForImagesX[2][32];
+extern const uint16_t initialLocalIDForImagesY[2][32];
 
 template <typename Vec, int simd>
 void generateLocalIDsSimd(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
                           const std::array<uint8_t, 3> &dimensionsOrder);
 
+template <typename Vec, int simd>
+void generateLocalIDsWithLayoutForImagesSimd(void *b, const std::array<uint16_t, 3> &localWorkgroupSize);
+
 void generateLocalIDs(void *buffer, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
                       const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel);
 void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd);
+void generateLocalIDsWithLayoutForImagesGrf(uint16_t *rowX, uint16_t *rowY, uint16_t *rowZ, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                            uint16_t simd, uint16_t &x, uint16_t &y, uint16_t yDelta);
 
 bool isCompatibleWithLayoutForImages(const std::array<uint16_t, 3> &localWorkgroupSize, const std::array<uint8_t, 3> &dimensionsOrder, uint16_t simd);
 } // namespace OCLRT
\ No newline at end of file
@@ -149,4 +149,54 @@ inline void generateLocalIDsSimd(void *b, const std::array<uint16_t, 3> &localWo
 
     } while (++pass < passes);
 }
+
+template <typename Vec, int simd>
+inline void generateLocalIDsWithLayoutForImagesSimd(void *b, const std::array<uint16_t, 3> &localWorkgroupSize) {
+    const int passes = simd / Vec::numChannels;
+    const uint16_t rowWidth = simd == 32 ? 32 : 16;
+    const uint16_t xDelta = simd == 8 ? 2 : 4;                                                   // difference between corresponding values in consecutive X rows
+    const uint16_t yDelta = (simd == 8 || localWorkgroupSize[1] == 4u) ? 4u : rowWidth / xDelta; // difference between corresponding values in consecutive Y rows
+    const uint16_t yRowsPerGrf = simd / xDelta;
+
+    const auto &offsetsX = initialLocalIDForImagesX[simd == 8 ? 0 : 1];
+    const auto &offsetsY = initialLocalIDForImagesY[simd == 8 ? 0 : 1];
+
+    auto buffer = reinterpret_cast<uint16_t *>(b);
+    auto numGrfs = (localWorkgroupSize[0] * localWorkgroupSize[1] + (simd - 1)) / simd;
+    auto zero = Vec::zero();
+    uint16_t x = 0u;
+    uint16_t y = 0u;
+    for (auto grfId = 0; grfId < numGrfs; grfId++) {
+        auto rowX = buffer;
+        auto rowY = buffer + rowWidth;
+        auto rowZ = buffer + 2 * rowWidth;
+
+        if (x == localWorkgroupSize[0]) {
+            x = 0u;
+            y += yDelta;
+            if (y >= localWorkgroupSize[1]) {
+                y = 0u;
+            }
+        }
+
+        if (y + yRowsPerGrf <= localWorkgroupSize[1]) {
+            // No Y wrapping inside this GRF, so every lane is a fixed offset from (x, y)
+            const Vec vX(x);
+            const Vec vY(y);
+            for (int pass = 0; pass < passes; pass++) {
+                Vec laneX(&offsetsX[pass * Vec::numChannels]);
+                Vec laneY(&offsetsY[pass * Vec::numChannels]);
+                laneX += vX;
+                laneY += vY;
+                laneX.store(rowX + pass * Vec::numChannels);
+                laneY.store(rowY + pass * Vec::numChannels);
+                zero.store(rowZ + pass * Vec::numChannels);
+            }
+        } else {
+            generateLocalIDsWithLayoutForImagesGrf(rowX, rowY, rowZ, localWorkgroupSize, simd, x, y, yDelta);
+        }
+        x += xDelta;
+        buffer += 3 * rowWidth;
+    }
+}
 } // namespace OCLRT
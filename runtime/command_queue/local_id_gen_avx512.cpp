@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX512F__ && __AVX512BW__
+#include "runtime/command_queue/local_id_gen.inl"
+#include "runtime/helpers/uint16_avx512.h"
+
+#include <array>
+
+namespace OCLRT {
+template void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
+template void generateLocalIDsWithLayoutForImagesSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize);
+} // namespace OCLRT
+#endif
@@ -14,4 +14,7 @@ namespace OCLRT {
 template void generateLocalIDsSimd<uint16x8_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
 template void generateLocalIDsSimd<uint16x8_t, 16>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
 template void generateLocalIDsSimd<uint16x8_t, 8>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
+template void generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize);
+template void generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 16>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize);
+template void generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 8>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize);
 } // namespace OCLRT
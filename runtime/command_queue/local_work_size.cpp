@@ -413,10 +413,37 @@ void computeWorkgroupSizeND(WorkSizeInfo wsInfo, size_t workGroupSize[3], const
     }
 }
 
+LocalWorkSizeCache::Key createLocalWorkSizeCacheKey(const DispatchInfo &dispatchInfo) {
+    auto kernel = dispatchInfo.getKernel();
+    auto executionEnvironment = kernel->getKernelInfo().patchInfo.executionEnvironment;
+    LocalWorkSizeCache::Key key;
+    key.gws = {{dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z}};
+    key.workDim = dispatchInfo.getDim();
+    key.simd = kernel->getKernelInfo().getMaxSimdSize();
+    key.maxWorkGroupSize = static_cast<uint32_t>(kernel->getDevice().getDeviceInfo().maxWorkGroupSize);
+    key.slmTotalSize = kernel->slmTotalSize;
+    key.hasBarriers = executionEnvironment != nullptr && executionEnvironment->HasBarriers != 0;
+    key.computeWorkSizeND = DebugManager.flags.EnableComputeWorkSizeND.get();
+    key.computeWorkSizeSquared = DebugManager.flags.EnableComputeWorkSizeSquared.get();
+    return key;
+}
+
 Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
     size_t workGroupSize[3] = {};
     if (dispatchInfo.getKernel() != nullptr) {
-        if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
+        auto localWorkSizeCache = DebugManager.flags.EnableLocalWorkSizeCache.get() ? &dispatchInfo.getKernel()->getLocalWorkSizeCache() : nullptr;
+        LocalWorkSizeCache::Key cacheKey;
+        Vec3<size_t> cachedWorkGroupSize = {0, 0, 0};
+        if (localWorkSizeCache) {
+            cacheKey = createLocalWorkSizeCacheKey(dispatchInfo);
+        }
+
+        bool cacheHit = localWorkSizeCache && localWorkSizeCache->findLocalWorkSize(cacheKey, cachedWorkGroupSize);
+        if (cacheHit) {
+            workGroupSize[0] = cachedWorkGroupSize.x;
+            workGroupSize[1] = cachedWorkGroupSize.y;
+            workGroupSize[2] = cachedWorkGroupSize.z;
+        } else if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
             WorkSizeInfo wsInfo(dispatchInfo);
             size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
             computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
@@ -432,6 +459,10 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
                 computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
             }
         }
+
+        if (localWorkSizeCache && !cacheHit) {
+            localWorkSizeCache->storeLocalWorkSize(cacheKey, {workGroupSize[0], workGroupSize[1], workGroupSize[2]});
+        }
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
             " Driver deduced LWS", workGroupSize[0], workGroupSize[1], workGroupSize[2]);
@@ -456,6 +487,12 @@ Vec3<size_t> generateWorkgroupsNumber(const DispatchInfo &dispatchInfo) {
     return generateWorkgroupsNumber(dispatchInfo.getGWS(), dispatchInfo.getLocalWorkgroupSize());
 }
 
+void overrideLocalWorkSize(DispatchInfo &dispatchInfo, const Vec3<size_t> &lws) {
+    dispatchInfo.setLWS(canonizeWorkgroup(lws));
+    dispatchInfo.setTotalNumberOfWorkgroups(canonizeWorkgroup(generateWorkgroupsNumber(dispatchInfo)));
+    dispatchInfo.setNumberOfWorkgroups(dispatchInfo.getTotalNumberOfWorkgroups());
+}
+
 Vec3<size_t> canonizeWorkgroup(Vec3<size_t> workgroup) {
     return ((workgroup.x > 0) ? Vec3<size_t>({workgroup.x, std::max(workgroup.y, static_cast<size_t>(1)), std::max(workgroup.z, static_cast<size_t>(1))})
                               : Vec3<size_t>(0, 0, 0));
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/recorded_command_list.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/command_stream/csr_definitions.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/memory_manager/internal_allocation_storage.h"
+#include "runtime/memory_manager/memory_manager.h"
+
+#include <cstring>
+
+namespace OCLRT {
+
+RecordedCommandList::RecordedCommandList(CommandQueue &commandQueue) : commandQueue(commandQueue) {
+    auto &commandStreamReceiver = commandQueue.getCommandStreamReceiver();
+    auto storageForAllocation = commandStreamReceiver.getInternalAllocationStorage();
+
+    auto requiredSize = defaultCommandBufferSize + CSRequirements::csOverfetchSize;
+    auto allocation = storageForAllocation->obtainReusableAllocation(requiredSize, false).release();
+    if (!allocation) {
+        allocation = commandStreamReceiver.getMemoryManager()->allocateGraphicsMemoryWithProperties({requiredSize, GraphicsAllocation::AllocationType::LINEAR_STREAM});
+    }
+    allocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    commandStream.reset(new LinearStream(allocation->getUnderlyingBuffer(), defaultCommandBufferSize));
+    commandStream->replaceGraphicsAllocation(allocation);
+
+    commandQueue.allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, defaultHeapSize, heaps[IndirectHeap::DYNAMIC_STATE]);
+    commandQueue.allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, defaultHeapSize, heaps[IndirectHeap::INDIRECT_OBJECT]);
+    commandQueue.allocateHeapMemory(IndirectHeap::SURFACE_STATE, defaultHeapSize, heaps[IndirectHeap::SURFACE_STATE]);
+}
+
+RecordedCommandList::~RecordedCommandList() {
+    auto storageForAllocations = commandQueue.getCommandStreamReceiver().getInternalAllocationStorage();
+    for (auto &heap : heaps) {
+        if (heap) {
+            storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(heap->getGraphicsAllocation()), REUSABLE_ALLOCATION);
+            delete heap;
+            heap = nullptr;
+        }
+    }
+    storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(commandStream->getGraphicsAllocation()), REUSABLE_ALLOCATION);
+
+    for (auto &dispatch : dispatches) {
+        dispatch.kernel->decRefInternal();
+    }
+}
+
+void RecordedCommandList::addDispatch(Kernel &kernel, size_t crossThreadDataOffset, size_t surfaceStatesOffset, bool hasSurfaceStates) {
+    kernel.incRefInternal();
+    dispatches.push_back({&kernel, crossThreadDataOffset, surfaceStatesOffset, kernel.slmTotalSize, hasSurfaceStates});
+}
+
+template <typename Visitor>
+bool RecordedCommandList::forEachArgumentSlot(const RecordedDispatch &dispatch, size_t surfaceStateSize, Visitor visitor) const {
+    auto &kernel = *dispatch.kernel;
+    auto crossThreadDataSize = kernel.getCrossThreadDataSize();
+    auto recordedCrossThreadData = ptrOffset(heaps[IndirectHeap::INDIRECT_OBJECT]->getCpuBase(), dispatch.crossThreadDataOffset);
+
+    auto visitCrossThreadDataSlot = [&](uint32_t offset, uint32_t size) {
+        if (offset == KernelArgInfo::undefinedOffset || offset + size > crossThreadDataSize) {
+            return true;
+        }
+        return visitor(ptrOffset(recordedCrossThreadData, offset), ptrOffset(kernel.getCrossThreadData(), offset), size);
+    };
+
+    for (auto &argInfo : kernel.getKernelInfo().kernelArgInfo) {
+        for (auto &patchInfo : argInfo.kernelArgPatchInfoVector) {
+            if (!visitCrossThreadDataSlot(patchInfo.crossthreadOffset, patchInfo.size)) {
+                return false;
+            }
+        }
+        const uint32_t metadataOffsets[] = {argInfo.offsetImgWidth, argInfo.offsetImgHeight, argInfo.offsetImgDepth,
+                                            argInfo.offsetChannelDataType, argInfo.offsetChannelOrder, argInfo.offsetArraySize,
+                                            argInfo.offsetNumSamples, argInfo.offsetNumMipLevels, argInfo.offsetBufferOffset,
+                                            argInfo.offsetSamplerSnapWa, argInfo.offsetSamplerAddressingMode, argInfo.offsetSamplerNormalizedCoords,
+                                            argInfo.offsetObjectId};
+        for (auto metadataOffset : metadataOffsets) {
+            if (!visitCrossThreadDataSlot(metadataOffset, sizeof(uint32_t))) {
+                return false;
+            }
+        }
+
+        if (dispatch.hasSurfaceStates && (argInfo.isBuffer || argInfo.isImage) &&
+            argInfo.offsetHeap + surfaceStateSize <= kernel.getSurfaceStateHeapSize()) {
+            auto recordedSurfaceStates = ptrOffset(heaps[IndirectHeap::SURFACE_STATE]->getCpuBase(), dispatch.surfaceStatesOffset);
+            if (!visitor(ptrOffset(recordedSurfaceStates, argInfo.offsetHeap),
+                         ptrOffset(kernel.getSurfaceStateHeap(), argInfo.offsetHeap), surfaceStateSize)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool RecordedCommandList::hasStaleKernelArguments(size_t surfaceStateSize) const {
+    for (auto &dispatch : dispatches) {
+        auto upToDate = forEachArgumentSlot(dispatch, surfaceStateSize, [](void *recorded, const void *current, size_t size) {
+            return memcmp(recorded, current, size) == 0;
+        });
+        if (!upToDate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RecordedCommandList::hasChangedLocalMemorySize() const {
+    for (auto &dispatch : dispatches) {
+        if (dispatch.kernel->slmTotalSize != dispatch.slmTotalSize) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t RecordedCommandList::patchKernelArguments(size_t surfaceStateSize) {
+    size_t patchedSlots = 0;
+    for (auto &dispatch : dispatches) {
+        forEachArgumentSlot(dispatch, surfaceStateSize, [&patchedSlots](void *recorded, const void *current, size_t size) {
+            if (memcmp(recorded, current, size) != 0) {
+                memcpy_s(recorded, size, current, size);
+                patchedSlots++;
+            }
+            return true;
+        });
+    }
+    return patchedSlots;
+}
+} // namespace OCLRT
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/command_stream/linear_stream.h"
+#include "runtime/indirect_heap/indirect_heap.h"
+#include "runtime/helpers/hw_info.h"
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/kernel/grf_config.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OCLRT {
+class CommandQueue;
+class Kernel;
+
+// Command list captured between CommandQueue::beginRecording and CommandQueue::endRecording.
+// Walkers are encoded once into a private command buffer and private DSH/IOH/SSH.
+// Replay jumps into the recorded command buffer with a second level MI_BATCH_BUFFER_START
+// and refreshes only kernel argument slots that changed since the previous submission.
+// Commands that can't be recorded are executed immediately and invalidate the list.
+class RecordedCommandList : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultCommandBufferSize = 64 * 1024;
+
+    struct RecordedDispatch {
+        Kernel *kernel;
+        size_t crossThreadDataOffset;
+        size_t surfaceStatesOffset;
+        uint32_t slmTotalSize;
+        bool hasSurfaceStates;
+    };
+
+    RecordedCommandList(CommandQueue &commandQueue);
+    ~RecordedCommandList();
+
+    CommandQueue &getCommandQueue() const { return commandQueue; }
+    LinearStream &getCommandStream() { return *commandStream; }
+    IndirectHeap &getIndirectHeap(IndirectHeap::Type heapType) { return *heaps[heapType]; }
+
+    void addDispatch(Kernel &kernel, size_t crossThreadDataOffset, size_t surfaceStatesOffset, bool hasSurfaceStates);
+    const std::vector<RecordedDispatch> &getDispatches() const { return dispatches; }
+
+    bool hasStaleKernelArguments(size_t surfaceStateSize) const;
+    // Recorded interface descriptors keep SLM size of recording time, local arguments resized since then are not patchable.
+    bool hasChangedLocalMemorySize() const;
+    size_t patchKernelArguments(size_t surfaceStateSize);
+
+    bool isValid() const { return valid; }
+    void invalidate() { valid = false; }
+
+    bool isClosed() const { return closed; }
+    void close() { closed = true; }
+
+    uint32_t peekLastTaskCount() const { return lastTaskCount; }
+    void setLastTaskCount(uint32_t taskCount) { lastTaskCount = taskCount; }
+
+    bool slmUsed = false;
+    bool requiresCoherency = false;
+    bool mediaSamplerRequired = false;
+    bool specialPipelineSelectMode = false;
+    uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    uint32_t requiredScratchSize = 0;
+    PreemptionMode preemptionMode = PreemptionMode::Disabled;
+
+  protected:
+    template <typename Visitor>
+    bool forEachArgumentSlot(const RecordedDispatch &dispatch, size_t surfaceStateSize, Visitor visitor) const;
+
+    CommandQueue &commandQueue;
+    std::unique_ptr<LinearStream> commandStream;
+    IndirectHeap *heaps[IndirectHeap::NUM_TYPES] = {};
+    std::vector<RecordedDispatch> dispatches;
+    uint32_t lastTaskCount = 0;
+    bool valid = true;
+    bool closed = false;
+};
+} // namespace OCLRT
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/transfer_coalescer.h"
+#include "runtime/mem_obj/buffer.h"
+
+#include "CL/cl.h"
+
+#include <limits>
+
+namespace OCLRT {
+constexpr size_t TransferCoalescer::maxTransferSize;
+constexpr size_t TransferCoalescer::maxTransfersCount;
+
+CoalescedTransfers::~CoalescedTransfers() {
+    if (srcBuffer) {
+        srcBuffer->decRefInternal();
+    }
+    if (dstBuffer) {
+        dstBuffer->decRefInternal();
+    }
+}
+
+bool TransferCoalescer::isCopyCoalescable(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size) {
+    // source is never written by the batch only when buffers do not share storage
+    if (size == 0 || size > maxTransferSize || srcBuffer->getGraphicsAllocation() == dstBuffer->getGraphicsAllocation()) {
+        return false;
+    }
+    constexpr size_t maxOffset = std::numeric_limits<uint32_t>::max() - maxTransferSize;
+    return srcOffset <= maxOffset && dstOffset <= maxOffset;
+}
+
+bool TransferCoalescer::isFillCoalescable(size_t patternSize, size_t offset, size_t size) {
+    if (size == 0 || size > maxTransferSize || patternSize == 0) {
+        return false;
+    }
+    constexpr size_t maxOffset = std::numeric_limits<uint32_t>::max() - maxTransferSize;
+    return offset <= maxOffset;
+}
+
+bool TransferCoalescer::addCopy(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!isCompatible(CL_COMMAND_COPY_BUFFER, srcBuffer, dstBuffer, dstOffset, size)) {
+        return false;
+    }
+    addTransfer(CL_COMMAND_COPY_BUFFER, srcBuffer, dstBuffer, srcOffset, dstOffset, 0, size);
+    return true;
+}
+
+bool TransferCoalescer::addFill(Buffer *dstBuffer, const void *pattern, size_t patternSize, size_t offset, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!isCompatible(CL_COMMAND_FILL_BUFFER, nullptr, dstBuffer, offset, size)) {
+        return false;
+    }
+    auto patternOffset = pending ? pending->patterns.size() : 0u;
+    addTransfer(CL_COMMAND_FILL_BUFFER, nullptr, dstBuffer, patternOffset, offset, patternSize, size);
+    auto patternBytes = reinterpret_cast<const uint8_t *>(pattern);
+    pending->patterns.insert(pending->patterns.end(), patternBytes, patternBytes + patternSize);
+    return true;
+}
+
+bool TransferCoalescer::isEmpty() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pending == nullptr;
+}
+
+bool TransferCoalescer::isFull() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pending && pending->descriptors.size() >= maxTransfersCount;
+}
+
+std::unique_ptr<CoalescedTransfers> TransferCoalescer::takePending() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return std::move(pending);
+}
+
+bool TransferCoalescer::isCompatible(uint32_t commandType, Buffer *srcBuffer, Buffer *dstBuffer, size_t dstOffset, size_t size) const {
+    if (!pending) {
+        return true;
+    }
+    if (pending->commandType != commandType || pending->srcBuffer != srcBuffer || pending->dstBuffer != dstBuffer ||
+        pending->descriptors.size() >= maxTransfersCount) {
+        return false;
+    }
+
+    // work items of a single walker run in any order, writes must not overlap
+    auto &descriptors = pending->descriptors;
+    for (size_t i = 0; i < descriptors.size(); i++) {
+        auto descriptorEnd = (i + 1 < descriptors.size()) ? descriptors[i + 1].firstWorkItem : pending->workItemsCount;
+        auto descriptorSize = descriptorEnd - descriptors[i].firstWorkItem;
+        if (dstOffset < descriptors[i].dstOffset + descriptorSize && descriptors[i].dstOffset < dstOffset + size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TransferCoalescer::addTransfer(uint32_t commandType, Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t patternSize, size_t size) {
+    if (!pending) {
+        pending = std::make_unique<CoalescedTransfers>();
+        pending->commandType = commandType;
+        pending->srcBuffer = srcBuffer;
+        pending->dstBuffer = dstBuffer;
+        if (srcBuffer) {
+            srcBuffer->incRefInternal();
+        }
+        dstBuffer->incRefInternal();
+    }
+    pending->descriptors.push_back({static_cast<uint32_t>(srcOffset), static_cast<uint32_t>(dstOffset),
+                                    static_cast<uint32_t>(patternSize), pending->workItemsCount});
+    pending->workItemsCount += static_cast<uint32_t>(size);
+}
+} // namespace OCLRT
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class Buffer;
+
+// Layout shared with CopyBufferToBufferScatter and FillBufferScatter builtins
+struct TransferDescriptor {
+    uint32_t srcOffset;
+    uint32_t dstOffset;
+    uint32_t patternSize;
+    uint32_t firstWorkItem;
+};
+static_assert(sizeof(TransferDescriptor) == 4 * sizeof(uint32_t), "TransferDescriptor has to match uint4");
+
+struct CoalescedTransfers {
+    ~CoalescedTransfers();
+
+    uint32_t commandType = 0;
+    Buffer *srcBuffer = nullptr;
+    Buffer *dstBuffer = nullptr;
+    std::vector<TransferDescriptor> descriptors;
+    std::vector<uint8_t> patterns;
+    uint32_t workItemsCount = 0;
+};
+
+// Gathers small copy or fill buffer enqueues without dependencies, so they can be
+// submitted as a single scatter walker instead of a walker per enqueue.
+// Transfers are batched only when they target the same buffers and disjoint destination ranges.
+class TransferCoalescer {
+  public:
+    static constexpr size_t maxTransferSize = 64 * 1024;
+    static constexpr size_t maxTransfersCount = 64;
+
+    static bool isCopyCoalescable(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size);
+    static bool isFillCoalescable(size_t patternSize, size_t offset, size_t size);
+
+    bool addCopy(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size);
+    bool addFill(Buffer *dstBuffer, const void *pattern, size_t patternSize, size_t offset, size_t size);
+
+    bool isEmpty() const;
+    bool isFull() const;
+    std::unique_ptr<CoalescedTransfers> takePending();
+
+  protected:
+    bool isCompatible(uint32_t commandType, Buffer *srcBuffer, Buffer *dstBuffer, size_t dstOffset, size_t size) const;
+    void addTransfer(uint32_t commandType, Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t patternSize, size_t size);
+
+    std::unique_ptr<CoalescedTransfers> pending;
+    mutable std::mutex mtx;
+};
+} // namespace OCLRT
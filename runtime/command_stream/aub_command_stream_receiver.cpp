@@ -7,10 +7,13 @@
 
 #include "runtime/command_stream/aub_command_stream_receiver.h"
 #include "runtime/helpers/debug_helpers.h"
+#include "runtime/helpers/hash.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/options.h"
+#include "runtime/memory_manager/memory_constants.h"
 #include "runtime/memory_manager/os_agnostic_memory_manager.h"
 #include "runtime/os_interface/os_inc_base.h"
+#include "runtime/utilities/async_file_writer.h"
 #include <algorithm>
 #include <cstring>
 #include <sstream>
@@ -67,21 +70,41 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::AubFileStream() = default;
+
+AubFileStream::~AubFileStream() = default;
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    auto asyncWriteBufferSize = OCLRT::DebugManager.flags.AUBDumpAsyncWriteBufferSize.get();
+    if (asyncWriteBufferSize > 0 && fileHandle.is_open()) {
+        auto chunksCount = static_cast<size_t>(asyncWriteBufferSize * MemoryConstants::megaByte / OCLRT::AsyncFileWriter::defaultChunkSize);
+        asyncWriter = std::make_unique<OCLRT::AsyncFileWriter>(fileHandle, OCLRT::AsyncFileWriter::defaultChunkSize, chunksCount);
+    }
 }
 
 void AubFileStream::close() {
+    asyncWriter.reset();
     fileHandle.close();
     fileName.clear();
+    dumpedPages.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriter) {
+        asyncWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriter) {
+        asyncWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -111,6 +134,25 @@ bool AubFileStream::init(uint32_t stepping, uint32_t device) {
 }
 
 void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) {
+    auto bytes = reinterpret_cast<const char *>(memory);
+    // memory equal to itself shifted by one dword is single dword repeated, e.g. zeroed page
+    if (OCLRT::DebugManager.flags.AUBDumpCompactUniformMemory.get() && size > sizeof(uint32_t) && size % sizeof(uint32_t) == 0 &&
+        memcmp(bytes, bytes + sizeof(uint32_t), size - sizeof(uint32_t)) == 0) {
+        CmdServicesMemTraceMemoryWrite header = {};
+        header.setHeader();
+        header.dwordCount = static_cast<uint32_t>((sizeMemoryWriteHeader + sizeof(uint32_t)) / sizeof(uint32_t) - 1);
+        header.address = physAddress;
+        header.repeatMemory = CmdServicesMemTraceMemoryWrite::RepeatMemoryValues::Repeat;
+        header.tiling = CmdServicesMemTraceMemoryWrite::TilingValues::NoTiling;
+        header.dataTypeHint = hint;
+        header.addressSpace = addressSpace;
+        header.dataSizeInBytes = static_cast<uint32_t>(size);
+
+        write(reinterpret_cast<const char *>(&header), sizeMemoryWriteHeader);
+        write(bytes, sizeof(uint32_t));
+        return;
+    }
+
     writeMemoryWriteHeader(physAddress, size, addressSpace, hint);
 
     // Copy the contents from source to destination.
@@ -259,4 +301,51 @@ std::unique_lock<std::mutex> AubFileStream::lockStream() {
     return std::unique_lock<std::mutex>(mutex);
 }
 
+AubFileStream::PageDumpState AubFileStream::trackPageWrite(uint64_t gpuAddress, uint64_t physAddress, uint64_t entryBits, const void *memory, size_t size) {
+    auto contentHash = OCLRT::Hash::hash(reinterpret_cast<const char *>(memory), size);
+    DumpedPage writtenPage = {physAddress, entryBits, size, contentHash};
+
+    auto dumpedPage = dumpedPages.find(gpuAddress & ~(MemoryConstants::pageSize - 1));
+    if (dumpedPage == dumpedPages.end()) {
+        dumpedPages.emplace(gpuAddress & ~(MemoryConstants::pageSize - 1), writtenPage);
+        return PageDumpState::NotDumped;
+    }
+
+    auto state = PageDumpState::NotDumped;
+    if ((dumpedPage->second.physAddress & ~(MemoryConstants::pageSize - 1)) == (physAddress & ~(MemoryConstants::pageSize - 1)) &&
+        dumpedPage->second.entryBits == entryBits) {
+        state = PageDumpState::EntryDumped;
+        // only last region written to page is remembered, other regions are dumped again
+        if (dumpedPage->second.physAddress == physAddress && dumpedPage->second.size == size && dumpedPage->second.contentHash == contentHash) {
+            state = PageDumpState::EntryAndContentDumped;
+        }
+    }
+    dumpedPage->second = writtenPage;
+    return state;
+}
+
+void AubFileStream::invalidateDumpedPages(uint64_t gpuAddress, size_t size) {
+    if (dumpedPages.empty() || size == 0) {
+        return;
+    }
+    auto page = gpuAddress & ~(MemoryConstants::pageSize - 1);
+    for (; page < gpuAddress + size; page += MemoryConstants::pageSize) {
+        dumpedPages.erase(page);
+    }
+}
+
+void AubFileStream::invalidateDumpedContent(uint64_t gpuAddress, size_t size) {
+    if (dumpedPages.empty() || size == 0) {
+        return;
+    }
+    auto page = gpuAddress & ~(MemoryConstants::pageSize - 1);
+    for (; page < gpuAddress + size; page += MemoryConstants::pageSize) {
+        auto dumpedPage = dumpedPages.find(page);
+        if (dumpedPage != dumpedPages.end()) {
+            // no written region has zero size, content is never matched
+            dumpedPage->second.size = 0;
+        }
+    }
+}
+
 } // namespace AubMemDump
@@ -25,6 +25,7 @@
 #include "runtime/memory_manager/memory_banks.h"
 #include "runtime/memory_manager/memory_constants.h"
 #include "runtime/memory_manager/os_agnostic_memory_manager.h"
+#include "runtime/memory_manager/sparse_page_table.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_context.h"
 #include "driver_version.h"
@@ -53,8 +54,8 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const Hardware
     auto physicalAddressAllocator = aubCenter->getPhysicalAddressAllocator();
     UNRECOVERABLE_IF(nullptr == physicalAddressAllocator);
 
-    ppgtt = std::make_unique<std::conditional<is64bit, PML4, PDPE>::type>(physicalAddressAllocator);
-    ggtt = std::make_unique<PDPE>(physicalAddressAllocator);
+    ppgtt = std::make_unique<SparsePPGTT>(physicalAddressAllocator);
+    ggtt = std::make_unique<SparseGGTT>(physicalAddressAllocator);
 
     gttRemap = aubCenter->getAddressMapper();
     UNRECOVERABLE_IF(nullptr == gttRemap);
@@ -342,6 +343,22 @@ FlushStamp AUBCommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batchBuffer
 
     submitBatchBuffer(batchBufferGpuAddress, pBatchBuffer, sizeBatchBuffer, this->getMemoryBank(batchBuffer.commandBufferAllocation), this->getPPGTTAdditionalBits(batchBuffer.commandBufferAllocation));
 
+    if (DebugManager.flags.AUBDumpIncrementalResidency.get()) {
+        // simulated GPU may change memory it can write, content hashed on its last dump no longer matches it
+        for (auto &externalAllocation : externalAllocations) {
+            getAubStream()->invalidateDumpedContent(externalAllocation.first, externalAllocation.second);
+        }
+        for (auto &gfxAllocation : allocationsForResidency) {
+            if (AubHelper::isGpuWritableAllocationType(gfxAllocation->getAllocationType())) {
+                auto size = gfxAllocation->getUnderlyingBufferSize();
+                if (gfxAllocation->gmm && gfxAllocation->gmm->isRenderCompressed) {
+                    size = gfxAllocation->gmm->gmmResourceInfo->getSizeAllocation();
+                }
+                getAubStream()->invalidateDumpedContent(GmmHelper::decanonize(gfxAllocation->getGpuAddress()), size);
+            }
+        }
+    }
+
     if (!DebugManager.flags.AUBDumpConcurrentCS.get()) {
         pollForCompletion();
     }
@@ -421,6 +438,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::submitBatchBuffer(uint64_t batchBuff
         }
 
         auto physBatchBuffer = ppgtt->map(static_cast<uintptr_t>(batchBufferGpuAddress), batchBufferSize, entryBits, memoryBank);
+        getAubStream()->invalidateDumpedPages(batchBufferGpuAddress, batchBufferSize);
         AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
         AUB::reserveAddressPPGTT(*stream, static_cast<uintptr_t>(batchBufferGpuAddress), batchBufferSize, physBatchBuffer,
                                  entryBits, aubHelperHw);
@@ -614,7 +632,20 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
 
+    bool incrementalResidency = DebugManager.flags.AUBDumpIncrementalResidency.get();
+
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (incrementalResidency) {
+            auto pageCpuAddress = ptrOffset(cpuAddress, offset);
+            auto state = getAubStream()->trackPageWrite(gpuAddress + offset, physAddress, entryBits, pageCpuAddress, size);
+            if (state == AubMemDump::AubFileStream::PageDumpState::EntryAndContentDumped) {
+                return;
+            }
+            if (state == AubMemDump::AubFileStream::PageDumpState::EntryDumped) {
+                AUB::addMemoryWrite(*stream, physAddress, pageCpuAddress, size, AubHelper::getMemTrace(entryBits));
+                return;
+            }
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -673,7 +704,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::expectMMIO(uint32_t mmioRegister, ui
     header.readMaskHigh = 0xffffffff;
     header.dwordCount = (sizeof(header) / sizeof(uint32_t)) - 1;
 
-    this->getAubStream()->fileHandle.write(reinterpret_cast<char *>(&header), sizeof(header));
+    this->getAubStream()->write(reinterpret_cast<char *>(&header), sizeof(header));
 }
 
 template <typename GfxFamily>
@@ -820,6 +851,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::addGUCStartMessage(uint64_t batchBuf
     auto physBufferAddres = ppgtt->map(reinterpret_cast<uintptr_t>(buffer.get()), bufferSize,
                                        this->getPPGTTAdditionalBits(linearStream.getGraphicsAllocation()),
                                        MemoryBanks::MainBank);
+    getAubStream()->invalidateDumpedPages(reinterpret_cast<uintptr_t>(buffer.get()), bufferSize);
 
     AUB::reserveAddressPPGTT(*stream, reinterpret_cast<uintptr_t>(buffer.get()), bufferSize, physBufferAddres,
                              this->getPPGTTAdditionalBits(linearStream.getGraphicsAllocation()),
@@ -22,6 +22,7 @@
 
 namespace OCLRT {
 class AllocationsList;
+struct BlitProperties;
 class Device;
 class EventBuilder;
 class ExecutionEnvironment;
@@ -70,6 +71,8 @@ class CommandStreamReceiver {
 
     virtual void flushBatchedSubmissions() = 0;
 
+    virtual uint32_t blitBuffer(const BlitProperties &blitProperties) = 0;
+
     virtual void makeCoherent(GraphicsAllocation &gfxAllocation){};
     virtual void makeResident(GraphicsAllocation &gfxAllocation);
     virtual void makeNonResident(GraphicsAllocation &gfxAllocation);
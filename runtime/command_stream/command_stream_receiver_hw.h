@@ -36,6 +36,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     void flushBatchedSubmissions() override;
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties) override;
+
     void addPipeControl(LinearStream &commandStream, bool dcFlush) override;
     int getRequiredPipeControlSize() const;
 
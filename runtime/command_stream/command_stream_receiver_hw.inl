@@ -11,7 +11,9 @@
 #include "runtime/command_stream/scratch_space_controller_base.h"
 #include "runtime/device/device.h"
 #include "runtime/event/event.h"
+#include "runtime/event/event_tracker.h"
 #include "runtime/gtpin/gtpin_notify.h"
+#include "runtime/helpers/blit_commands_helper.inl"
 #include "runtime/helpers/cache_policy.h"
 #include "runtime/helpers/flat_batch_buffer_helper_hw.h"
 #include "runtime/helpers/flush_stamp.h"
@@ -25,9 +27,11 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_context.h"
+#include "runtime/utilities/metrics_registry.h"
 #include "runtime/command_stream/preemption.h"
 #include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/trace_recorder.h"
 
 namespace OCLRT {
 
@@ -157,6 +161,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     DEBUG_BREAK_IF(taskLevel >= Event::eventNotReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
+    TRACE_SCOPE(FlushTask, __FUNCTION__, taskLevel);
 
     auto levelClosed = false;
     void *currentPipeControlForNooping = nullptr;
@@ -447,8 +452,13 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     if (submitCSR | submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+            MetricsRegistry::increment(MetricCounter::Flushes);
+            MetricsRegistry::record(MetricHistogram::ResidencyListSize, this->getResidencyAllocations().size());
             flushStamp->setStamp(this->flush(batchBuffer, this->getResidencyAllocations()));
             this->latestFlushedTaskCount = this->taskCount + 1;
+            if (DebugManager.flags.EventsTrackerEnable.get()) {
+                EventsTracker::getEventsTracker().notifyFlush(this, this->latestFlushedTaskCount);
+            }
             this->makeSurfacePackNonResident(this->getResidencyAllocations());
         } else {
             auto commandBuffer = new CommandBuffer(device);
@@ -565,6 +575,8 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             if (epiloguePipeControlLocation) {
                 ((PIPE_CONTROL *)epiloguePipeControlLocation)->setDcFlushEnable(true);
             }
+            MetricsRegistry::increment(MetricCounter::Flushes);
+            MetricsRegistry::record(MetricHistogram::ResidencyListSize, surfacesForSubmit.size());
             auto flushStamp = this->flush(primaryCmdBuffer->batchBuffer, surfacesForSubmit);
 
             //after flush task level is closed
@@ -573,6 +585,9 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             flushStampUpdateHelper.updateAll(flushStamp);
 
             this->latestFlushedTaskCount = lastTaskCount;
+            if (DebugManager.flags.EventsTrackerEnable.get()) {
+                EventsTracker::getEventsTracker().notifyFlush(this, this->latestFlushedTaskCount);
+            }
             this->flushStamp->setStamp(flushStamp);
             this->makeSurfacePackNonResident(surfacesForSubmit);
             resourcePackage.clear();
@@ -802,6 +817,55 @@ void CommandStreamReceiverHw<GfxFamily>::handleEventsTimestampPacketTags(LinearS
     }
 }
 
+template <typename GfxFamily>
+uint32_t CommandStreamReceiverHw<GfxFamily>::blitBuffer(const BlitProperties &blitProperties) {
+    auto lock = obtainUniqueOwnership();
+
+    auto &commandStream = getCS(BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties));
+    auto commandStreamStart = commandStream.getUsed();
+    auto newTaskCount = taskCount + 1;
+    latestSentTaskCount = newTaskCount;
+
+    for (auto timestampPacketContainer : blitProperties.timestampPacketDependencies) {
+        for (auto &node : timestampPacketContainer->peekNodes()) {
+            TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(commandStream, *node->tag);
+        }
+        timestampPacketContainer->makeResident(*this);
+    }
+
+    BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(blitProperties, commandStream);
+
+    // qword post-sync write clears both ContextEnd and GlobalEnd of the packet
+    for (auto &node : blitProperties.outputTimestampPacket->peekNodes()) {
+        BlitCommandsHelper<GfxFamily>::programMiFlushDw(commandStream, node->tag->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd), 0);
+    }
+    blitProperties.outputTimestampPacket->makeResident(*this);
+
+    BlitCommandsHelper<GfxFamily>::programMiFlushDw(commandStream, tagAllocation->getGpuAddress(), newTaskCount);
+
+    addBatchBufferEnd(commandStream, nullptr);
+    alignToCacheLine(commandStream);
+
+    makeResident(*blitProperties.srcAllocation);
+    makeResident(*blitProperties.dstAllocation);
+    makeResident(*tagAllocation);
+
+    BatchBuffer batchBuffer{commandStream.getGraphicsAllocation(), commandStreamStart, 0, nullptr, false, false, QueueThrottle::MEDIUM, commandStream.getUsed(), &commandStream};
+
+    MetricsRegistry::increment(MetricCounter::Flushes);
+    MetricsRegistry::record(MetricHistogram::ResidencyListSize, getResidencyAllocations().size());
+    flushStamp->setStamp(flush(batchBuffer, getResidencyAllocations()));
+    makeSurfacePackNonResident(getResidencyAllocations());
+
+    taskCount = newTaskCount;
+    latestFlushedTaskCount = newTaskCount;
+    if (DebugManager.flags.EventsTrackerEnable.get()) {
+        EventsTracker::getEventsTracker().notifyFlush(this, latestFlushedTaskCount);
+    }
+
+    return newTaskCount;
+}
+
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::createScratchSpaceController(const HardwareInfo &hwInfoIn) {
     scratchSpaceController = std::make_unique<ScratchSpaceControllerBase>(hwInfoIn, executionEnvironment, *internalAllocationStorage.get());
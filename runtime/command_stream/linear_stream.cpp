@@ -9,13 +9,14 @@
 #include "runtime/memory_manager/graphics_allocation.h"
 
 namespace OCLRT {
+std::atomic<uint64_t> LinearStream::bufferIdCounter{0};
 
 LinearStream::LinearStream(void *buffer, size_t bufferSize)
-    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(nullptr) {
+    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(nullptr), bufferId(++bufferIdCounter) {
 }
 
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation)
-    : sizeUsed(0), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), graphicsAllocation(gfxAllocation), bufferId(++bufferIdCounter) {
     if (gfxAllocation) {
         maxAvailableSpace = gfxAllocation->getUnderlyingBufferSize();
         buffer = gfxAllocation->getUnderlyingBuffer();
@@ -8,6 +8,7 @@
 #pragma once
 #include "runtime/helpers/debug_helpers.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/utilities/object_pool.h"
 #include <cstddef>
 #include <cstdint>
 #include <atomic>
@@ -21,6 +22,10 @@ class LinearStream {
     LinearStream();
     LinearStream(void *buffer, size_t bufferSize);
     LinearStream(GraphicsAllocation *buffer);
+
+    static void *operator new(size_t size) { return PooledObjects::allocate(size); }
+    static void operator delete(void *ptr) { PooledObjects::free(ptr); }
+
     void *getCpuBase() const;
     void *getSpace(size_t size);
     size_t getMaxAvailableSpace() const;
@@ -30,6 +35,8 @@ class LinearStream {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    // unique for every buffer assigned to any stream, data below getUsed() is stable while it does not change
+    uint64_t getBufferId() const { return bufferId; }
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -42,6 +49,9 @@ class LinearStream {
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+    uint64_t bufferId;
+
+    static std::atomic<uint64_t> bufferIdCounter;
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -76,6 +86,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferId = ++bufferIdCounter;
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
@@ -18,6 +18,7 @@
 #include "runtime/memory_manager/memory_banks.h"
 #include "runtime/memory_manager/memory_constants.h"
 #include "runtime/memory_manager/physical_address_allocator.h"
+#include "runtime/memory_manager/sparse_page_table.h"
 #include "runtime/command_stream/command_stream_receiver_with_aub_dump.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_context.h"
@@ -37,8 +38,8 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(const Hardware
 
     aubManager = aubCenter->getAubManager();
 
-    ppgtt = std::make_unique<std::conditional<is64bit, PML4, PDPE>::type>(physicalAddressAllocator.get());
-    ggtt = std::make_unique<PDPE>(physicalAddressAllocator.get());
+    ppgtt = std::make_unique<SparsePPGTT>(physicalAddressAllocator.get());
+    ggtt = std::make_unique<SparseGGTT>(physicalAddressAllocator.get());
 
     for (auto &engineInfo : engineInfoTable) {
         engineInfo.pLRCA = nullptr;
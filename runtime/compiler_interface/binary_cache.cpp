@@ -52,10 +52,14 @@ const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, con
     return stream.str();
 }
 
-BinaryCache::BinaryCache() {
+std::string BinaryCache::getCacheLocation() {
     std::string keyName = "cl_cache_dir";
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(keyName));
-    clCacheLocation = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
+    return settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
+}
+
+BinaryCache::BinaryCache() {
+    clCacheLocation = getCacheLocation();
 };
 
 BinaryCache::~BinaryCache(){};
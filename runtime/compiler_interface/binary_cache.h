@@ -21,6 +21,7 @@ class BinaryCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    static std::string getCacheLocation();
     BinaryCache();
     virtual ~BinaryCache();
     virtual bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
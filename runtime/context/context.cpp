@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "runtime/helpers/surface_formats.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
+#include "runtime/mem_obj/buffer_suballocator.h"
 #include "runtime/mem_obj/image.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/get_info.h"
@@ -53,6 +54,7 @@ Context::~Context() {
     if (svmAllocsManager) {
         delete svmAllocsManager;
     }
+    bufferSuballocator.reset();
     if (driverDiagnostics) {
         delete driverDiagnostics;
     }
@@ -65,6 +67,13 @@ Context::~Context() {
     }
 }
 
+BufferSuballocator &Context::getBufferSuballocator() {
+    std::call_once(bufferSuballocatorCreated, [this]() {
+        bufferSuballocator.reset(new BufferSuballocator(*memoryManager));
+    });
+    return *bufferSuballocator;
+}
+
 DeviceQueue *Context::getDefaultDeviceQueue() {
     return defaultDeviceQueue;
 }
@@ -11,10 +11,13 @@
 #include "runtime/context/driver_diagnostics.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace OCLRT {
 
+class BufferSuballocator;
 class CommandQueue;
 class Device;
 class DeviceQueue;
@@ -75,6 +78,8 @@ class Context : public BaseObject<_cl_context> {
         return svmAllocsManager;
     }
 
+    BufferSuballocator &getBufferSuballocator();
+
     DeviceQueue *getDefaultDeviceQueue();
     void setDefaultDeviceQueue(DeviceQueue *queue);
 
@@ -130,6 +135,8 @@ class Context : public BaseObject<_cl_context> {
     DeviceVector devices;
     MemoryManager *memoryManager;
     SVMAllocsManager *svmAllocsManager = nullptr;
+    std::unique_ptr<BufferSuballocator> bufferSuballocator;
+    std::once_flag bufferSuballocatorCreated;
     CommandQueue *specialQueue;
     DeviceQueue *defaultDeviceQueue;
     std::vector<std::unique_ptr<SharingFunctions>> sharingFunctions;
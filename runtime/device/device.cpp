@@ -164,23 +164,26 @@ bool Device::createDeviceImpl(const HardwareInfo *pHwInfo, Device &outDevice) {
 bool Device::createEngines(const HardwareInfo *pHwInfo, Device &outDevice) {
     auto executionEnvironment = outDevice.executionEnvironment;
     auto defaultEngineType = getChosenEngineType(*pHwInfo);
-    auto &gpgpuEngines = HwHelper::get(pHwInfo->pPlatform->eRenderCoreFamily).getGpgpuEngineInstances();
+    std::vector<EngineInstanceT> engineInstances = HwHelper::get(pHwInfo->pPlatform->eRenderCoreFamily).getGpgpuEngineInstances();
+    if (DebugManager.flags.EnableBlitterOperationsSupport.get()) {
+        engineInstances.push_back({ENGINE_BCS});
+    }
 
-    for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
+    for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < engineInstances.size(); deviceCsrIndex++) {
         if (!executionEnvironment->initializeCommandStreamReceiver(pHwInfo, outDevice.getDeviceIndex(), deviceCsrIndex)) {
             return false;
         }
         executionEnvironment->initializeMemoryManager(outDevice.getEnabled64kbPages(), outDevice.getEnableLocalMemory(),
                                                       outDevice.getDeviceIndex(), deviceCsrIndex);
 
-        auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(gpgpuEngines[deviceCsrIndex], outDevice.preemptionMode);
+        auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(engineInstances[deviceCsrIndex], outDevice.preemptionMode);
         auto commandStreamReceiver = executionEnvironment->commandStreamReceivers[outDevice.getDeviceIndex()][deviceCsrIndex].get();
         commandStreamReceiver->setupContext(*osContext);
         if (!commandStreamReceiver->initializeTagAllocation()) {
             return false;
         }
 
-        if (gpgpuEngines[deviceCsrIndex].type == defaultEngineType && gpgpuEngines[deviceCsrIndex].id == 0) {
+        if (engineInstances[deviceCsrIndex].type == defaultEngineType && engineInstances[deviceCsrIndex].id == 0) {
             outDevice.defaultEngineIndex = deviceCsrIndex;
         }
 
@@ -268,6 +271,15 @@ bool Device::isSourceLevelDebuggerActive() const {
     return deviceInfo.sourceLevelDebuggerActive;
 }
 
+EngineControl *Device::getBlitterEngine() {
+    for (auto &engine : engines) {
+        if (engine.osContext && engine.osContext->getEngineType().type == ENGINE_BCS) {
+            return &engine;
+        }
+    }
+    return nullptr;
+}
+
 void Device::initMaxPowerSavingMode() {
     for (auto &engine : engines) {
         engine.commandStreamReceiver->peekKmdNotifyHelper()->initMaxPowerSavingMode();
@@ -9,6 +9,7 @@
 #include "engine_node.h"
 #include "runtime/api/cl_types.h"
 #include "runtime/device/device_info_map.h"
+#include "runtime/event/gpu_timeline.h"
 #include "runtime/execution_environment/execution_environment.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/engine_control.h"
@@ -72,6 +73,7 @@ class Device : public BaseObject<_cl_device_id> {
 
     EngineControl &getEngine(uint32_t engineId);
     EngineControl &getDefaultEngine();
+    EngineControl *getBlitterEngine();
 
     const char *getProductAbbrev() const;
     const std::string getFamilyNameWithType() const;
@@ -94,6 +96,7 @@ class Device : public BaseObject<_cl_device_id> {
     void retain() override;
     unique_ptr_if_unused<Device> release() override;
     OSTime *getOSTime() const { return osTime.get(); };
+    GpuTimeline &getGpuTimeline() { return gpuTimeline; }
     double getProfilingTimerResolution();
     unsigned int getEnabledClVersion() const { return enabledClVersion; };
     unsigned int getSupportedClVersion() const;
@@ -148,6 +151,7 @@ class Device : public BaseObject<_cl_device_id> {
 
     GraphicsAllocation *preemptionAllocation = nullptr;
     std::unique_ptr<OSTime> osTime;
+    GpuTimeline gpuTimeline;
     std::unique_ptr<DriverInfo> driverInfo;
     std::unique_ptr<PerformanceCounters> performanceCounters;
 
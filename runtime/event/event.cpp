@@ -14,17 +14,22 @@
 #include "runtime/event/event.h"
 #include "runtime/event/event_tracker.h"
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/cl_helper.h"
 #include "runtime/helpers/get_info.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/api/cl_types.h"
 #include "runtime/mem_obj/mem_obj.h"
+#include "runtime/os_interface/os_context.h"
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/trace_recorder.h"
 #include "runtime/platform/platform.h"
 #include "runtime/event/async_events_handler.h"
 
+#include <algorithm>
+
 namespace OCLRT {
 
 const cl_uint Event::eventNotReady = 0xFFFFFFF0;
@@ -230,6 +235,10 @@ void Event::updateCompletionStamp(uint32_t taskCount, uint32_t tasklevel, FlushS
     this->taskCount = taskCount;
     this->taskLevel = tasklevel;
     this->flushStamp->setStamp(flushStamp);
+    // blocked enqueues set not ready task count first, their submission is notified when unblocked
+    if (DebugManager.flags.EventsTrackerEnable.get() && (cmdQueue != nullptr) && (taskCount != Event::eventNotReady)) {
+        EventsTracker::getEventsTracker().notifySubmission(this, &cmdQueue->getCommandStreamReceiver(), taskCount, false);
+    }
 }
 
 cl_ulong Event::getDelta(cl_ulong startTime,
@@ -310,6 +319,7 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     cpuDuration = static_cast<uint64_t>(gpuDuration * frequency);
     cpuCompleteDuration = static_cast<uint64_t>(gpuCompleteDuration * frequency);
 
+    gpuStartTimeStamp = globalStartTS;
     startTimeStamp = static_cast<uint64_t>(globalStartTS * frequency) + c0;
     endTimeStamp = startTimeStamp + cpuDuration;
     completeTimeStamp = startTimeStamp + cpuCompleteDuration;
@@ -323,6 +333,51 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     dataCalculated = true;
 }
 
+bool Event::getGpuExecutionTime(uint64_t &executionStart, uint64_t &executionEnd) {
+    if (!profilingCpuPath && !calcProfilingData()) {
+        return false;
+    }
+    auto &device = cmdQueue->getDevice();
+    auto &gpuTimeline = device.getGpuTimeline();
+    gpuTimeline.sample(*device.getOSTime());
+
+    if (profilingCpuPath) {
+        executionStart = gpuTimeline.convertCpuTime(startTimeStamp);
+        executionEnd = gpuTimeline.convertCpuTime(endTimeStamp);
+    } else {
+        double frequency = device.getDeviceInfo().profilingTimerResolution;
+        uint64_t cpuDuration = endTimeStamp - startTimeStamp;
+        if (DebugManager.flags.ReturnRawGpuTimestamps.get()) {
+            cpuDuration = static_cast<uint64_t>(getDelta(startTimeStamp, endTimeStamp) * frequency);
+        }
+        executionStart = gpuTimeline.convertGpuTimeStamp(gpuStartTimeStamp, frequency);
+        executionEnd = executionStart + cpuDuration;
+    }
+    return true;
+}
+
+void Event::recordTimeline(TraceRecorder &traceRecorder) {
+    uint64_t executionStart = 0;
+    uint64_t executionEnd = 0;
+    if (!getGpuExecutionTime(executionStart, executionEnd)) {
+        return;
+    }
+    auto &gpuTimeline = cmdQueue->getDevice().getGpuTimeline();
+
+    auto name = cmdTypeToName(cmdType);
+    if (name == nullptr) {
+        name = "command";
+    }
+    auto track = cmdQueue->getCommandStreamReceiver().getOsContext().getContextId() + 1;
+    if (queueTimeStamp.CPUTimeinNS != 0) {
+        auto queued = gpuTimeline.convertCpuTime(queueTimeStamp.CPUTimeinNS);
+        auto submitted = std::max(queued, gpuTimeline.convertCpuTime(submitTimeStamp.CPUTimeinNS));
+        traceRecorder.record(TraceCategory::Queued, name, queued, submitted, taskCount, track);
+        traceRecorder.record(TraceCategory::Submitted, name, submitted, std::max(submitted, executionStart), taskCount, track);
+    }
+    traceRecorder.record(TraceCategory::GpuExecution, name, executionStart, executionEnd, taskCount, track);
+}
+
 inline bool Event::wait(bool blocking, bool useQuickKmdSleep) {
     while (this->taskCount == Event::eventNotReady) {
         if (blocking == false) {
@@ -369,6 +424,16 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp()))) {
         transitionExecutionStatus(CL_COMPLETE);
+        if (isProfilingEnabled()) {
+            if (auto traceRecorder = TraceRecorder::getEnabledInstance()) {
+                recordTimeline(*traceRecorder);
+            }
+            uint64_t executionStart = 0;
+            uint64_t executionEnd = 0;
+            if (DebugManager.flags.EventsTrackerEnable.get() && getGpuExecutionTime(executionStart, executionEnd)) {
+                EventsTracker::getEventsTracker().notifyGpuExecution(this, executionStart, executionEnd);
+            }
+        }
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getCommandStreamReceiver().getInternalAllocationStorage();
@@ -384,6 +449,9 @@ void Event::addChild(Event &childEvent) {
     childEvent.incRefInternal();
     childEventsToNotify.pushRefFrontOne(childEvent);
     DBG_LOG(EventsDebugEnable, "addChild: Parent event:", this, "child:", &childEvent);
+    if (DebugManager.flags.EventsTrackerEnable.get()) {
+        EventsTracker::getEventsTracker().notifyDependency(this, &childEvent);
+    }
     if (DebugManager.flags.TrackParentEvents.get()) {
         childEvent.parentEvents.push_back(this);
     }
@@ -468,7 +536,7 @@ void Event::transitionExecutionStatus(int32_t newExecutionStatus) const {
         executionStatus.compare_exchange_weak(prevStatus, newExecutionStatus);
     }
     if (OCLRT::DebugManager.flags.EventsTrackerEnable.get()) {
-        EventsTracker::getEventsTracker().notifyTransitionedExecutionStatus();
+        EventsTracker::getEventsTracker().notifyTransitionedExecutionStatus(this, newExecutionStatus);
     }
 }
 
@@ -497,6 +565,9 @@ void Event::submitCommand(bool abortTasks) {
         updateTaskCount(complStamp.taskCount);
         flushStamp->setStamp(complStamp.flushStamp);
         submittedCmd.exchange(cmdToProcess.release());
+        if (DebugManager.flags.EventsTrackerEnable.get() && (this->cmdQueue != nullptr)) {
+            EventsTracker::getEventsTracker().notifySubmission(this, &this->cmdQueue->getCommandStreamReceiver(), complStamp.taskCount, true);
+        }
     } else if (profilingCpuPath && endTimeStamp == 0) {
         setEndTimeStamp();
     }
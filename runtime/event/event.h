@@ -29,6 +29,7 @@ class CommandQueue;
 class Context;
 class Device;
 class TimestampPacketContainer;
+class TraceRecorder;
 
 template <>
 struct OpenCLObjectMapper<_cl_event> {
@@ -321,6 +322,9 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     }
 
     bool calcProfilingData();
+    // GPU execution converted to host steady clock, false when profiling data is not ready
+    bool getGpuExecutionTime(uint64_t &executionStart, uint64_t &executionEnd);
+    void recordTimeline(TraceRecorder &traceRecorder);
     MOCKABLE_VIRTUAL void calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t contextEndTS, uint64_t *contextCompleteTS, uint64_t globalStartTS);
 
     // executes all callbacks associated with this event
@@ -360,6 +364,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     uint64_t startTimeStamp;
     uint64_t endTimeStamp;
     uint64_t completeTimeStamp;
+    uint64_t gpuStartTimeStamp = 0;
     bool perfCountersEnabled;
     TagNode<HwTimeStamps> *timeStampNode = nullptr;
     TagNode<HwPerfCounter> *perfCounterNode = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 #include "runtime/event/event_tracker.h"
 #include "runtime/utilities/iflist.h"
 #include "runtime/helpers/cl_helper.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 
 namespace OCLRT {
 
@@ -19,8 +21,13 @@ EventsTracker &EventsTracker::getEventsTracker() {
     static std::mutex initMutex;
     std::lock_guard<std::mutex> autolock(initMutex);
 
-    if (!EventsTracker::globalEvTracker)
+    if (!EventsTracker::globalEvTracker) {
         EventsTracker::globalEvTracker = std::unique_ptr<EventsTracker>{new EventsTracker()};
+        if (DebugManager.flags.EventsTrackerStreamFile.get() != "unk") {
+            auto streamSize = static_cast<size_t>(DebugManager.flags.EventsTrackerStreamSize.get()) * MemoryConstants::megaByte;
+            EventsTracker::globalEvTracker->enableStreaming(DebugManager.flags.EventsTrackerStreamFile.get(), streamSize);
+        }
+    }
     return *EventsTracker::globalEvTracker;
 }
 
@@ -227,13 +234,32 @@ void EventsTracker::dump() {
     }
 }
 
+bool EventsTracker::enableStreaming(const std::string &fileName, size_t size) {
+    streamWriter.reset();
+    streamFile = MappedFile::create(fileName, size);
+    if (!streamFile) {
+        return false;
+    }
+    streamWriter.reset(new EventsStreamWriter(streamFile->getData(), streamFile->getSize()));
+    return true;
+}
+
 void EventsTracker::notifyCreation(Event *eventToTrack) {
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::Create, eventToTrack, reinterpret_cast<uintptr_t>(eventToTrack->getCommandQueue()),
+                            static_cast<int32_t>(eventToTrack->getCommandType()));
+        return;
+    }
     dump();
     auto trackedE = new TrackedEvent{eventToTrack, eventId++};
     trackedEvents.pushFrontOne(*trackedE);
 }
 
 void EventsTracker::notifyDestruction(Event *eventToDestroy) {
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::Destroy, eventToDestroy, 0, 0);
+        return;
+    }
     auto trackedE = new TrackedEvent{eventToDestroy, -(eventId++)};
     trackedEvents.pushFrontOne(*trackedE);
     dump();
@@ -243,6 +269,41 @@ void EventsTracker::notifyTransitionedExecutionStatus() {
     dump();
 }
 
+void EventsTracker::notifyTransitionedExecutionStatus(const Event *event, int32_t newExecutionStatus) {
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::StatusTransition, event, 0, newExecutionStatus);
+        return;
+    }
+    dump();
+}
+
+void EventsTracker::notifyDependency(const Event *parentEvent, const Event *childEvent) {
+    // graph dumps walk child lists of live events, only stream needs explicit edges
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::Dependency, parentEvent, reinterpret_cast<uintptr_t>(childEvent), 0);
+    }
+}
+
+void EventsTracker::notifySubmission(const Event *event, const CommandStreamReceiver *commandStreamReceiver, uint32_t taskCount, bool blocked) {
+    if (streamWriter) {
+        auto type = blocked ? EventsStream::RecordType::BlockedSubmission : EventsStream::RecordType::Submission;
+        streamWriter->write(type, event, reinterpret_cast<uintptr_t>(commandStreamReceiver), static_cast<int32_t>(taskCount));
+    }
+}
+
+void EventsTracker::notifyFlush(const CommandStreamReceiver *commandStreamReceiver, uint32_t flushedTaskCount) {
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::Flush, commandStreamReceiver, flushedTaskCount, 0);
+    }
+}
+
+void EventsTracker::notifyGpuExecution(const Event *event, uint64_t startTimestamp, uint64_t endTimestamp) {
+    if (streamWriter) {
+        streamWriter->write(EventsStream::RecordType::GpuStart, event, startTimestamp, 0);
+        streamWriter->write(EventsStream::RecordType::GpuEnd, event, endTimestamp, 0);
+    }
+}
+
 std::unique_ptr<std::ostream> EventsTracker::createDumpStream(const std::string &filename) {
     return std::make_unique<std::fstream>(filename, std::ios::binary | std::ios::out);
 }
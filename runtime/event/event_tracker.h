@@ -1,15 +1,19 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "runtime/event/events_stream.h"
+#include "runtime/os_interface/mapped_file.h"
+
 #include <unordered_map>
 #include <set>
 
 namespace OCLRT {
+class CommandStreamReceiver;
 
 struct TrackedEvent : IFNode<TrackedEvent> {
     TrackedEvent(Event *ev, int64_t eventId)
@@ -28,6 +32,8 @@ class EventsTracker {
     std::atomic<int64_t> eventId{0};
     static std::unique_ptr<EventsTracker> globalEvTracker;
     IFList<TrackedEvent, true, true> trackedEvents;
+    std::unique_ptr<MappedFile> streamFile;
+    std::unique_ptr<EventsStreamWriter> streamWriter;
     EventsTracker() = default;
 
   public:
@@ -35,6 +41,16 @@ class EventsTracker {
     void notifyCreation(Event *eventToTrack);
     void notifyDestruction(Event *eventToDestroy);
     void notifyTransitionedExecutionStatus();
+    void notifyTransitionedExecutionStatus(const Event *event, int32_t newExecutionStatus);
+    void notifyDependency(const Event *parentEvent, const Event *childEvent);
+    // phases of command execution, recorded only in streaming mode for offline stall analysis
+    void notifySubmission(const Event *event, const CommandStreamReceiver *commandStreamReceiver, uint32_t taskCount, bool blocked);
+    void notifyFlush(const CommandStreamReceiver *commandStreamReceiver, uint32_t flushedTaskCount);
+    void notifyGpuExecution(const Event *event, uint64_t startTimestamp, uint64_t endTimestamp);
+
+    // instead of dumping whole graph on every change, appends records to ring of given size in memory-mapped file
+    bool enableStreaming(const std::string &fileName, size_t size);
+    EventsStreamWriter *getStreamWriter() { return streamWriter.get(); }
 
     MOCKABLE_VIRTUAL ~EventsTracker() = default;
     MOCKABLE_VIRTUAL TrackedEvent *getNodes();
@@ -0,0 +1,359 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/events_stream.h"
+#include "runtime/helpers/cl_helper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+namespace OCLRT {
+constexpr uint64_t EventsStreamGraph::noTimestamp;
+
+size_t EventsStream::getRecordsCapacity(size_t streamSize) {
+    return streamSize > sizeof(Header) ? (streamSize - sizeof(Header)) / sizeof(Record) : 0;
+}
+
+bool EventsStream::readRecords(const void *stream, size_t streamSize, std::vector<RecordData> &records) {
+    if (streamSize < sizeof(Header)) {
+        return false;
+    }
+    auto header = reinterpret_cast<const Header *>(stream);
+    if (memcmp(header->magic, magic, sizeof(magic)) != 0 || header->version != version || header->recordSize != sizeof(Record) ||
+        header->recordsCapacity == 0 || header->recordsCapacity > getRecordsCapacity(streamSize)) {
+        return false;
+    }
+
+    auto streamRecords = reinterpret_cast<const Record *>(header + 1);
+    auto writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    auto firstSequence = writeIndex > header->recordsCapacity ? writeIndex - header->recordsCapacity + 1 : 1;
+    auto firstRead = records.size();
+    for (uint64_t index = 0; index < header->recordsCapacity; index++) {
+        auto &record = streamRecords[index];
+        auto sequence = record.sequence.load(std::memory_order_acquire);
+        // skip empty slots and records that were being written when stream was captured
+        if (sequence < firstSequence || sequence > writeIndex) {
+            continue;
+        }
+        records.push_back({sequence, record.timestamp, record.event, record.argument, record.type, record.value});
+    }
+    std::sort(records.begin() + firstRead, records.end(), [](const RecordData &left, const RecordData &right) {
+        return left.sequence < right.sequence;
+    });
+    return true;
+}
+
+EventsStreamWriter::EventsStreamWriter(void *stream, size_t streamSize) {
+    memset(stream, 0, streamSize);
+    header = new (stream) EventsStream::Header();
+    memcpy(header->magic, EventsStream::magic, sizeof(EventsStream::magic));
+    header->version = EventsStream::version;
+    header->recordSize = sizeof(EventsStream::Record);
+    header->recordsCapacity = EventsStream::getRecordsCapacity(streamSize);
+    header->writeIndex.store(0, std::memory_order_release);
+    records = reinterpret_cast<EventsStream::Record *>(header + 1);
+}
+
+void EventsStreamWriter::write(EventsStream::RecordType type, const void *event, uint64_t argument, int32_t value) {
+    if (header->recordsCapacity == 0) {
+        return;
+    }
+    auto index = header->writeIndex.fetch_add(1, std::memory_order_acq_rel);
+    auto &record = records[index % header->recordsCapacity];
+    record.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.timestamp = getTimestamp();
+    record.event = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(event));
+    record.argument = argument;
+    record.type = type;
+    record.value = value;
+    record.sequence.store(index + 1, std::memory_order_release);
+}
+
+uint64_t EventsStreamWriter::getTimestamp() {
+    // same clock as TraceRecorder, so streams can be matched with traces
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+size_t EventsStreamGraph::getNode(uint64_t event) {
+    auto liveNode = liveNodes.find(event);
+    if (liveNode != liveNodes.end()) {
+        return liveNode->second;
+    }
+    // Create record was overwritten in the ring, node starts with its first known record
+    nodes.emplace_back();
+    nodes.back().event = event;
+    liveNodes[event] = nodes.size() - 1;
+    return nodes.size() - 1;
+}
+
+void EventsStreamGraph::build(const std::vector<EventsStream::RecordData> &records) {
+    nodes.clear();
+    liveNodes.clear();
+    commandStreamReceivers.clear();
+    for (auto &record : records) {
+        switch (record.type) {
+        case EventsStream::RecordType::Create: {
+            liveNodes.erase(record.event);
+            auto &node = nodes[getNode(record.event)];
+            node.commandQueue = record.argument;
+            node.commandType = static_cast<uint32_t>(record.value);
+            node.createTimestamp = record.timestamp;
+            break;
+        }
+        case EventsStream::RecordType::StatusTransition: {
+            auto &node = nodes[getNode(record.event)];
+            // repeated transitions to already passed status do not move event back
+            node.executionStatus = std::min(node.executionStatus, record.value);
+            if (record.value <= CL_SUBMITTED && node.submitTimestamp == noTimestamp) {
+                node.submitTimestamp = record.timestamp;
+            }
+            if (record.value <= CL_COMPLETE && node.completeTimestamp == noTimestamp) {
+                node.completeTimestamp = record.timestamp;
+            }
+            break;
+        }
+        case EventsStream::RecordType::Dependency: {
+            auto parent = getNode(record.event);
+            auto child = getNode(record.argument);
+            nodes[parent].children.push_back(child);
+            nodes[child].parents.push_back(parent);
+            break;
+        }
+        case EventsStream::RecordType::Destroy: {
+            nodes[getNode(record.event)].destroyTimestamp = record.timestamp;
+            liveNodes.erase(record.event);
+            break;
+        }
+        case EventsStream::RecordType::Submission:
+        case EventsStream::RecordType::BlockedSubmission: {
+            auto index = getNode(record.event);
+            auto &node = nodes[index];
+            node.commandStreamReceiver = record.argument;
+            node.taskCount = static_cast<uint32_t>(record.value);
+            node.blocked = record.type == EventsStream::RecordType::BlockedSubmission;
+            node.taskSubmitTimestamp = record.timestamp;
+            auto &csrState = commandStreamReceivers[record.argument];
+            // with immediate dispatch task is flushed before its event learns the task count
+            if (node.taskCount <= csrState.flushedTaskCount) {
+                node.flushTimestamp = record.timestamp;
+            } else {
+                csrState.unflushedNodes.push_back(index);
+            }
+            break;
+        }
+        case EventsStream::RecordType::Flush: {
+            auto &csrState = commandStreamReceivers[record.event];
+            csrState.flushedTaskCount = std::max(csrState.flushedTaskCount, static_cast<uint32_t>(record.argument));
+            auto &unflushedNodes = csrState.unflushedNodes;
+            auto flushedNodes = std::remove_if(unflushedNodes.begin(), unflushedNodes.end(), [&](size_t index) {
+                if (nodes[index].taskCount > csrState.flushedTaskCount) {
+                    return false;
+                }
+                nodes[index].flushTimestamp = record.timestamp;
+                return true;
+            });
+            unflushedNodes.erase(flushedNodes, unflushedNodes.end());
+            break;
+        }
+        case EventsStream::RecordType::GpuStart:
+            nodes[getNode(record.event)].gpuStartTimestamp = record.argument;
+            break;
+        case EventsStream::RecordType::GpuEnd:
+            nodes[getNode(record.event)].gpuEndTimestamp = record.argument;
+            break;
+        }
+    }
+}
+
+std::vector<size_t> EventsStreamGraph::getCriticalPath() const {
+    std::vector<size_t> path;
+    auto isCompletedLater = [this](size_t left, size_t right) {
+        return nodes[left].completeTimestamp < nodes[right].completeTimestamp;
+    };
+
+    size_t current = 0;
+    for (size_t node = 0; node < nodes.size(); node++) {
+        if (isCompletedLater(current, node)) {
+            current = node;
+        }
+    }
+    if (nodes.empty() || nodes[current].completeTimestamp == noTimestamp) {
+        return path;
+    }
+
+    path.push_back(current);
+    // path length is bounded by nodes count, completion order keeps it acyclic
+    while (path.size() < nodes.size()) {
+        auto &parents = nodes[current].parents;
+        auto latestParent = std::max_element(parents.begin(), parents.end(), isCompletedLater);
+        if (latestParent == parents.end() || nodes[*latestParent].completeTimestamp == noTimestamp) {
+            break;
+        }
+        current = *latestParent;
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+uint64_t EventsStreamGraph::getReadyTimestamp(const Node &node, size_t &blockingParent) const {
+    uint64_t readyTimestamp = noTimestamp;
+    for (auto parent : node.parents) {
+        auto &parentNode = nodes[parent];
+        // GPU end is closer to the moment dependency was actually met than observed completion
+        auto parentDone = parentNode.gpuEndTimestamp != noTimestamp ? parentNode.gpuEndTimestamp : parentNode.completeTimestamp;
+        if (parentDone != noTimestamp && parentDone > readyTimestamp) {
+            readyTimestamp = parentDone;
+            blockingParent = parent;
+        }
+    }
+    return readyTimestamp;
+}
+
+EventsStreamGraph::Stalls EventsStreamGraph::getStalls(size_t index, uint64_t since) const {
+    Stalls stalls;
+    auto &node = nodes[index];
+    auto completed = node.completeTimestamp;
+    if (completed == noTimestamp) {
+        return stalls;
+    }
+    // each phase starts where previous one ended when its record is missing, boundaries never go backwards
+    auto nextBoundary = [completed](uint64_t timestamp, uint64_t previous) {
+        return std::min(timestamp == noTimestamp ? previous : std::max(timestamp, previous), completed);
+    };
+    auto created = node.createTimestamp;
+    if (created == noTimestamp) {
+        created = node.taskSubmitTimestamp != noTimestamp ? node.taskSubmitTimestamp : completed;
+    }
+    created = std::min(std::max(created, since), completed);
+    auto submitted = nextBoundary(node.taskSubmitTimestamp, created);
+    auto flushed = nextBoundary(node.flushTimestamp, submitted);
+    auto gpuStarted = nextBoundary(node.gpuStartTimestamp, flushed);
+    auto gpuEnded = node.gpuEndTimestamp != noTimestamp ? nextBoundary(node.gpuEndTimestamp, gpuStarted) : completed;
+
+    auto ready = std::max(getReadyTimestamp(node, stalls.blockingParent), created);
+    // only blocked commands wait for dependencies on host, others are submitted at once and wait on GPU
+    auto readyForSubmission = node.blocked ? std::min(ready, submitted) : created;
+    auto readyOnGpu = std::min(std::max(ready, flushed), gpuStarted);
+
+    stalls.dependencyWait = (readyForSubmission - created) + (readyOnGpu - flushed);
+    stalls.submission = submitted - readyForSubmission;
+    stalls.batching = flushed - submitted;
+    stalls.gpuQueue = gpuStarted - readyOnGpu;
+    stalls.gpuExecution = gpuEnded - gpuStarted;
+    stalls.completionNotify = completed - gpuEnded;
+    return stalls;
+}
+
+namespace {
+void dumpStallsValues(std::ostream &out, const EventsStreamGraph::Stalls &stalls) {
+    out << " dependency=" << stalls.dependencyWait
+        << " submission=" << stalls.submission
+        << " batching=" << stalls.batching
+        << " gpuQueue=" << stalls.gpuQueue
+        << " execution=" << stalls.gpuExecution
+        << " notify=" << stalls.completionNotify << "\n";
+}
+
+const char *getCommandName(uint32_t commandType) {
+    auto name = cmdTypeToName(commandType);
+    return name ? name : "CMD_UNKNOWN";
+}
+
+const char *getStatusName(int32_t executionStatus) {
+    static const char *statusNames[] = {
+        "CL_COMPLETE",
+        "CL_RUNNING",
+        "CL_SUBMITTED",
+        "CL_QUEUED"};
+    return (executionStatus >= CL_COMPLETE && executionStatus <= CL_QUEUED) ? statusNames[executionStatus] : "ABORTED";
+}
+
+uint64_t getDelta(uint64_t start, uint64_t end) {
+    return (start == EventsStreamGraph::noTimestamp || end < start) ? 0 : end - start;
+}
+} // namespace
+
+void EventsStreamGraph::dumpDot(std::ostream &out) const {
+    out << "digraph events_stream {\n";
+    out << "node [shape=record]\n";
+    for (size_t index = 0; index < nodes.size(); index++) {
+        auto &node = nodes[index];
+        const char *color = node.executionStatus <= CL_COMPLETE ? "green" : (node.executionStatus == CL_SUBMITTED ? "yellow" : "red");
+        out << "e" << index << "[label=\"{" << getCommandName(node.commandType) << "|" << getStatusName(node.executionStatus)
+            << "|event=0x" << std::hex << node.event << ", queue=0x" << node.commandQueue << std::dec << "}\",color=" << color << "];\n";
+    }
+    for (size_t index = 0; index < nodes.size(); index++) {
+        for (auto child : nodes[index].children) {
+            out << "e" << index << "->e" << child << ";\n";
+        }
+    }
+    out << "}\n";
+}
+
+void EventsStreamGraph::dumpCriticalPath(std::ostream &out) const {
+    uint64_t previousComplete = noTimestamp;
+    for (auto index : getCriticalPath()) {
+        auto &node = nodes[index];
+        // wait is time between completion of preceding node on the path and submission of this one
+        out << "e" << index << " " << getCommandName(node.commandType)
+            << " queue=0x" << std::hex << node.commandQueue << std::dec
+            << " wait=" << getDelta(previousComplete, node.submitTimestamp)
+            << " queued=" << getDelta(node.createTimestamp, node.submitTimestamp)
+            << " executing=" << getDelta(node.submitTimestamp, node.completeTimestamp) << "\n";
+        previousComplete = node.completeTimestamp;
+    }
+}
+
+void EventsStreamGraph::dumpStalls(std::ostream &out) const {
+    auto criticalPath = getCriticalPath();
+    std::vector<bool> isCritical(nodes.size(), false);
+    for (auto index : criticalPath) {
+        isCritical[index] = true;
+    }
+
+    for (size_t index = 0; index < nodes.size(); index++) {
+        auto &node = nodes[index];
+        if (node.completeTimestamp == noTimestamp) {
+            continue;
+        }
+        auto stalls = getStalls(index);
+        out << "e" << index << " " << getCommandName(node.commandType)
+            << " queue=0x" << std::hex << node.commandQueue << std::dec;
+        if (isCritical[index]) {
+            out << " critical";
+        }
+        if (node.blocked) {
+            out << " blocked";
+        }
+        if (stalls.dependencyWait) {
+            // edge that kept node waiting, removing it is the first candidate to shorten the path
+            out << " after=e" << stalls.blockingParent;
+        }
+        dumpStallsValues(out, stalls);
+    }
+
+    // nodes on path overlap with their predecessors, only time after preceding node completed is counted
+    Stalls criticalPathStalls;
+    uint64_t previousComplete = noTimestamp;
+    for (auto index : criticalPath) {
+        auto stalls = getStalls(index, previousComplete);
+        criticalPathStalls.dependencyWait += stalls.dependencyWait;
+        criticalPathStalls.submission += stalls.submission;
+        criticalPathStalls.batching += stalls.batching;
+        criticalPathStalls.gpuQueue += stalls.gpuQueue;
+        criticalPathStalls.gpuExecution += stalls.gpuExecution;
+        criticalPathStalls.completionNotify += stalls.completionNotify;
+        previousComplete = nodes[index].completeTimestamp;
+    }
+    out << "critical-path nodes=" << criticalPath.size();
+    dumpStallsValues(out, criticalPathStalls);
+}
+} // namespace OCLRT
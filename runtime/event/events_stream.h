@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace OCLRT {
+
+// Binary stream of event lifetime records written by EventsTracker in streaming mode.
+// Stream is a header followed by a ring of fixed size records, older records are overwritten
+// once the ring is full, so memory use is bounded regardless of run length.
+// Format is shared with events_stream_tool, which rebuilds the dependency graph offline.
+namespace EventsStream {
+constexpr char magic[8] = {'N', 'E', 'O', 'E', 'V', 'T', 'S', '\0'};
+constexpr uint32_t version = 1;
+
+enum class RecordType : uint32_t {
+    Create = 1,       // argument: command queue, value: command type
+    StatusTransition, // value: new execution status
+    Dependency,       // argument: child event
+    Destroy,
+    Submission,        // argument: command stream receiver, value: task count
+    BlockedSubmission, // as Submission, for command submitted from Event::submitCommand once unblocked
+    Flush,             // event: command stream receiver, argument: latest flushed task count
+    GpuStart,          // argument: start of GPU execution read from HwTimeStamps, in stream clock
+    GpuEnd             // argument: end of GPU execution read from HwTimeStamps, in stream clock
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t recordsCapacity;
+    std::atomic<uint64_t> writeIndex;
+    uint64_t reserved[4];
+};
+static_assert(sizeof(Header) == 64, "stream header has to keep its binary layout");
+
+struct Record {
+    // index of record in stream + 1, stored last so records being written have 0
+    std::atomic<uint64_t> sequence;
+    uint64_t timestamp;
+    uint64_t event;
+    uint64_t argument;
+    RecordType type;
+    int32_t value;
+};
+static_assert(sizeof(Record) == 40, "stream record has to keep its binary layout");
+
+struct RecordData {
+    uint64_t sequence;
+    uint64_t timestamp;
+    uint64_t event;
+    uint64_t argument;
+    RecordType type;
+    int32_t value;
+};
+
+size_t getRecordsCapacity(size_t streamSize);
+
+// returns false when memory does not contain a valid stream, records are ordered by sequence
+bool readRecords(const void *stream, size_t streamSize, std::vector<RecordData> &records);
+} // namespace EventsStream
+
+// Appends records to stream placed in caller provided memory, safe to call from many threads.
+class EventsStreamWriter {
+  public:
+    EventsStreamWriter(void *stream, size_t streamSize);
+    EventsStreamWriter(const EventsStreamWriter &) = delete;
+    EventsStreamWriter &operator=(const EventsStreamWriter &) = delete;
+
+    void write(EventsStream::RecordType type, const void *event, uint64_t argument, int32_t value);
+
+    uint64_t getRecordsCapacity() const { return header->recordsCapacity; }
+    uint64_t getWrittenRecordsCount() const { return header->writeIndex.load(std::memory_order_relaxed); }
+
+    static uint64_t getTimestamp();
+
+  protected:
+    EventsStream::Header *header;
+    EventsStream::Record *records;
+};
+
+// Dependency graph of events rebuilt from stream records.
+// Each lifetime of event address between Create and Destroy records is a separate node.
+class EventsStreamGraph {
+  public:
+    static constexpr uint64_t noTimestamp = 0;
+
+    struct Node {
+        uint64_t event = 0;
+        uint64_t commandQueue = 0;
+        uint32_t commandType = 0;
+        int32_t executionStatus = 3; // CL_QUEUED
+        uint64_t createTimestamp = noTimestamp;
+        uint64_t submitTimestamp = noTimestamp;
+        uint64_t completeTimestamp = noTimestamp;
+        uint64_t destroyTimestamp = noTimestamp;
+        uint64_t commandStreamReceiver = 0;
+        uint32_t taskCount = 0;
+        bool blocked = false;
+        uint64_t taskSubmitTimestamp = noTimestamp;
+        uint64_t flushTimestamp = noTimestamp;
+        uint64_t gpuStartTimestamp = noTimestamp;
+        uint64_t gpuEndTimestamp = noTimestamp;
+        std::vector<size_t> parents;
+        std::vector<size_t> children;
+    };
+
+    // Split of node lifetime, from creation to observed completion, into consecutive phases.
+    // Phases with missing records collapse to zero, so the sum always equals completion - creation.
+    struct Stalls {
+        uint64_t dependencyWait = 0;   // parents not completed yet, either before submission or on GPU
+        uint64_t submission = 0;       // dependencies met but task not in CSR yet, blocked enqueue when node is blocked
+        uint64_t batching = 0;         // task in CSR but not flushed to GPU
+        uint64_t gpuQueue = 0;         // flushed and ready, waiting for preceding work on engine
+        uint64_t gpuExecution = 0;     // between GPU start and end timestamps
+        uint64_t completionNotify = 0; // GPU end until runtime observed completion
+        size_t blockingParent = 0;     // parent completed last, meaningful only with dependencyWait
+    };
+
+    void build(const std::vector<EventsStream::RecordData> &records);
+
+    const std::vector<Node> &getNodes() const { return nodes; }
+
+    // chain of nodes ending at the last completed one, each preceded by its latest completed parent
+    std::vector<size_t> getCriticalPath() const;
+    // phases before since are skipped, used to not count time already covered by preceding node
+    Stalls getStalls(size_t node, uint64_t since = noTimestamp) const;
+
+    void dumpDot(std::ostream &out) const;
+    void dumpCriticalPath(std::ostream &out) const;
+    // stalls of every completed node, followed by totals over critical path
+    void dumpStalls(std::ostream &out) const;
+
+  protected:
+    size_t getNode(uint64_t event);
+    uint64_t getReadyTimestamp(const Node &node, size_t &blockingParent) const;
+
+    struct CommandStreamReceiverState {
+        uint32_t flushedTaskCount = 0;
+        std::vector<size_t> unflushedNodes;
+    };
+
+    std::vector<Node> nodes;
+    std::unordered_map<uint64_t, size_t> liveNodes;
+    std::unordered_map<uint64_t, CommandStreamReceiverState> commandStreamReceivers;
+};
+} // namespace OCLRT
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/gpu_timeline.h"
+#include "runtime/utilities/trace_recorder.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+constexpr uint64_t GpuTimeline::samplingPeriod;
+constexpr size_t GpuTimeline::maxSamplesCount;
+
+void GpuTimeline::addSample(const TimeStampData &cpuGpuTime, uint64_t traceTime) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!samples.empty()) {
+        auto &latestSample = samples.back();
+        if (traceTime < latestSample.traceTime + samplingPeriod) {
+            return;
+        }
+        if (cpuGpuTime.GPUTimeStamp < latestSample.gpuTimeStamp) {
+            // GPU timer wrapped around, older samples would break ordering
+            samples.clear();
+        }
+    }
+    samples.push_back({cpuGpuTime.GPUTimeStamp, cpuGpuTime.CPUTimeinNS, traceTime});
+    if (samples.size() > maxSamplesCount) {
+        samples.pop_front();
+    }
+}
+
+void GpuTimeline::sample(OSTime &osTime) {
+    auto traceTimeBefore = TraceRecorder::getTimestamp();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!samples.empty() && traceTimeBefore < samples.back().traceTime + samplingPeriod) {
+            return;
+        }
+    }
+    TimeStampData cpuGpuTime = {};
+    if (!osTime.getCpuGpuTime(&cpuGpuTime)) {
+        return;
+    }
+    auto traceTimeAfter = TraceRecorder::getTimestamp();
+    addSample(cpuGpuTime, traceTimeBefore + (traceTimeAfter - traceTimeBefore) / 2);
+}
+
+uint64_t GpuTimeline::convertGpuTimeStamp(uint64_t gpuTimeStamp, double gpuTimerResolution) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (samples.empty()) {
+        return static_cast<uint64_t>(gpuTimeStamp * gpuTimerResolution);
+    }
+
+    auto nextSample = std::upper_bound(samples.begin(), samples.end(), gpuTimeStamp, [](uint64_t timeStamp, const CorrelationSample &sample) {
+        return timeStamp < sample.gpuTimeStamp;
+    });
+    if (nextSample == samples.begin()) {
+        return nextSample->traceTime - static_cast<uint64_t>((nextSample->gpuTimeStamp - gpuTimeStamp) * gpuTimerResolution);
+    }
+
+    auto &previousSample = *(nextSample - 1);
+    auto gpuTicks = gpuTimeStamp - previousSample.gpuTimeStamp;
+    if (nextSample == samples.end()) {
+        return previousSample.traceTime + static_cast<uint64_t>(gpuTicks * gpuTimerResolution);
+    }
+    auto measuredResolution = static_cast<double>(nextSample->traceTime - previousSample.traceTime) /
+                              static_cast<double>(nextSample->gpuTimeStamp - previousSample.gpuTimeStamp);
+    return previousSample.traceTime + static_cast<uint64_t>(gpuTicks * measuredResolution);
+}
+
+uint64_t GpuTimeline::convertCpuTime(uint64_t cpuTime) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (samples.empty()) {
+        return cpuTime;
+    }
+
+    auto nextSample = std::upper_bound(samples.begin(), samples.end(), cpuTime, [](uint64_t time, const CorrelationSample &sample) {
+        return time < sample.cpuTime;
+    });
+    auto &closestSample = (nextSample == samples.begin()) ? *nextSample : *(nextSample - 1);
+    // unsigned arithmetic wraps correctly for times preceding the sample
+    return closestSample.traceTime + (cpuTime - closestSample.cpuTime);
+}
+
+size_t GpuTimeline::getSamplesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return samples.size();
+}
+} // namespace OCLRT
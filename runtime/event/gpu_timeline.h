@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/os_interface/os_time.h"
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace OCLRT {
+
+// Converts GPU timestamps and OSTime CPU times of profiled commands to TraceRecorder clock.
+// Conversion interpolates between CPU/GPU correlation samples taken periodically,
+// so drift between GPU timer and host clock does not accumulate over long runs.
+class GpuTimeline : NonCopyableOrMovableClass {
+  public:
+    struct CorrelationSample {
+        uint64_t gpuTimeStamp;
+        uint64_t cpuTime;
+        uint64_t traceTime;
+    };
+
+    static constexpr uint64_t samplingPeriod = 10000000; // ns
+    static constexpr size_t maxSamplesCount = 256;
+
+    void addSample(const TimeStampData &cpuGpuTime, uint64_t traceTime);
+    // samples OSTime only when the latest sample is older than samplingPeriod
+    void sample(OSTime &osTime);
+
+    uint64_t convertGpuTimeStamp(uint64_t gpuTimeStamp, double gpuTimerResolution) const;
+    uint64_t convertCpuTime(uint64_t cpuTime) const;
+
+    size_t getSamplesCount() const;
+
+  protected:
+    mutable std::mutex mtx;
+    std::deque<CorrelationSample> samples;
+};
+} // namespace OCLRT
@@ -13,7 +13,9 @@
 #include "runtime/built_ins/sip.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/hw_helper.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/device_factory.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/built_ins/built_ins.h"
@@ -93,4 +95,19 @@ BuiltIns *ExecutionEnvironment::getBuiltIns() {
     }
     return this->builtins.get();
 }
+CpuCopyEngine *ExecutionEnvironment::getCpuCopyEngine() {
+    if (!DebugManager.flags.EnableCpuCopyEngine.get()) {
+        return nullptr;
+    }
+    if (this->cpuCopyEngine.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->cpuCopyEngine.get() == nullptr) {
+            auto workersCount = DebugManager.flags.CpuCopyEngineWorkersCount.get() != -1
+                                    ? static_cast<uint32_t>(DebugManager.flags.CpuCopyEngineWorkersCount.get())
+                                    : CpuCopyEngine::getDefaultWorkersCount();
+            this->cpuCopyEngine = std::make_unique<CpuCopyEngine>(workersCount, CpuCopyEngine::defaultNonTemporalThreshold);
+        }
+    }
+    return this->cpuCopyEngine.get();
+}
 } // namespace OCLRT
@@ -17,6 +17,7 @@ namespace OCLRT {
 class AubCenter;
 class GmmHelper;
 class CommandStreamReceiver;
+class CpuCopyEngine;
 class MemoryManager;
 class SourceLevelDebugger;
 class CompilerInterface;
@@ -47,6 +48,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     GmmHelper *getGmmHelper() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
+    CpuCopyEngine *getCpuCopyEngine();
 
     std::unique_ptr<OSInterface> osInterface;
     std::unique_ptr<MemoryManager> memoryManager;
@@ -55,5 +57,6 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<CompilerInterface> compilerInterface;
     std::unique_ptr<SourceLevelDebugger> sourceLevelDebugger;
+    std::unique_ptr<CpuCopyEngine> cpuCopyEngine;
 };
 } // namespace OCLRT
@@ -54,6 +54,8 @@ struct SKLFamily : public GEN9 {
     static const STATE_SIP cmdInitStateSip;
     static const BINDING_TABLE_STATE cmdInitBindingTableState;
     static const MI_USER_INTERRUPT cmdInitUserInterrupt;
+    static const XY_SRC_COPY_BLT cmdInitXyCopyBlt;
+    static const MI_FLUSH_DW cmdInitMiFlushDw;
 
     static constexpr bool supportsCmdSet(GFXCORE_FAMILY cmdSetBaseFamily) {
         return cmdSetBaseFamily == IGFX_GEN8_CORE;
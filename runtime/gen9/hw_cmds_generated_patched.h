@@ -576,4 +576,285 @@ typedef struct tagMI_STORE_DATA_IMM {
     }
 } MI_STORE_DATA_IMM;
 STATIC_ASSERT(20 == sizeof(MI_STORE_DATA_IMM));
+typedef struct tagXY_SRC_COPY_BLT {
+    union tagTheStructure {
+        struct tagCommon {
+            uint32_t DwordLength : BITFIELD_RANGE(0, 7);
+            uint32_t Reserved_8 : BITFIELD_RANGE(8, 10);
+            uint32_t DestinationTilingEnable : BITFIELD_RANGE(11, 11);
+            uint32_t Reserved_12 : BITFIELD_RANGE(12, 14);
+            uint32_t SourceTilingEnable : BITFIELD_RANGE(15, 15);
+            uint32_t Reserved_16 : BITFIELD_RANGE(16, 19);
+            uint32_t ThirtyTwoBppByteMask : BITFIELD_RANGE(20, 21);
+            uint32_t InstructionTargetOpcode : BITFIELD_RANGE(22, 28);
+            uint32_t Client : BITFIELD_RANGE(29, 31);
+            uint32_t DestinationPitch : BITFIELD_RANGE(0, 15);
+            uint32_t RasterOperation : BITFIELD_RANGE(16, 23);
+            uint32_t ColorDepth : BITFIELD_RANGE(24, 25);
+            uint32_t Reserved_58 : BITFIELD_RANGE(26, 29);
+            uint32_t ClippingEnabled : BITFIELD_RANGE(30, 30);
+            uint32_t Reserved_63 : BITFIELD_RANGE(31, 31);
+            uint32_t DestinationX1CoordinateLeft : BITFIELD_RANGE(0, 15);
+            uint32_t DestinationY1CoordinateTop : BITFIELD_RANGE(16, 31);
+            uint32_t DestinationX2CoordinateRight : BITFIELD_RANGE(0, 15);
+            uint32_t DestinationY2CoordinateBottom : BITFIELD_RANGE(16, 31);
+            uint64_t DestinationBaseAddress;
+            uint32_t SourceX1CoordinateLeft : BITFIELD_RANGE(0, 15);
+            uint32_t SourceY1CoordinateTop : BITFIELD_RANGE(16, 31);
+            uint32_t SourcePitch : BITFIELD_RANGE(0, 15);
+            uint32_t Reserved_240 : BITFIELD_RANGE(16, 31);
+            uint64_t SourceBaseAddress;
+        } Common;
+        uint32_t RawData[10];
+    } TheStructure;
+    typedef enum tagDWORD_LENGTH {
+        DWORD_LENGTH_EXCLUDES_DWORD_0_1 = 0x8,
+    } DWORD_LENGTH;
+    typedef enum tagTHIRTY_TWO_BPP_BYTE_MASK {
+        THIRTY_TWO_BPP_BYTE_MASK_WRITE_RGB_CHANNEL = 0x1,
+        THIRTY_TWO_BPP_BYTE_MASK_WRITE_ALPHA_CHANNEL = 0x2,
+    } THIRTY_TWO_BPP_BYTE_MASK;
+    typedef enum tagINSTRUCTION_TARGETOPCODE {
+        INSTRUCTIONTARGET_OPCODE_OPCODE = 0x53,
+    } INSTRUCTION_TARGETOPCODE;
+    typedef enum tagCLIENT {
+        CLIENT_2D_PROCESSOR = 0x2,
+    } CLIENT;
+    typedef enum tagRASTER_OPERATION {
+        RASTER_OPERATION_SRC = 0xcc,
+    } RASTER_OPERATION;
+    typedef enum tagCOLOR_DEPTH {
+        COLOR_DEPTH_8_BIT_COLOR = 0x0,
+        COLOR_DEPTH_16_BIT_COLOR565 = 0x1,
+        COLOR_DEPTH_16_BIT_COLOR1555 = 0x2,
+        COLOR_DEPTH_32_BIT_COLOR = 0x3,
+    } COLOR_DEPTH;
+    inline void init(void) {
+        memset(&TheStructure, 0, sizeof(TheStructure));
+        TheStructure.Common.DwordLength = DWORD_LENGTH_EXCLUDES_DWORD_0_1;
+        TheStructure.Common.InstructionTargetOpcode = INSTRUCTIONTARGET_OPCODE_OPCODE;
+        TheStructure.Common.Client = CLIENT_2D_PROCESSOR;
+        TheStructure.Common.RasterOperation = RASTER_OPERATION_SRC;
+        TheStructure.Common.ColorDepth = COLOR_DEPTH_8_BIT_COLOR;
+    }
+    static tagXY_SRC_COPY_BLT sInit(void) {
+        XY_SRC_COPY_BLT state;
+        state.init();
+        return state;
+    }
+    inline uint32_t &getRawData(const uint32_t index) {
+        DEBUG_BREAK_IF(index >= 10);
+        return TheStructure.RawData[index];
+    }
+    inline void setDestinationTilingEnable(const bool value) {
+        TheStructure.Common.DestinationTilingEnable = value;
+    }
+    inline bool getDestinationTilingEnable(void) const {
+        return (TheStructure.Common.DestinationTilingEnable);
+    }
+    inline void setSourceTilingEnable(const bool value) {
+        TheStructure.Common.SourceTilingEnable = value;
+    }
+    inline bool getSourceTilingEnable(void) const {
+        return (TheStructure.Common.SourceTilingEnable);
+    }
+    inline void setThirtyTwoBppByteMask(const THIRTY_TWO_BPP_BYTE_MASK value) {
+        TheStructure.Common.ThirtyTwoBppByteMask = value;
+    }
+    inline THIRTY_TWO_BPP_BYTE_MASK getThirtyTwoBppByteMask(void) const {
+        return static_cast<THIRTY_TWO_BPP_BYTE_MASK>(TheStructure.Common.ThirtyTwoBppByteMask);
+    }
+    inline void setDestinationPitch(const uint32_t value) {
+        TheStructure.Common.DestinationPitch = value;
+    }
+    inline uint32_t getDestinationPitch(void) const {
+        return (TheStructure.Common.DestinationPitch);
+    }
+    inline void setRasterOperation(const RASTER_OPERATION value) {
+        TheStructure.Common.RasterOperation = value;
+    }
+    inline RASTER_OPERATION getRasterOperation(void) const {
+        return static_cast<RASTER_OPERATION>(TheStructure.Common.RasterOperation);
+    }
+    inline void setColorDepth(const COLOR_DEPTH value) {
+        TheStructure.Common.ColorDepth = value;
+    }
+    inline COLOR_DEPTH getColorDepth(void) const {
+        return static_cast<COLOR_DEPTH>(TheStructure.Common.ColorDepth);
+    }
+    inline void setClippingEnabled(const bool value) {
+        TheStructure.Common.ClippingEnabled = value;
+    }
+    inline bool getClippingEnabled(void) const {
+        return (TheStructure.Common.ClippingEnabled);
+    }
+    inline void setDestinationX1CoordinateLeft(const uint32_t value) {
+        TheStructure.Common.DestinationX1CoordinateLeft = value;
+    }
+    inline uint32_t getDestinationX1CoordinateLeft(void) const {
+        return (TheStructure.Common.DestinationX1CoordinateLeft);
+    }
+    inline void setDestinationY1CoordinateTop(const uint32_t value) {
+        TheStructure.Common.DestinationY1CoordinateTop = value;
+    }
+    inline uint32_t getDestinationY1CoordinateTop(void) const {
+        return (TheStructure.Common.DestinationY1CoordinateTop);
+    }
+    inline void setDestinationX2CoordinateRight(const uint32_t value) {
+        TheStructure.Common.DestinationX2CoordinateRight = value;
+    }
+    inline uint32_t getDestinationX2CoordinateRight(void) const {
+        return (TheStructure.Common.DestinationX2CoordinateRight);
+    }
+    inline void setDestinationY2CoordinateBottom(const uint32_t value) {
+        TheStructure.Common.DestinationY2CoordinateBottom = value;
+    }
+    inline uint32_t getDestinationY2CoordinateBottom(void) const {
+        return (TheStructure.Common.DestinationY2CoordinateBottom);
+    }
+    inline void setDestinationBaseAddress(const uint64_t value) {
+        TheStructure.Common.DestinationBaseAddress = value;
+    }
+    inline uint64_t getDestinationBaseAddress(void) const {
+        return (TheStructure.Common.DestinationBaseAddress);
+    }
+    inline void setSourceX1CoordinateLeft(const uint32_t value) {
+        TheStructure.Common.SourceX1CoordinateLeft = value;
+    }
+    inline uint32_t getSourceX1CoordinateLeft(void) const {
+        return (TheStructure.Common.SourceX1CoordinateLeft);
+    }
+    inline void setSourceY1CoordinateTop(const uint32_t value) {
+        TheStructure.Common.SourceY1CoordinateTop = value;
+    }
+    inline uint32_t getSourceY1CoordinateTop(void) const {
+        return (TheStructure.Common.SourceY1CoordinateTop);
+    }
+    inline void setSourcePitch(const uint32_t value) {
+        TheStructure.Common.SourcePitch = value;
+    }
+    inline uint32_t getSourcePitch(void) const {
+        return (TheStructure.Common.SourcePitch);
+    }
+    inline void setSourceBaseAddress(const uint64_t value) {
+        TheStructure.Common.SourceBaseAddress = value;
+    }
+    inline uint64_t getSourceBaseAddress(void) const {
+        return (TheStructure.Common.SourceBaseAddress);
+    }
+} XY_SRC_COPY_BLT;
+STATIC_ASSERT(40 == sizeof(XY_SRC_COPY_BLT));
+typedef struct tagMI_FLUSH_DW {
+    union tagTheStructure {
+        struct tagCommon {
+            uint32_t DwordLength : BITFIELD_RANGE(0, 5);
+            uint32_t Reserved_6 : BITFIELD_RANGE(6, 7);
+            uint32_t NotifyEnable : BITFIELD_RANGE(8, 8);
+            uint32_t FlushLlc : BITFIELD_RANGE(9, 9);
+            uint32_t Reserved_10 : BITFIELD_RANGE(10, 13);
+            uint32_t PostSyncOperation : BITFIELD_RANGE(14, 15);
+            uint32_t Reserved_16 : BITFIELD_RANGE(16, 17);
+            uint32_t TlbInvalidate : BITFIELD_RANGE(18, 18);
+            uint32_t Reserved_19 : BITFIELD_RANGE(19, 20);
+            uint32_t StoreDataIndex : BITFIELD_RANGE(21, 21);
+            uint32_t Reserved_22 : BITFIELD_RANGE(22, 22);
+            uint32_t MiCommandOpcode : BITFIELD_RANGE(23, 28);
+            uint32_t CommandType : BITFIELD_RANGE(29, 31);
+            uint64_t Reserved_32 : BITFIELD_RANGE(0, 1);
+            uint64_t DestinationAddressType : BITFIELD_RANGE(2, 2);
+            uint64_t DestinationAddress_Graphicsaddress47_3 : BITFIELD_RANGE(3, 47);
+            uint64_t DestinationAddress_Reserved : BITFIELD_RANGE(48, 63);
+            uint64_t ImmediateData;
+        } Common;
+        uint32_t RawData[5];
+    } TheStructure;
+    typedef enum tagDWORD_LENGTH {
+        DWORD_LENGTH_EXCLUDES_DWORD_0_1 = 0x3,
+    } DWORD_LENGTH;
+    typedef enum tagPOST_SYNC_OPERATION {
+        POST_SYNC_OPERATION_NO_WRITE = 0x0,
+        POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD = 0x1,
+        POST_SYNC_OPERATION_WRITE_TIMESTAMP_REGISTER = 0x3,
+    } POST_SYNC_OPERATION;
+    typedef enum tagMI_COMMAND_OPCODE {
+        MI_COMMAND_OPCODE_MI_FLUSH_DW = 0x26,
+    } MI_COMMAND_OPCODE;
+    typedef enum tagCOMMAND_TYPE {
+        COMMAND_TYPE_MI_COMMAND = 0x0,
+    } COMMAND_TYPE;
+    typedef enum tagDESTINATION_ADDRESS_TYPE {
+        DESTINATION_ADDRESS_TYPE_PPGTT = 0x0,
+        DESTINATION_ADDRESS_TYPE_GGTT = 0x1,
+    } DESTINATION_ADDRESS_TYPE;
+    inline void init(void) {
+        memset(&TheStructure, 0, sizeof(TheStructure));
+        TheStructure.Common.DwordLength = DWORD_LENGTH_EXCLUDES_DWORD_0_1;
+        TheStructure.Common.PostSyncOperation = POST_SYNC_OPERATION_NO_WRITE;
+        TheStructure.Common.MiCommandOpcode = MI_COMMAND_OPCODE_MI_FLUSH_DW;
+        TheStructure.Common.CommandType = COMMAND_TYPE_MI_COMMAND;
+        TheStructure.Common.DestinationAddressType = DESTINATION_ADDRESS_TYPE_PPGTT;
+    }
+    static tagMI_FLUSH_DW sInit(void) {
+        MI_FLUSH_DW state;
+        state.init();
+        return state;
+    }
+    inline uint32_t &getRawData(const uint32_t index) {
+        DEBUG_BREAK_IF(index >= 5);
+        return TheStructure.RawData[index];
+    }
+    inline void setNotifyEnable(const bool value) {
+        TheStructure.Common.NotifyEnable = value;
+    }
+    inline bool getNotifyEnable(void) const {
+        return (TheStructure.Common.NotifyEnable);
+    }
+    inline void setFlushLlc(const bool value) {
+        TheStructure.Common.FlushLlc = value;
+    }
+    inline bool getFlushLlc(void) const {
+        return (TheStructure.Common.FlushLlc);
+    }
+    inline void setPostSyncOperation(const POST_SYNC_OPERATION value) {
+        TheStructure.Common.PostSyncOperation = value;
+    }
+    inline POST_SYNC_OPERATION getPostSyncOperation(void) const {
+        return static_cast<POST_SYNC_OPERATION>(TheStructure.Common.PostSyncOperation);
+    }
+    inline void setTlbInvalidate(const bool value) {
+        TheStructure.Common.TlbInvalidate = value;
+    }
+    inline bool getTlbInvalidate(void) const {
+        return (TheStructure.Common.TlbInvalidate);
+    }
+    inline void setStoreDataIndex(const bool value) {
+        TheStructure.Common.StoreDataIndex = value;
+    }
+    inline bool getStoreDataIndex(void) const {
+        return (TheStructure.Common.StoreDataIndex);
+    }
+    inline void setDestinationAddressType(const DESTINATION_ADDRESS_TYPE value) {
+        TheStructure.Common.DestinationAddressType = value;
+    }
+    inline DESTINATION_ADDRESS_TYPE getDestinationAddressType(void) const {
+        return static_cast<DESTINATION_ADDRESS_TYPE>(TheStructure.Common.DestinationAddressType);
+    }
+    typedef enum tagDESTINATIONADDRESS_GRAPHICSADDRESS47_3 {
+        DESTINATIONADDRESS_GRAPHICSADDRESS47_3_BIT_SHIFT = 0x3,
+        DESTINATIONADDRESS_GRAPHICSADDRESS47_3_ALIGN_SIZE = 0x8,
+    } DESTINATIONADDRESS_GRAPHICSADDRESS47_3;
+    inline void setDestinationAddress(const uint64_t value) {
+        TheStructure.Common.DestinationAddress_Graphicsaddress47_3 = value >> DESTINATIONADDRESS_GRAPHICSADDRESS47_3_BIT_SHIFT;
+    }
+    inline uint64_t getDestinationAddress(void) const {
+        return (TheStructure.Common.DestinationAddress_Graphicsaddress47_3 << DESTINATIONADDRESS_GRAPHICSADDRESS47_3_BIT_SHIFT);
+    }
+    inline void setImmediateData(const uint64_t value) {
+        TheStructure.Common.ImmediateData = value;
+    }
+    inline uint64_t getImmediateData(void) const {
+        return (TheStructure.Common.ImmediateData);
+    }
+} MI_FLUSH_DW;
+STATIC_ASSERT(20 == sizeof(MI_FLUSH_DW));
 #pragma pack()
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/stackvec.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OCLRT {
+class GraphicsAllocation;
+class LinearStream;
+class TimestampPacketContainer;
+
+namespace BlitterConstants {
+// linear copies are programmed as 8bpp rectangles, pitch is limited to 15 bits
+constexpr uint64_t maxBlitWidth = 0x7FC0;
+constexpr uint64_t maxBlitHeight = 0x3FC0;
+} // namespace BlitterConstants
+
+struct BlitProperties {
+    GraphicsAllocation *dstAllocation = nullptr;
+    GraphicsAllocation *srcAllocation = nullptr;
+    uint64_t dstGpuAddress = 0;
+    uint64_t srcGpuAddress = 0;
+    uint64_t copySize = 0;
+    TimestampPacketContainer *outputTimestampPacket = nullptr;
+    StackVec<TimestampPacketContainer *, 32> timestampPacketDependencies;
+};
+
+template <typename GfxFamily>
+struct BlitCommandsHelper {
+    static uint64_t getBlitsCount(uint64_t copySize);
+    static size_t estimateBlitCommandsSize(const BlitProperties &blitProperties);
+    static void dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream);
+    static void programMiFlushDw(LinearStream &linearStream, uint64_t immediateDataGpuAddress, uint64_t immediateData);
+};
+} // namespace OCLRT
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/linear_stream.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/blit_commands_helper.h"
+#include "runtime/helpers/timestamp_packet.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/utilities/tag_allocator.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+template <typename GfxFamily>
+uint64_t BlitCommandsHelper<GfxFamily>::getBlitsCount(uint64_t copySize) {
+    uint64_t blitsCount = 0;
+    while (copySize != 0) {
+        uint64_t width = std::min(copySize, BlitterConstants::maxBlitWidth);
+        uint64_t height = (copySize > BlitterConstants::maxBlitWidth) ? std::min(copySize / width, BlitterConstants::maxBlitHeight) : 1;
+        copySize -= width * height;
+        blitsCount++;
+    }
+    return blitsCount;
+}
+
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitProperties &blitProperties) {
+    size_t semaphoresCount = 0;
+    for (auto timestampPacketContainer : blitProperties.timestampPacketDependencies) {
+        semaphoresCount += timestampPacketContainer->peekNodes().size();
+    }
+    size_t flushesCount = blitProperties.outputTimestampPacket->peekNodes().size() + 1;
+
+    size_t size = semaphoresCount * (sizeof(typename GfxFamily::MI_SEMAPHORE_WAIT) + sizeof(typename GfxFamily::MI_ATOMIC)) +
+                  static_cast<size_t>(getBlitsCount(blitProperties.copySize)) * sizeof(typename GfxFamily::XY_SRC_COPY_BLT) +
+                  flushesCount * sizeof(typename GfxFamily::MI_FLUSH_DW) +
+                  sizeof(typename GfxFamily::MI_BATCH_BUFFER_END);
+
+    return alignUp(size, MemoryConstants::cacheLineSize);
+}
+
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream) {
+    uint64_t sizeToBlit = blitProperties.copySize;
+    uint64_t offset = 0;
+
+    while (sizeToBlit != 0) {
+        uint64_t width = std::min(sizeToBlit, BlitterConstants::maxBlitWidth);
+        uint64_t height = (sizeToBlit > BlitterConstants::maxBlitWidth) ? std::min(sizeToBlit / width, BlitterConstants::maxBlitHeight) : 1;
+
+        auto bltCmd = linearStream.getSpaceForCmd<typename GfxFamily::XY_SRC_COPY_BLT>();
+        *bltCmd = GfxFamily::cmdInitXyCopyBlt;
+
+        bltCmd->setDestinationX2CoordinateRight(static_cast<uint32_t>(width));
+        bltCmd->setDestinationY2CoordinateBottom(static_cast<uint32_t>(height));
+        bltCmd->setDestinationPitch(static_cast<uint32_t>(width));
+        bltCmd->setSourcePitch(static_cast<uint32_t>(width));
+
+        bltCmd->setDestinationBaseAddress(blitProperties.dstGpuAddress + offset);
+        bltCmd->setSourceBaseAddress(blitProperties.srcGpuAddress + offset);
+
+        auto blitSize = width * height;
+        offset += blitSize;
+        sizeToBlit -= blitSize;
+    }
+}
+
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::programMiFlushDw(LinearStream &linearStream, uint64_t immediateDataGpuAddress, uint64_t immediateData) {
+    using MI_FLUSH_DW = typename GfxFamily::MI_FLUSH_DW;
+
+    auto miFlushDwCmd = linearStream.getSpaceForCmd<MI_FLUSH_DW>();
+    *miFlushDwCmd = GfxFamily::cmdInitMiFlushDw;
+    miFlushDwCmd->setPostSyncOperation(MI_FLUSH_DW::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD);
+    miFlushDwCmd->setDestinationAddress(immediateDataGpuAddress);
+    miFlushDwCmd->setImmediateData(immediateData);
+}
+} // namespace OCLRT
@@ -1,15 +1,17 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#pragma once
 #include "CL/cl.h"
 #include "CL/cl_gl_ext.h"
 
 namespace OCLRT {
-inline const std::string cmdTypetoString(cl_command_type cmd) {
+// returns nullptr for unknown command types
+inline const char *cmdTypeToName(cl_command_type cmd) {
     switch (cmd) {
     case CL_COMMAND_NDRANGE_KERNEL:
         return "CL_COMMAND_NDRANGE_KERNEL";
@@ -73,10 +75,17 @@ inline const std::string cmdTypetoString(cl_command_type cmd) {
         return "CL_COMMAND_SVM_UNMAP";
     case CL_COMMAND_GL_FENCE_SYNC_OBJECT_KHR:
         return "CL_COMMAND_GL_FENCE_SYNC_OBJECT_KHR";
-    default: {
+    default:
+        return nullptr;
+    }
+}
+
+inline const std::string cmdTypetoString(cl_command_type cmd) {
+    auto name = cmdTypeToName(cmd);
+    if (name == nullptr) {
         std::string returnString("CMD_UNKNOWN:" + std::to_string((cl_command_type)cmd));
         return returnString;
     }
-    }
+    return name;
 }
 } // namespace OCLRT
\ No newline at end of file
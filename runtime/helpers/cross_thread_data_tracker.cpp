@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/cross_thread_data_tracker.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/indirect_heap/indirect_heap.h"
+
+#include <cstring>
+#include <mutex>
+
+namespace OCLRT {
+
+size_t CrossThreadDataTracker::patchDirtyDwords(void *destination, void *shadow, const void *source, size_t size) {
+    auto dstDwords = reinterpret_cast<uint32_t *>(destination);
+    auto shadowDwords = reinterpret_cast<uint32_t *>(shadow);
+    auto srcDwords = reinterpret_cast<const uint32_t *>(source);
+    auto dwordsCount = size / sizeof(uint32_t);
+    size_t patchedDwords = 0;
+
+    size_t i = 0;
+    while (i < dwordsCount) {
+        if (shadowDwords[i] == srcDwords[i]) {
+            i++;
+            continue;
+        }
+        auto rangeStart = i;
+        while (i < dwordsCount && shadowDwords[i] != srcDwords[i]) {
+            i++;
+        }
+        auto rangeSize = (i - rangeStart) * sizeof(uint32_t);
+        memcpy_s(dstDwords + rangeStart, rangeSize, srcDwords + rangeStart, rangeSize);
+        memcpy_s(shadowDwords + rangeStart, rangeSize, srcDwords + rangeStart, rangeSize);
+        patchedDwords += i - rangeStart;
+    }
+    return patchedDwords;
+}
+
+bool CrossThreadDataTracker::reuseIndirectData(IndirectHeap &ioh, const void *crossThreadData, size_t crossThreadDataSize,
+                                               volatile uint32_t *completionTagAddress, uint32_t taskCount, IndirectDataCopy &copy) {
+    std::unique_lock<SpinLock> lock(trackerLock);
+    if (lastCopy.heapBufferId != ioh.getBufferId() || !(lastCopy.layout == copy.layout) ||
+        this->completionTagAddress != completionTagAddress || shadow.size() != crossThreadDataSize ||
+        crossThreadDataSize % sizeof(uint32_t) != 0) {
+        return false;
+    }
+
+    if (memcmp(shadow.data(), crossThreadData, crossThreadDataSize) != 0) {
+        // previous copy may still be read by the GPU
+        if (*completionTagAddress < lastTaskCount) {
+            return false;
+        }
+        patchedDwordsCount += patchDirtyDwords(ptrOffset(ioh.getCpuBase(), lastCopy.heapOffset), shadow.data(), crossThreadData, crossThreadDataSize);
+    }
+
+    reusedCount++;
+    lastTaskCount = taskCount;
+    copy = lastCopy;
+    return true;
+}
+
+void CrossThreadDataTracker::storeIndirectData(const IndirectDataCopy &copy, const void *crossThreadData, size_t crossThreadDataSize,
+                                               volatile uint32_t *completionTagAddress, uint32_t taskCount) {
+    std::unique_lock<SpinLock> lock(trackerLock);
+    lastCopy = copy;
+    shadow.assign(reinterpret_cast<const char *>(crossThreadData), reinterpret_cast<const char *>(crossThreadData) + crossThreadDataSize);
+    this->completionTagAddress = completionTagAddress;
+    lastTaskCount = taskCount;
+}
+} // namespace OCLRT
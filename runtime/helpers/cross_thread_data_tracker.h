@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/utilities/spinlock.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OCLRT {
+class IndirectHeap;
+
+// Remembers where cross thread data of a kernel was last written to the indirect object heap,
+// together with a shadow of the written bytes. A following dispatch reuses that copy when data did not change,
+// or patches only dirty dwords in place once the GPU retired the previous copy.
+class CrossThreadDataTracker : NonCopyableOrMovableClass {
+  public:
+    struct PerThreadDataLayout {
+        uint32_t simd = 0;
+        uint32_t numChannels = 0;
+        std::array<size_t, 3> localWorkSize = {};
+        bool localIdsGenerationByRuntime = false;
+
+        bool operator==(const PerThreadDataLayout &other) const {
+            return simd == other.simd && numChannels == other.numChannels &&
+                   localWorkSize == other.localWorkSize && localIdsGenerationByRuntime == other.localIdsGenerationByRuntime;
+        }
+    };
+
+    struct IndirectDataCopy {
+        uint64_t heapBufferId = 0;
+        size_t heapOffset = 0;
+        size_t sizePerThreadData = 0;
+        size_t sizePerThreadDataTotal = 0;
+        PerThreadDataLayout layout;
+    };
+
+    static size_t patchDirtyDwords(void *destination, void *shadow, const void *source, size_t size);
+
+    // On success copy describes previous location and the copy is referenced by taskCount
+    bool reuseIndirectData(IndirectHeap &ioh, const void *crossThreadData, size_t crossThreadDataSize,
+                           volatile uint32_t *completionTagAddress, uint32_t taskCount, IndirectDataCopy &copy);
+    void storeIndirectData(const IndirectDataCopy &copy, const void *crossThreadData, size_t crossThreadDataSize,
+                           volatile uint32_t *completionTagAddress, uint32_t taskCount);
+
+    uint64_t peekReusedCount() const { return reusedCount; }
+    uint64_t peekPatchedDwordsCount() const { return patchedDwordsCount; }
+
+  protected:
+    IndirectDataCopy lastCopy;
+    std::vector<char> shadow;
+    volatile uint32_t *completionTagAddress = nullptr;
+    uint32_t lastTaskCount = 0;
+    uint64_t reusedCount = 0;
+    uint64_t patchedDwordsCount = 0;
+    SpinLock trackerLock;
+};
+} // namespace OCLRT
@@ -163,9 +163,13 @@ struct MultiDispatchInfo {
     Kernel *peekParentKernel() const;
     Kernel *peekMainKernel() const;
 
+    bool isLocalWorkSizeTrialRequired() const { return localWorkSizeTrialRequired; }
+    void setLocalWorkSizeTrialRequired(bool trialRequired) { this->localWorkSizeTrialRequired = trialRequired; }
+
   protected:
     StackVec<DispatchInfo, 9> dispatchInfos;
     StackVec<MemObj *, 2> redescribedSurfaces;
     Kernel *mainKernel = nullptr;
+    bool localWorkSizeTrialRequired = false;
 };
 } // namespace OCLRT
@@ -19,6 +19,7 @@
 
 namespace OCLRT {
 
+class CommandStreamReceiver;
 class LinearStream;
 class IndirectHeap;
 struct CrossThreadInfo;
@@ -110,7 +111,8 @@ struct KernelCommandsHelper : public PerThreadDataHelper {
         PreemptionMode preemptionMode,
         WALKER_TYPE<GfxFamily> *walkerCmd,
         INTERFACE_DESCRIPTOR_DATA *inlineInterfaceDescriptor,
-        bool localIdsGenerationByRuntime);
+        bool localIdsGenerationByRuntime,
+        CommandStreamReceiver *indirectDataOwner = nullptr);
 
     static void programPerThreadData(
         size_t &sizePerThreadData,
@@ -6,10 +6,12 @@
  */
 
 #include "runtime/command_queue/local_id_gen.h"
+#include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/command_stream/csr_definitions.h"
 #include "runtime/command_stream/preemption.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/cross_thread_data_tracker.h"
 #include "runtime/helpers/dispatch_info.h"
 #include "runtime/helpers/address_patch.h"
 #include "runtime/helpers/ptr_math.h"
@@ -229,7 +231,8 @@ size_t KernelCommandsHelper<GfxFamily>::sendIndirectState(
     PreemptionMode preemptionMode,
     WALKER_TYPE<GfxFamily> *walkerCmd,
     INTERFACE_DESCRIPTOR_DATA *inlineInterfaceDescriptor,
-    bool localIdsGenerationByRuntime) {
+    bool localIdsGenerationByRuntime,
+    CommandStreamReceiver *indirectDataOwner) {
 
     using SAMPLER_STATE = typename GfxFamily::SAMPLER_STATE;
 
@@ -291,23 +294,51 @@ size_t KernelCommandsHelper<GfxFamily>::sendIndirectState(
 
     uint32_t sizeCrossThreadData = kernel.getCrossThreadDataSize();
 
-    size_t offsetCrossThreadData = KernelCommandsHelper<GfxFamily>::sendCrossThreadData(
-        ioh, kernel, inlineDataProgrammingRequired,
-        walkerCmd, sizeCrossThreadData);
-
+    size_t offsetCrossThreadData = 0;
     size_t sizePerThreadDataTotal = 0;
     size_t sizePerThreadData = 0;
 
-    KernelCommandsHelper<GfxFamily>::programPerThreadData(
-        sizePerThreadData,
-        localIdsGenerationByRuntime,
-        ioh,
-        simd,
-        numChannels,
-        localWorkSize,
-        kernel,
-        sizePerThreadDataTotal,
-        localWorkItems);
+    CrossThreadDataTracker *crossThreadDataTracker = nullptr;
+    if (indirectDataOwner && DebugManager.flags.EnableCrossThreadDataReuse.get() && !inlineDataProgrammingRequired &&
+        !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+        crossThreadDataTracker = &kernel.getCrossThreadDataTracker();
+    }
+
+    CrossThreadDataTracker::IndirectDataCopy indirectDataCopy;
+    indirectDataCopy.layout = {simd, numChannels, {{localWorkSize[0], localWorkSize[1], localWorkSize[2]}}, localIdsGenerationByRuntime};
+    uint32_t taskCount = indirectDataOwner ? indirectDataOwner->peekTaskCount() + 1 : 0;
+
+    if (crossThreadDataTracker &&
+        crossThreadDataTracker->reuseIndirectData(ioh, kernel.getCrossThreadData(), sizeCrossThreadData,
+                                                  indirectDataOwner->getTagAddress(), taskCount, indirectDataCopy)) {
+        offsetCrossThreadData = indirectDataCopy.heapOffset + static_cast<size_t>(ioh.getHeapGpuStartOffset());
+        sizePerThreadData = indirectDataCopy.sizePerThreadData;
+        sizePerThreadDataTotal = indirectDataCopy.sizePerThreadDataTotal;
+    } else {
+        offsetCrossThreadData = KernelCommandsHelper<GfxFamily>::sendCrossThreadData(
+            ioh, kernel, inlineDataProgrammingRequired,
+            walkerCmd, sizeCrossThreadData);
+
+        KernelCommandsHelper<GfxFamily>::programPerThreadData(
+            sizePerThreadData,
+            localIdsGenerationByRuntime,
+            ioh,
+            simd,
+            numChannels,
+            localWorkSize,
+            kernel,
+            sizePerThreadDataTotal,
+            localWorkItems);
+
+        if (crossThreadDataTracker) {
+            indirectDataCopy.heapBufferId = ioh.getBufferId();
+            indirectDataCopy.heapOffset = offsetCrossThreadData - static_cast<size_t>(ioh.getHeapGpuStartOffset());
+            indirectDataCopy.sizePerThreadData = sizePerThreadData;
+            indirectDataCopy.sizePerThreadDataTotal = sizePerThreadDataTotal;
+            crossThreadDataTracker->storeIndirectData(indirectDataCopy, kernel.getCrossThreadData(), sizeCrossThreadData,
+                                                      indirectDataOwner->getTagAddress(), taskCount);
+        }
+    }
 
     uint64_t offsetInterfaceDescriptor = offsetInterfaceDescriptorTable + interfaceDescriptorIndex * sizeof(INTERFACE_DESCRIPTOR_DATA);
     DEBUG_BREAK_IF(patchInfo.executionEnvironment == nullptr);
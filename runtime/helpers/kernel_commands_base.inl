@@ -117,7 +117,8 @@ void KernelCommandsHelper<GfxFamily>::programPerThreadData(
         numChannels,
         localWorkSize,
         kernel.getKernelInfo().workgroupDimensionsOrder,
-        kernel.usesOnlyImages());
+        kernel.usesOnlyImages(),
+        DebugManager.flags.EnableLocalIdsCache.get() ? &kernel.getLocalIdsCache() : nullptr);
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
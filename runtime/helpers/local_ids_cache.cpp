@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/local_ids_cache.h"
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/helpers/string.h"
+
+#include <mutex>
+
+namespace OCLRT {
+constexpr size_t LocalIdsCache::maxEntriesCount;
+constexpr size_t LocalIdsCache::maxEntrySize;
+
+LocalIdsCache::Entry *LocalIdsCache::findEntry(uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                               const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel) {
+    for (size_t i = 0; i < entriesCount; i++) {
+        auto &entry = entries[i];
+        if (entry.simd == simd && entry.localWorkgroupSize == localWorkgroupSize &&
+            entry.dimensionsOrder == dimensionsOrder && entry.isImageOnlyKernel == isImageOnlyKernel) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void LocalIdsCache::setLocalIds(void *destination, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel) {
+    if (size > maxEntrySize) {
+        generateLocalIDs(destination, simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel);
+        return;
+    }
+
+    {
+        std::unique_lock<SpinLock> lock(cacheLock);
+        auto entry = findEntry(simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel);
+        if (entry && entry->size == size) {
+            entry->lastUsage = ++usageCounter;
+            hitsCount++;
+            memcpy_s(destination, size, entry->localIds.get(), size);
+            return;
+        }
+    }
+
+    generateLocalIDs(destination, simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel);
+
+    std::unique_lock<SpinLock> lock(cacheLock);
+    auto entry = findEntry(simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel);
+    if (entry == nullptr) {
+        if (entriesCount < maxEntriesCount) {
+            entry = &entries[entriesCount++];
+        } else {
+            entry = &entries[0];
+            for (auto &candidate : entries) {
+                if (candidate.lastUsage < entry->lastUsage) {
+                    entry = &candidate;
+                }
+            }
+        }
+    }
+    if (entry->size < size || !entry->localIds) {
+        entry->localIds.reset(new uint8_t[size]);
+    }
+    memcpy_s(entry->localIds.get(), size, destination, size);
+    entry->size = size;
+    entry->simd = simd;
+    entry->localWorkgroupSize = localWorkgroupSize;
+    entry->dimensionsOrder = dimensionsOrder;
+    entry->isImageOnlyKernel = isImageOnlyKernel;
+    entry->lastUsage = ++usageCounter;
+}
+} // namespace OCLRT
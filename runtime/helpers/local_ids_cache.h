@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/utilities/spinlock.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OCLRT {
+
+// Keeps local ID blocks generated for recent dispatch geometries of a kernel,
+// so that repeated dispatches with the same geometry copy them instead of regenerating.
+class LocalIdsCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxEntriesCount = 4;
+    static constexpr size_t maxEntrySize = 16 * 1024;
+
+    void setLocalIds(void *destination, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                     const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel);
+
+    size_t peekEntriesCount() const { return entriesCount; }
+    uint64_t peekHitsCount() const { return hitsCount; }
+
+  protected:
+    struct Entry {
+        std::array<uint16_t, 3> localWorkgroupSize = {};
+        std::array<uint8_t, 3> dimensionsOrder = {};
+        uint16_t simd = 0;
+        bool isImageOnlyKernel = false;
+        uint64_t lastUsage = 0;
+        size_t size = 0;
+        std::unique_ptr<uint8_t[]> localIds;
+    };
+
+    Entry *findEntry(uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
+                     const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel);
+
+    std::array<Entry, maxEntriesCount> entries;
+    size_t entriesCount = 0;
+    uint64_t usageCounter = 0;
+    uint64_t hitsCount = 0;
+    SpinLock cacheLock;
+};
+} // namespace OCLRT
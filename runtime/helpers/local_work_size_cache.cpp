@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/local_work_size_cache.h"
+
+#include <mutex>
+
+namespace OCLRT {
+constexpr size_t LocalWorkSizeCache::maxEntriesCount;
+
+LocalWorkSizeCache::Entry *LocalWorkSizeCache::findEntry(const Key &key) {
+    for (size_t i = 0; i < entriesCount; i++) {
+        if (entries[i].key == key) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+bool LocalWorkSizeCache::findLocalWorkSize(const Key &key, Vec3<size_t> &localWorkSize) {
+    std::unique_lock<SpinLock> lock(cacheLock);
+    auto entry = findEntry(key);
+    if (entry == nullptr) {
+        return false;
+    }
+    entry->lastUsage = ++usageCounter;
+    hitsCount++;
+    localWorkSize = entry->localWorkSize;
+    return true;
+}
+
+void LocalWorkSizeCache::storeLocalWorkSize(const Key &key, const Vec3<size_t> &localWorkSize) {
+    std::unique_lock<SpinLock> lock(cacheLock);
+    auto entry = findEntry(key);
+    if (entry == nullptr) {
+        if (entriesCount < maxEntriesCount) {
+            entry = &entries[entriesCount++];
+        } else {
+            entry = &entries[0];
+            for (auto &candidate : entries) {
+                if (candidate.lastUsage < entry->lastUsage) {
+                    entry = &candidate;
+                }
+            }
+        }
+    }
+    entry->key = key;
+    entry->localWorkSize = localWorkSize;
+    entry->lastUsage = ++usageCounter;
+}
+} // namespace OCLRT
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/utilities/vec.h"
+#include "runtime/utilities/spinlock.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace OCLRT {
+
+// Keeps local work sizes deduced by the driver for recent NULL local size dispatches of a kernel,
+// so that repeated dispatches with the same shape skip the work size search.
+class LocalWorkSizeCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxEntriesCount = 8;
+
+    struct Key {
+        std::array<size_t, 3> gws = {};
+        uint32_t workDim = 0;
+        uint32_t simd = 0;
+        uint32_t maxWorkGroupSize = 0;
+        uint32_t slmTotalSize = 0;
+        bool hasBarriers = false;
+        bool computeWorkSizeND = false;
+        bool computeWorkSizeSquared = false;
+
+        bool operator==(const Key &other) const {
+            return gws == other.gws && workDim == other.workDim && simd == other.simd &&
+                   maxWorkGroupSize == other.maxWorkGroupSize && slmTotalSize == other.slmTotalSize &&
+                   hasBarriers == other.hasBarriers && computeWorkSizeND == other.computeWorkSizeND &&
+                   computeWorkSizeSquared == other.computeWorkSizeSquared;
+        }
+    };
+
+    bool findLocalWorkSize(const Key &key, Vec3<size_t> &localWorkSize);
+    void storeLocalWorkSize(const Key &key, const Vec3<size_t> &localWorkSize);
+
+    size_t peekEntriesCount() const { return entriesCount; }
+    uint64_t peekHitsCount() const { return hitsCount; }
+
+  protected:
+    struct Entry {
+        Key key;
+        Vec3<size_t> localWorkSize = {0, 0, 0};
+        uint64_t lastUsage = 0;
+    };
+
+    Entry *findEntry(const Key &key);
+
+    std::array<Entry, maxEntriesCount> entries;
+    size_t entriesCount = 0;
+    uint64_t usageCounter = 0;
+    uint64_t hitsCount = 0;
+    SpinLock cacheLock;
+};
+} // namespace OCLRT
@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/local_work_size_tuner.h"
+#include "runtime/event/hw_timestamps.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/file_io.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/hw_info.h"
+#include "runtime/program/kernel_info.h"
+#include "runtime/utilities/tag_allocator.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+namespace OCLRT {
+constexpr size_t LocalWorkSizeTuner::maxEntriesCount;
+constexpr size_t LocalWorkSizeTuner::maxCandidatesCount;
+constexpr uint32_t LocalWorkSizeTuner::measurementsPerCandidate;
+
+namespace {
+const char *profileHeader = "lws_profile 1";
+
+size_t largestPowerOfTwoDivisor(size_t workItems, size_t limit) {
+    size_t divisor = 1;
+    while (divisor * 2 <= limit && workItems % (divisor * 2) == 0) {
+        divisor *= 2;
+    }
+    return divisor;
+}
+} // namespace
+
+std::string LocalWorkSizeTuner::getProfileFileName(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo) {
+    Hash hash;
+    hash.update(kernelInfo.name.c_str(), kernelInfo.name.size());
+    hash.update("----", 4);
+    if (kernelInfo.heapInfo.pKernelHeader && kernelInfo.heapInfo.pKernelHeap) {
+        hash.update(reinterpret_cast<const char *>(kernelInfo.heapInfo.pKernelHeap), kernelInfo.heapInfo.pKernelHeader->KernelHeapSize);
+    }
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(hwInfo.pPlatform), sizeof(*hwInfo.pPlatform));
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(hwInfo.pSysInfo), sizeof(*hwInfo.pSysInfo));
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res
+           << ".lws_profile";
+    return stream.str();
+}
+
+std::vector<Vec3<size_t>> LocalWorkSizeTuner::generateCandidates(const Key &key, const Vec3<size_t> &defaultLocalWorkSize) {
+    std::vector<Vec3<size_t>> candidates;
+    candidates.push_back(defaultLocalWorkSize);
+
+    auto addCandidate = [&](const Vec3<size_t> &localWorkSize) {
+        auto groupSize = localWorkSize.x * localWorkSize.y * localWorkSize.z;
+        if (candidates.size() >= maxCandidatesCount || groupSize < key.simd || groupSize > key.maxWorkGroupSize) {
+            return;
+        }
+        if (std::find(candidates.begin(), candidates.end(), localWorkSize) == candidates.end()) {
+            candidates.push_back(localWorkSize);
+        }
+    };
+
+    size_t minGroupSize = std::max(key.simd, 1u);
+    for (size_t groupSize = Math::prevPowerOfTwo(key.maxWorkGroupSize); groupSize >= minGroupSize; groupSize /= 2) {
+        auto x = largestPowerOfTwoDivisor(key.gws[0], groupSize);
+        if (key.workDim == 1) {
+            addCandidate({x, 1, 1});
+            continue;
+        }
+        addCandidate({x, largestPowerOfTwoDivisor(key.gws[1], groupSize / x), 1});
+
+        size_t squareSide = 1;
+        while (squareSide * squareSide * 4 <= groupSize) {
+            squareSide *= 2;
+        }
+        x = largestPowerOfTwoDivisor(key.gws[0], squareSide);
+        addCandidate({x, largestPowerOfTwoDivisor(key.gws[1], groupSize / x), 1});
+    }
+    return candidates;
+}
+
+LocalWorkSizeTuner::LocalWorkSizeTuner(const std::string &profilePath) : profilePath(profilePath) {
+    loadProfile();
+}
+
+LocalWorkSizeTuner::~LocalWorkSizeTuner() {
+    if (profileChanged) {
+        saveProfile();
+    }
+    for (auto &trial : pendingTrials) {
+        trial.timeStamps->returnTag();
+    }
+}
+
+LocalWorkSizeTuner::Entry *LocalWorkSizeTuner::findEntry(const Key &key) {
+    for (size_t i = 0; i < entriesCount; i++) {
+        if (entries[i].key == key) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+LocalWorkSizeTuner::Entry &LocalWorkSizeTuner::obtainEntry(const Key &key) {
+    auto entry = findEntry(key);
+    if (entry) {
+        return *entry;
+    }
+    if (entriesCount < maxEntriesCount) {
+        entry = &entries[entriesCount++];
+    } else {
+        entry = &entries[0];
+        for (auto &candidate : entries) {
+            if (candidate.lastUsage < entry->lastUsage) {
+                entry = &candidate;
+            }
+        }
+    }
+    *entry = Entry();
+    entry->key = key;
+    return *entry;
+}
+
+Vec3<size_t> LocalWorkSizeTuner::selectLocalWorkSize(const Key &key, const Vec3<size_t> &defaultLocalWorkSize, bool &trialRequired) {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    trialRequired = false;
+    profileChanged |= retireCompletedTrialsLocked();
+
+    auto existingEntry = findEntry(key);
+    auto &entry = existingEntry ? *existingEntry : obtainEntry(key);
+    entry.lastUsage = ++usageCounter;
+    if (!existingEntry) {
+        for (auto &localWorkSize : generateCandidates(key, defaultLocalWorkSize)) {
+            Candidate candidate;
+            candidate.localWorkSize = localWorkSize;
+            entry.candidates.push_back(candidate);
+        }
+        if (entry.candidates.size() == 1) {
+            entry.tuned = true;
+            entry.tunedLocalWorkSize = defaultLocalWorkSize;
+        }
+    }
+
+    if (entry.tuned) {
+        return entry.tunedLocalWorkSize;
+    }
+    for (auto &candidate : entry.candidates) {
+        if (candidate.measurementsCount + candidate.inFlightCount < measurementsPerCandidate) {
+            candidate.inFlightCount++;
+            trialRequired = true;
+            return candidate.localWorkSize;
+        }
+    }
+    return defaultLocalWorkSize;
+}
+
+bool LocalWorkSizeTuner::findTunedLocalWorkSize(const Key &key, Vec3<size_t> &localWorkSize) {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    profileChanged |= retireCompletedTrialsLocked();
+    auto entry = findEntry(key);
+    if (entry == nullptr || !entry->tuned) {
+        return false;
+    }
+    entry->lastUsage = ++usageCounter;
+    localWorkSize = entry->tunedLocalWorkSize;
+    return true;
+}
+
+void LocalWorkSizeTuner::addTrial(const Key &key, const Vec3<size_t> &localWorkSize, TagNode<HwTimeStamps> *timeStamps,
+                                  volatile uint32_t *completionTagAddress, uint32_t taskCount) {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    pendingTrials.push_back({key, localWorkSize, timeStamps, completionTagAddress, taskCount});
+}
+
+void LocalWorkSizeTuner::retireCompletedTrials() {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    profileChanged |= retireCompletedTrialsLocked();
+}
+
+void LocalWorkSizeTuner::cancelTrial(const Key &key, const Vec3<size_t> &localWorkSize) {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    auto entry = findEntry(key);
+    if (entry == nullptr) {
+        return;
+    }
+    for (auto &candidate : entry->candidates) {
+        if (candidate.localWorkSize == localWorkSize && candidate.inFlightCount > 0) {
+            candidate.inFlightCount--;
+            return;
+        }
+    }
+}
+
+bool LocalWorkSizeTuner::retireCompletedTrialsLocked() {
+    bool lockedIn = false;
+    for (auto trial = pendingTrials.begin(); trial != pendingTrials.end();) {
+        if (*trial->completionTagAddress < trial->taskCount) {
+            ++trial;
+            continue;
+        }
+        // only the lower dword of context timestamps is stored
+        auto timeStamps = trial->timeStamps->tag;
+        auto duration = static_cast<uint32_t>(timeStamps->ContextEndTS - timeStamps->ContextStartTS);
+        lockedIn |= recordMeasurement(trial->key, trial->localWorkSize, duration);
+        trial->timeStamps->returnTag();
+        trial = pendingTrials.erase(trial);
+    }
+    return lockedIn;
+}
+
+void LocalWorkSizeTuner::addMeasurement(const Key &key, const Vec3<size_t> &localWorkSize, uint64_t duration) {
+    std::unique_lock<SpinLock> lock(tunerLock);
+    profileChanged |= recordMeasurement(key, localWorkSize, duration);
+}
+
+bool LocalWorkSizeTuner::recordMeasurement(const Key &key, const Vec3<size_t> &localWorkSize, uint64_t duration) {
+    auto entry = findEntry(key);
+    if (entry == nullptr || entry->tuned) {
+        return false;
+    }
+
+    const Candidate *fastest = nullptr;
+    bool allMeasured = true;
+    for (auto &candidate : entry->candidates) {
+        if (candidate.localWorkSize == localWorkSize) {
+            if (candidate.inFlightCount > 0) {
+                candidate.inFlightCount--;
+            }
+            candidate.bestDuration = candidate.measurementsCount == 0 ? duration : std::min(candidate.bestDuration, duration);
+            candidate.measurementsCount++;
+        }
+        allMeasured &= candidate.measurementsCount >= measurementsPerCandidate;
+        if (fastest == nullptr || candidate.bestDuration < fastest->bestDuration) {
+            fastest = &candidate;
+        }
+    }
+    if (!allMeasured || fastest == nullptr) {
+        return false;
+    }
+
+    entry->tunedLocalWorkSize = fastest->localWorkSize;
+    entry->tuned = true;
+    entry->candidates.clear();
+    return true;
+}
+
+bool LocalWorkSizeTuner::loadProfile() {
+    if (profilePath.empty()) {
+        return false;
+    }
+    void *data = nullptr;
+    auto dataSize = loadDataFromFile(profilePath.c_str(), data);
+    if (dataSize == 0) {
+        deleteDataReadFromFile(data);
+        return false;
+    }
+    std::istringstream stream(std::string(reinterpret_cast<const char *>(data), dataSize));
+    deleteDataReadFromFile(data);
+
+    std::string line;
+    if (!std::getline(stream, line) || line != profileHeader) {
+        return false;
+    }
+
+    std::unique_lock<SpinLock> lock(tunerLock);
+    while (std::getline(stream, line)) {
+        std::istringstream lineStream(line);
+        Key key;
+        Vec3<size_t> localWorkSize = {0, 0, 0};
+        lineStream >> key.gws[0] >> key.gws[1] >> key.gws[2] >> key.workDim >> key.simd >> key.maxWorkGroupSize >> key.slmTotalSize >>
+            key.hasBarriers >> key.computeWorkSizeND >> key.computeWorkSizeSquared >> localWorkSize.x >> localWorkSize.y >> localWorkSize.z;
+        if (lineStream.fail() || localWorkSize.x * localWorkSize.y * localWorkSize.z == 0) {
+            continue;
+        }
+        auto &entry = obtainEntry(key);
+        entry.tunedLocalWorkSize = localWorkSize;
+        entry.tuned = true;
+        entry.lastUsage = ++usageCounter;
+    }
+    return true;
+}
+
+bool LocalWorkSizeTuner::saveProfile() {
+    if (profilePath.empty()) {
+        return false;
+    }
+    std::string profile;
+    {
+        std::unique_lock<SpinLock> lock(tunerLock);
+        profile = serializeProfileLocked();
+        profileChanged = false;
+    }
+    // file is written outside of the lock, enqueues selecting local work sizes are not stalled by it
+    return writeDataToFile(profilePath.c_str(), profile.c_str(), profile.size()) == profile.size();
+}
+
+std::string LocalWorkSizeTuner::serializeProfileLocked() const {
+    std::stringstream stream;
+    stream << profileHeader << "\n";
+    for (size_t i = 0; i < entriesCount; i++) {
+        auto &entry = entries[i];
+        if (!entry.tuned) {
+            continue;
+        }
+        auto &key = entry.key;
+        stream << key.gws[0] << " " << key.gws[1] << " " << key.gws[2] << " " << key.workDim << " " << key.simd << " "
+               << key.maxWorkGroupSize << " " << key.slmTotalSize << " " << key.hasBarriers << " " << key.computeWorkSizeND << " "
+               << key.computeWorkSizeSquared << " " << entry.tunedLocalWorkSize.x << " " << entry.tunedLocalWorkSize.y << " "
+               << entry.tunedLocalWorkSize.z << "\n";
+    }
+    return stream.str();
+}
+} // namespace OCLRT
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/local_work_size_cache.h"
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/utilities/spinlock.h"
+#include "runtime/utilities/vec.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+struct HardwareInfo;
+struct HwTimeStamps;
+struct KernelInfo;
+template <typename TagType>
+struct TagNode;
+
+// Picks local work sizes for NULL local size dispatches of a kernel by measurement.
+// First launches of a given shape try candidate local work sizes with hardware timestamps attached,
+// the fastest candidate is locked in afterwards and saved to a profile file when the tuner is destroyed, so that next runs start tuned.
+class LocalWorkSizeTuner : NonCopyableOrMovableClass {
+  public:
+    using Key = LocalWorkSizeCache::Key;
+
+    static constexpr size_t maxEntriesCount = 16;
+    static constexpr size_t maxCandidatesCount = 8;
+    static constexpr uint32_t measurementsPerCandidate = 2;
+
+    static std::string getProfileFileName(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo);
+    static std::vector<Vec3<size_t>> generateCandidates(const Key &key, const Vec3<size_t> &defaultLocalWorkSize);
+
+    LocalWorkSizeTuner(const std::string &profilePath);
+    ~LocalWorkSizeTuner();
+
+    // Returns local work size to use for the next dispatch, trialRequired is set when its duration should be measured.
+    Vec3<size_t> selectLocalWorkSize(const Key &key, const Vec3<size_t> &defaultLocalWorkSize, bool &trialRequired);
+    bool findTunedLocalWorkSize(const Key &key, Vec3<size_t> &localWorkSize);
+
+    // Takes ownership of timeStamps node, it is returned once the trial is retired.
+    void addTrial(const Key &key, const Vec3<size_t> &localWorkSize, TagNode<HwTimeStamps> *timeStamps,
+                  volatile uint32_t *completionTagAddress, uint32_t taskCount);
+    void retireCompletedTrials();
+    // Releases candidate reserved by selectLocalWorkSize when its dispatch is not measured.
+    void cancelTrial(const Key &key, const Vec3<size_t> &localWorkSize);
+    void addMeasurement(const Key &key, const Vec3<size_t> &localWorkSize, uint64_t duration);
+
+    bool loadProfile();
+    bool saveProfile();
+
+    const std::string &getProfilePath() const { return profilePath; }
+    size_t peekEntriesCount() const { return entriesCount; }
+    size_t peekPendingTrialsCount() const { return pendingTrials.size(); }
+
+  protected:
+    struct Candidate {
+        Vec3<size_t> localWorkSize = {0, 0, 0};
+        uint64_t bestDuration = 0;
+        uint32_t measurementsCount = 0;
+        uint32_t inFlightCount = 0;
+    };
+
+    struct Entry {
+        Key key;
+        std::vector<Candidate> candidates;
+        Vec3<size_t> tunedLocalWorkSize = {0, 0, 0};
+        bool tuned = false;
+        uint64_t lastUsage = 0;
+    };
+
+    struct PendingTrial {
+        Key key;
+        Vec3<size_t> localWorkSize;
+        TagNode<HwTimeStamps> *timeStamps;
+        volatile uint32_t *completionTagAddress;
+        uint32_t taskCount;
+    };
+
+    Entry *findEntry(const Key &key);
+    Entry &obtainEntry(const Key &key);
+    bool retireCompletedTrialsLocked();
+    bool recordMeasurement(const Key &key, const Vec3<size_t> &localWorkSize, uint64_t duration);
+    std::string serializeProfileLocked() const;
+
+    std::string profilePath;
+    std::array<Entry, maxEntriesCount> entries;
+    size_t entriesCount = 0;
+    uint64_t usageCounter = 0;
+    std::vector<PendingTrial> pendingTrials;
+    bool profileChanged = false;
+    SpinLock tunerLock;
+};
+} // namespace OCLRT
@@ -7,6 +7,7 @@
 
 #include "runtime/command_stream/linear_stream.h"
 #include "runtime/helpers/debug_helpers.h"
+#include "runtime/helpers/local_ids_cache.h"
 #include "runtime/helpers/per_thread_data.h"
 
 #include <array>
@@ -19,7 +20,8 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const size_t localWorkSizes[3],
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    LocalIdsCache *localIdsCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         auto localWorkSize = localWorkSizes[0] * localWorkSizes[1] * localWorkSizes[2];
@@ -28,12 +30,15 @@ size_t PerThreadDataHelper::sendPerThreadData(
 
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
-        generateLocalIDs(pDest, static_cast<uint16_t>(simd),
-                         std::array<uint16_t, 3>{{static_cast<uint16_t>(localWorkSizes[0]),
-                                                  static_cast<uint16_t>(localWorkSizes[1]),
-                                                  static_cast<uint16_t>(localWorkSizes[2])}},
-                         std::array<uint8_t, 3>{{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}},
-                         hasKernelOnlyImages);
+        std::array<uint16_t, 3> localWorkgroupSize{{static_cast<uint16_t>(localWorkSizes[0]),
+                                                    static_cast<uint16_t>(localWorkSizes[1]),
+                                                    static_cast<uint16_t>(localWorkSizes[2])}};
+        std::array<uint8_t, 3> dimensionsOrder{{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}};
+        if (localIdsCache) {
+            localIdsCache->setLocalIds(pDest, sizePerThreadDataTotal, static_cast<uint16_t>(simd), localWorkgroupSize, dimensionsOrder, hasKernelOnlyImages);
+        } else {
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkgroupSize, dimensionsOrder, hasKernelOnlyImages);
+        }
     }
     return offsetPerThreadData;
 }
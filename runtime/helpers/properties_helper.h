@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,11 +9,13 @@
 
 #include "runtime/api/cl_types.h"
 #include <array>
+#include <memory>
 #include <unordered_set>
 
 namespace OCLRT {
 class MemObj;
 class Buffer;
+class PageWriteTracker;
 
 enum class QueueThrottle {
     LOW,
@@ -57,6 +59,9 @@ struct TransferProperties {
     void *ptr = nullptr;
     uint32_t mipLevel = 0;
     uint32_t mipPtrOffset = 0;
+    size_t hostRowPitch = 0;
+    size_t hostSlicePitch = 0;
+    size_t patternSize = 0;
 
     void *lockedPtr = nullptr;
     void *getCpuPtrForReadWrite();
@@ -74,6 +79,7 @@ struct MapInfo {
     MemObjOffsetArray offset = {};
     bool readOnly = false;
     uint32_t mipLevel = 0;
+    std::shared_ptr<PageWriteTracker> writeTracker;
 };
 
 class NonCopyableOrMovableClass {
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/strided_copy.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCLRT {
+namespace {
+template <size_t rowSize>
+void copyFixedSizeRows(void *destination, size_t destinationRowPitch, const void *source, size_t sourceRowPitch, size_t rowsCount) {
+    auto dst = reinterpret_cast<char *>(destination);
+    auto src = reinterpret_cast<const char *>(source);
+    for (size_t row = 0; row < rowsCount; row++) {
+        // constant size lets the compiler emit plain register moves
+        std::memcpy(dst, src, rowSize);
+        dst += destinationRowPitch;
+        src += sourceRowPitch;
+    }
+}
+
+void copyRows(void *destination, size_t destinationRowPitch, const void *source, size_t sourceRowPitch, size_t rowSize, size_t rowsCount) {
+    switch (rowSize) {
+    case 1:
+        return copyFixedSizeRows<1>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    case 2:
+        return copyFixedSizeRows<2>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    case 4:
+        return copyFixedSizeRows<4>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    case 8:
+        return copyFixedSizeRows<8>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    case 16:
+        return copyFixedSizeRows<16>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    case 32:
+        return copyFixedSizeRows<32>(destination, destinationRowPitch, source, sourceRowPitch, rowsCount);
+    default:
+        break;
+    }
+    for (size_t row = 0; row < rowsCount; row++) {
+        memcpy_s(ptrOffset(destination, row * destinationRowPitch), rowSize, ptrOffset(source, row * sourceRowPitch), rowSize);
+    }
+}
+
+void copySlices(void *destination, size_t destinationRowPitch, size_t destinationSlicePitch,
+                const void *source, size_t sourceRowPitch, size_t sourceSlicePitch,
+                size_t rowSize, size_t rowsCount, size_t firstSlice, size_t slicesCount) {
+    for (size_t slice = firstSlice; slice < firstSlice + slicesCount; slice++) {
+        copyRows(ptrOffset(destination, slice * destinationSlicePitch), destinationRowPitch,
+                 ptrOffset(source, slice * sourceSlicePitch), sourceRowPitch, rowSize, rowsCount);
+    }
+}
+} // namespace
+
+void copyStrided(void *destination, size_t destinationRowPitch, size_t destinationSlicePitch,
+                 const void *source, size_t sourceRowPitch, size_t sourceSlicePitch,
+                 size_t rowSize, size_t rowsCount, size_t slicesCount, CpuCopyEngine *cpuCopyEngine) {
+    if (rowSize == 0 || rowsCount == 0 || slicesCount == 0) {
+        return;
+    }
+
+    if (rowsCount == 1 || (sourceRowPitch == rowSize && destinationRowPitch == rowSize)) {
+        // rows are contiguous, each slice is a single row
+        rowSize *= rowsCount;
+        rowsCount = slicesCount;
+        sourceRowPitch = sourceSlicePitch;
+        destinationRowPitch = destinationSlicePitch;
+        slicesCount = 1;
+        if (rowsCount == 1 || (sourceRowPitch == rowSize && destinationRowPitch == rowSize)) {
+            rowSize *= rowsCount;
+            rowsCount = 1;
+        }
+    }
+
+    if (rowsCount == 1) {
+        if (cpuCopyEngine) {
+            cpuCopyEngine->copy(destination, source, rowSize);
+        } else {
+            memcpy_s(destination, rowSize, source, rowSize);
+        }
+        return;
+    }
+
+    auto totalSize = rowSize * rowsCount * slicesCount;
+    size_t tasksCount = 1;
+    if (cpuCopyEngine) {
+        tasksCount = std::min(static_cast<size_t>(cpuCopyEngine->getWorkersCount()) + 1, totalSize / CpuCopyEngine::minChunkSize);
+    }
+    if (tasksCount <= 1) {
+        copySlices(destination, destinationRowPitch, destinationSlicePitch, source, sourceRowPitch, sourceSlicePitch,
+                   rowSize, rowsCount, 0, slicesCount);
+        return;
+    }
+
+    if (slicesCount >= tasksCount) {
+        auto slicesPerTask = (slicesCount + tasksCount - 1) / tasksCount;
+        cpuCopyEngine->execute((slicesCount + slicesPerTask - 1) / slicesPerTask, [&](size_t task) {
+            auto firstSlice = task * slicesPerTask;
+            copySlices(destination, destinationRowPitch, destinationSlicePitch, source, sourceRowPitch, sourceSlicePitch,
+                       rowSize, rowsCount, firstSlice, std::min(slicesPerTask, slicesCount - firstSlice));
+        });
+        return;
+    }
+
+    // few large slices, split rows of each slice
+    auto rowsPerTask = (rowsCount * slicesCount + tasksCount - 1) / tasksCount;
+    rowsPerTask = std::min(rowsPerTask, rowsCount);
+    auto tasksPerSlice = (rowsCount + rowsPerTask - 1) / rowsPerTask;
+    cpuCopyEngine->execute(tasksPerSlice * slicesCount, [&](size_t task) {
+        auto slice = task / tasksPerSlice;
+        auto firstRow = (task % tasksPerSlice) * rowsPerTask;
+        copyRows(ptrOffset(destination, slice * destinationSlicePitch + firstRow * destinationRowPitch), destinationRowPitch,
+                 ptrOffset(source, slice * sourceSlicePitch + firstRow * sourceRowPitch), sourceRowPitch,
+                 rowSize, std::min(rowsPerTask, rowsCount - firstRow));
+    });
+}
+} // namespace OCLRT
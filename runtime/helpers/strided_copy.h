@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace OCLRT {
+class CpuCopyEngine;
+
+// Copies slicesCount x rowsCount rows of rowSize bytes between pitched surfaces, pointers point at first row to copy.
+// Contiguous rows and slices are collapsed into longer copies, short rows are copied with fixed-size moves
+// and large volumes are split across cpuCopyEngine workers when it is given.
+void copyStrided(void *destination, size_t destinationRowPitch, size_t destinationSlicePitch,
+                 const void *source, size_t sourceRowPitch, size_t sourceSlicePitch,
+                 size_t rowSize, size_t rowsCount, size_t slicesCount, CpuCopyEngine *cpuCopyEngine);
+} // namespace OCLRT
@@ -9,6 +9,7 @@
 #include "runtime/command_stream/linear_stream.h"
 #include "runtime/indirect_heap/indirect_heap.h"
 #include "runtime/utilities/iflist.h"
+#include "runtime/utilities/object_pool.h"
 #include "runtime/helpers/completion_stamp.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/properties_helper.h"
@@ -41,6 +42,10 @@ class Command : public IFNode<Command> {
     virtual CompletionStamp &submit(uint32_t taskLevel, bool terminated) = 0;
 
     virtual ~Command() = default;
+
+    static void *operator new(size_t size) { return PooledObjects::allocate(size); }
+    static void operator delete(void *ptr) { PooledObjects::free(ptr); }
+
     virtual LinearStream *getCommandStream() {
         return nullptr;
     }
@@ -75,6 +80,9 @@ struct KernelOperation {
 
     ~KernelOperation();
 
+    static void *operator new(size_t size) { return PooledObjects::allocate(size); }
+    static void operator delete(void *ptr) { PooledObjects::free(ptr); }
+
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<IndirectHeap> dsh;
     std::unique_ptr<IndirectHeap> ioh;
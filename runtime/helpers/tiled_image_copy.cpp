@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/tiled_image_copy.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+namespace {
+template <bool toTiled>
+void copyTileY(void *tiled, size_t tiledRowPitch, size_t tiledQPitch,
+               void *linear, size_t linearRowPitch, size_t linearSlicePitch,
+               const std::array<size_t, 3> &origin, const std::array<size_t, 3> &region) {
+    for (size_t slice = 0; slice < region[2]; slice++) {
+        for (size_t row = 0; row < region[1]; row++) {
+            auto tiledRow = (origin[2] + slice) * tiledQPitch + origin[1] + row;
+            auto linearRow = ptrOffset(linear, slice * linearSlicePitch + row * linearRowPitch);
+            size_t x = 0;
+            while (x < region[0]) {
+                // bytes up to the end of current column are contiguous in the tile
+                auto tiledX = origin[0] + x;
+                auto chunkSize = std::min(region[0] - x, tileYColumnWidth - tiledX % tileYColumnWidth);
+                auto tiledPtr = ptrOffset(tiled, getTileYOffset(tiledX, tiledRow, tiledRowPitch));
+                if (toTiled) {
+                    memcpy_s(tiledPtr, chunkSize, ptrOffset(linearRow, x), chunkSize);
+                } else {
+                    memcpy_s(ptrOffset(linearRow, x), chunkSize, tiledPtr, chunkSize);
+                }
+                x += chunkSize;
+            }
+        }
+    }
+}
+} // namespace
+
+void copyFromTileY(void *destination, size_t destinationRowPitch, size_t destinationSlicePitch,
+                   const void *tiledSource, size_t tiledRowPitch, size_t tiledQPitch,
+                   const std::array<size_t, 3> &origin, const std::array<size_t, 3> &region) {
+    copyTileY<false>(const_cast<void *>(tiledSource), tiledRowPitch, tiledQPitch, destination, destinationRowPitch, destinationSlicePitch, origin, region);
+}
+
+void copyToTileY(void *tiledDestination, size_t tiledRowPitch, size_t tiledQPitch,
+                 const void *source, size_t sourceRowPitch, size_t sourceSlicePitch,
+                 const std::array<size_t, 3> &origin, const std::array<size_t, 3> &region) {
+    copyTileY<true>(tiledDestination, tiledRowPitch, tiledQPitch, const_cast<void *>(source), sourceRowPitch, sourceSlicePitch, origin, region);
+}
+} // namespace OCLRT
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+
+namespace OCLRT {
+// Y-major tile is 128 bytes x 32 rows, stored as 16-byte wide columns of 32 rows each
+constexpr size_t tileYWidthInBytes = 128;
+constexpr size_t tileYHeight = 32;
+constexpr size_t tileYColumnWidth = 16;
+constexpr size_t tileYSize = tileYWidthInBytes * tileYHeight;
+
+// Offset of byte x in row y of a Y-major tiled surface, rowPitch is a multiple of tileYWidthInBytes
+inline size_t getTileYOffset(size_t x, size_t y, size_t rowPitch) {
+    auto tileOffset = ((y / tileYHeight) * (rowPitch / tileYWidthInBytes) + x / tileYWidthInBytes) * tileYSize;
+    auto xInTile = x % tileYWidthInBytes;
+    return tileOffset + (xInTile / tileYColumnWidth) * tileYColumnWidth * tileYHeight + (y % tileYHeight) * tileYColumnWidth + xInTile % tileYColumnWidth;
+}
+
+// origin and region are given as {bytes, rows, slices}, slices of tiled surface are qPitch rows apart
+void copyFromTileY(void *destination, size_t destinationRowPitch, size_t destinationSlicePitch,
+                   const void *tiledSource, size_t tiledRowPitch, size_t tiledQPitch,
+                   const std::array<size_t, 3> &origin, const std::array<size_t, 3> &region);
+void copyToTileY(void *tiledDestination, size_t tiledRowPitch, size_t tiledQPitch,
+                 const void *source, size_t sourceRowPitch, size_t sourceSlicePitch,
+                 const std::array<size_t, 3> &origin, const std::array<size_t, 3> &region);
+} // namespace OCLRT
@@ -11,6 +11,7 @@
 #include "runtime/built_ins/built_ins.h"
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/compiler_interface/binary_cache.h"
 #include "runtime/context/context.h"
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/execution_model/device_enqueue.h"
@@ -35,6 +36,7 @@
 #include "runtime/program/printf_handler.h"
 #include "runtime/sampler/sampler.h"
 #include "patch_list.h"
+#include "os_inc.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -357,6 +359,11 @@ cl_int Kernel::initialize() {
 
         reconfigureKernel();
 
+        if (DebugManager.flags.EnableLocalWorkSizeTuning.get()) {
+            auto profileFileName = LocalWorkSizeTuner::getProfileFileName(kernelInfo, device.getHardwareInfo());
+            localWorkSizeTuner.reset(new LocalWorkSizeTuner(BinaryCache::getCacheLocation() + PATH_SEPARATOR + profileFileName));
+        }
+
         retVal = CL_SUCCESS;
 
     } while (false);
@@ -12,6 +12,10 @@
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/preamble.h"
 #include "runtime/helpers/address_patch.h"
+#include "runtime/helpers/cross_thread_data_tracker.h"
+#include "runtime/helpers/local_ids_cache.h"
+#include "runtime/helpers/local_work_size_cache.h"
+#include "runtime/helpers/local_work_size_tuner.h"
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/program/program.h"
 #include "runtime/program/kernel_info.h"
@@ -372,6 +376,11 @@ class Kernel : public BaseObject<_cl_kernel> {
         return usingImagesOnly;
     }
 
+    CrossThreadDataTracker &getCrossThreadDataTracker() { return crossThreadDataTracker; }
+    LocalIdsCache &getLocalIdsCache() { return localIdsCache; }
+    LocalWorkSizeCache &getLocalWorkSizeCache() { return localWorkSizeCache; }
+    LocalWorkSizeTuner *getLocalWorkSizeTuner() const { return localWorkSizeTuner.get(); }
+
     void fillWithBuffersForAuxTranslation(MemObjsForAuxTranslation &memObjsForAuxTranslation);
 
     bool requiresCacheFlushCommand() const;
@@ -500,5 +509,9 @@ class Kernel : public BaseObject<_cl_kernel> {
     bool specialPipelineSelectMode = false;
     bool svmAllocationsRequireCacheFlush = false;
     std::vector<GraphicsAllocation *> kernelArgRequiresCacheFlush;
+    LocalIdsCache localIdsCache;
+    LocalWorkSizeCache localWorkSizeCache;
+    std::unique_ptr<LocalWorkSizeTuner> localWorkSizeTuner;
+    CrossThreadDataTracker crossThreadDataTracker;
 };
 } // namespace OCLRT
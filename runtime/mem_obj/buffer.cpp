@@ -7,10 +7,12 @@
 
 #include "common/helpers/bit_helpers.h"
 #include "runtime/mem_obj/buffer.h"
+#include "runtime/mem_obj/buffer_suballocator.h"
 #include "runtime/mem_obj/mem_obj_helper.h"
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/gmm_helper/gmm.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/aligned_memory.h"
@@ -19,10 +21,12 @@
 #include "runtime/helpers/ptr_math.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/validators.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/host_ptr_manager.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/svm_memory_manager.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/utilities/metrics_registry.h"
 
 namespace OCLRT {
 
@@ -54,7 +58,16 @@ Buffer::Buffer(Context *context,
 Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, 0, 0, nullptr, nullptr, nullptr, false, false, false) {
 }
 
-Buffer::~Buffer() = default;
+Buffer::~Buffer() {
+    if (suballocationSize != 0) {
+        // the range itself is released lazily, but map storage and destructor callbacks need completed work
+        if ((getAllocatedMapPtr() || !destructorCallbacks.empty()) && graphicsAllocation->isUsed()) {
+            waitForCsrCompletion();
+        }
+        context->getBufferSuballocator().free({graphicsAllocation, offset, suballocationSize});
+        graphicsAllocation = nullptr;
+    }
+}
 
 bool Buffer::isSubBuffer() {
     return this->associatedMemObject != nullptr;
@@ -199,13 +212,20 @@ Buffer *Buffer::create(Context *context,
         context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_GOOD_INTEL, CL_BUFFER_NEEDS_ALLOCATE_MEMORY);
     }
 
+    BufferSuballocator::Suballocation suballocation;
+    if (!memory && allocateMemory && allocationType != GraphicsAllocation::AllocationType::BUFFER_COMPRESSED &&
+        BufferSuballocator::isSuballocationAllowed(properties, size, context->isSharedContext)) {
+        suballocation = context->getBufferSuballocator().allocate(size);
+        memory = suballocation.backingAllocation;
+    }
+
     if (!memory) {
         AllocationProperties allocProperties = MemObjHelper::getAllocationProperties(properties.flags_intel, allocateMemory, size, allocationType);
         DevicesBitfield devices = MemObjHelper::getDevicesBitfield(properties);
         memory = memoryManager->allocateGraphicsMemoryInPreferredPool(allocProperties, devices, hostPtr);
     }
 
-    if (allocateMemory && memory && MemoryPool::isSystemMemoryPool(memory->getMemoryPool())) {
+    if (allocateMemory && memory && !suballocation.backingAllocation && MemoryPool::isSystemMemoryPool(memory->getMemoryPool())) {
         memoryManager->addAllocationToHostPtrManager(memory);
     }
 
@@ -233,15 +253,18 @@ Buffer *Buffer::create(Context *context,
         allocationType = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
     }
 
-    memory->setAllocationType(allocationType);
-    memory->setMemObjectsAllocationWithWritableFlags(!(properties.flags & (CL_MEM_READ_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS)));
+    // backing allocation of suballocated buffers is shared and keeps its own type and flags
+    if (!suballocation.backingAllocation) {
+        memory->setAllocationType(allocationType);
+        memory->setMemObjectsAllocationWithWritableFlags(!(properties.flags & (CL_MEM_READ_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS)));
+    }
 
     DBG_LOG(LogMemoryObject, __FUNCTION__, "hostPtr:", hostPtr, "size:", size, "memoryStorage:", memory->getUnderlyingBuffer(), "GPU address:", std::hex, memory->getGpuAddress());
 
     pBuffer = createBufferHw(context,
                              properties.flags,
                              size,
-                             memory->getUnderlyingBuffer(),
+                             ptrOffset(memory->getUnderlyingBuffer(), suballocation.offset),
                              hostPtr,
                              memory,
                              zeroCopyAllowed,
@@ -249,12 +272,18 @@ Buffer *Buffer::create(Context *context,
                              false);
     if (!pBuffer) {
         errcodeRet = CL_OUT_OF_HOST_MEMORY;
-        memoryManager->removeAllocationFromHostPtrManager(memory);
-        memoryManager->freeGraphicsMemory(memory);
+        if (suballocation.backingAllocation) {
+            context->getBufferSuballocator().free(suballocation);
+        } else {
+            memoryManager->removeAllocationFromHostPtrManager(memory);
+            memoryManager->freeGraphicsMemory(memory);
+        }
         return nullptr;
     }
 
     pBuffer->setHostPtrMinSize(size);
+    pBuffer->offset = suballocation.offset;
+    pBuffer->suballocationSize = suballocation.size;
 
     if (copyMemoryFromHostPtr) {
         if ((memory->gmm && memory->gmm->isRenderCompressed) || !MemoryPool::isSystemMemoryPool(memory->getMemoryPool())) {
@@ -263,7 +292,7 @@ Buffer *Buffer::create(Context *context,
                 errcodeRet = CL_OUT_OF_RESOURCES;
             }
         } else {
-            memcpy_s(memory->getUnderlyingBuffer(), size, hostPtr, size);
+            memcpy_s(pBuffer->getCpuAddress(), size, hostPtr, size);
         }
     }
 
@@ -377,7 +406,7 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     }
 
     buffer->associatedMemObject = this;
-    buffer->offset = region->origin;
+    buffer->offset = this->offset + region->origin;
     buffer->setParentSharingHandler(this->getSharingHandler());
     this->incRefInternal();
 
@@ -431,6 +460,12 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
+    MetricsRegistry::increment(MetricCounter::CpuCopiedBytes, copySize);
+    auto cpuCopyEngine = memoryManager ? memoryManager->peekExecutionEnvironment().getCpuCopyEngine() : nullptr;
+    if (cpuCopyEngine) {
+        cpuCopyEngine->copy(dstPtr, srcPtr, copySize);
+        return;
+    }
     memcpy_s(dstPtr, copySize, srcPtr, copySize);
 }
 
@@ -457,6 +492,14 @@ bool Buffer::isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitLi
            MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
 }
 
+bool Buffer::isFillOnCpuAllowed(cl_uint numEventsInWaitList, size_t size) {
+    return DebugManager.flags.EnableCpuFillBuffer.get() && numEventsInWaitList == 0 && !forceDisallowCPUCopy &&
+           isMemObjZeroCopy() && graphicsAllocation->peekSharedHandle() == 0 && !graphicsAllocation->isUsedByManyOsContexts() &&
+           (!context->getDevice(0)->getDeviceInfo().platformLP || (size <= maxBufferSizeForReadWriteOnCpu)) &&
+           !(graphicsAllocation->gmm && graphicsAllocation->gmm->isRenderCompressed) &&
+           MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
+}
+
 Buffer *Buffer::createBufferHw(Context *context,
                                cl_mem_flags flags,
                                size_t size,
@@ -118,6 +118,7 @@ class Buffer : public MemObj {
     void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
 
     bool isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, void *ptr, size_t size);
+    bool isFillOnCpuAllowed(cl_uint numEventsInWaitList, size_t size);
 
   protected:
     Buffer(Context *context,
@@ -145,6 +146,9 @@ class Buffer : public MemObj {
     static bool isReadOnlyMemoryPermittedByFlags(cl_mem_flags flags);
 
     void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+
+    // non-zero when the buffer owns a range of a backing allocation shared with other buffers
+    size_t suballocationSize = 0;
 };
 
 template <typename GfxFamily>
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "common/helpers/bit_helpers.h"
+#include "runtime/mem_obj/buffer_suballocator.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/mem_obj/mem_obj_helper.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/os_interface/os_context.h"
+#include "runtime/utilities/heap_allocator.h"
+
+namespace OCLRT {
+constexpr size_t BufferSuballocator::maxSuballocationSize;
+constexpr size_t BufferSuballocator::backingAllocationSize;
+constexpr size_t BufferSuballocator::suballocationAlignment;
+
+// ranges are tracked as addresses in [heapBase, heapBase + backingAllocationSize), zero is reserved for failures
+static constexpr uint64_t heapBase = BufferSuballocator::backingAllocationSize;
+
+class SuballocationHeap : public HeapAllocator {
+  public:
+    SuballocationHeap() : HeapAllocator(heapBase, BufferSuballocator::backingAllocationSize, 4 * MemoryConstants::kiloByte) {
+        allocationAlignment = BufferSuballocator::suballocationAlignment;
+    }
+};
+
+BufferSuballocator::BufferSuballocator(MemoryManager &memoryManager) : memoryManager(memoryManager) {
+}
+
+BufferSuballocator::~BufferSuballocator() {
+    for (auto &backingAllocation : backingAllocations) {
+        memoryManager.removeAllocationFromHostPtrManager(backingAllocation.allocation);
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(backingAllocation.allocation);
+    }
+}
+
+bool BufferSuballocator::isSuballocationAllowed(const MemoryProperties &properties, size_t size, bool sharedContext) {
+    return DebugManager.flags.EnableBufferSuballocation.get() &&
+           size <= maxSuballocationSize &&
+           !sharedContext &&
+           properties.flags_intel == 0 &&
+           !isValueSet(properties.flags, CL_MEM_USE_HOST_PTR);
+}
+
+BufferSuballocator::Suballocation BufferSuballocator::allocate(size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    releaseCompletedFrees();
+
+    Suballocation suballocation;
+    for (size_t i = 0; i <= backingAllocations.size(); i++) {
+        if (i == backingAllocations.size() && !addBackingAllocation()) {
+            break;
+        }
+        size_t sizeToAllocate = size;
+        auto address = backingAllocations[i].heap->allocate(sizeToAllocate);
+        if (address != 0llu) {
+            suballocation.backingAllocation = backingAllocations[i].allocation;
+            suballocation.offset = static_cast<size_t>(address - heapBase);
+            suballocation.size = sizeToAllocate;
+            break;
+        }
+    }
+    return suballocation;
+}
+
+void BufferSuballocator::free(const Suballocation &suballocation) {
+    PendingFree pendingFree;
+    pendingFree.suballocation = suballocation;
+
+    auto allocation = suballocation.backingAllocation;
+    if (allocation->isUsed()) {
+        for (auto &deviceCsrs : memoryManager.getCommandStreamReceivers()) {
+            for (auto &csr : deviceCsrs) {
+                auto osContextId = csr->getOsContext().getContextId();
+                auto allocationTaskCount = allocation->getTaskCount(osContextId);
+                if (allocation->isUsedByOsContext(osContextId) && allocationTaskCount > *csr->getTagAddress()) {
+                    pendingFree.completionTaskCounts.emplace_back(csr.get(), allocationTaskCount);
+                }
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (pendingFree.completionTaskCounts.empty()) {
+        releaseRange(suballocation);
+    } else {
+        pendingFrees.push_back(std::move(pendingFree));
+    }
+}
+
+bool BufferSuballocator::addBackingAllocation() {
+    auto allocation = memoryManager.allocateGraphicsMemoryInPreferredPool(AllocationProperties(backingAllocationSize, GraphicsAllocation::AllocationType::BUFFER), 0u, nullptr);
+    if (!allocation) {
+        return false;
+    }
+    if (MemoryPool::isSystemMemoryPool(allocation->getMemoryPool())) {
+        memoryManager.addAllocationToHostPtrManager(allocation);
+        allocation->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY);
+    }
+    allocation->setMemObjectsAllocationWithWritableFlags(true);
+    backingAllocations.push_back({allocation, std::make_unique<SuballocationHeap>()});
+    return true;
+}
+
+void BufferSuballocator::releaseRange(const Suballocation &suballocation) {
+    for (auto &backingAllocation : backingAllocations) {
+        if (backingAllocation.allocation == suballocation.backingAllocation) {
+            backingAllocation.heap->free(heapBase + suballocation.offset, suballocation.size);
+            return;
+        }
+    }
+    DEBUG_BREAK_IF(true);
+}
+
+void BufferSuballocator::releaseCompletedFrees() {
+    auto isCompleted = [](const PendingFree &pendingFree) {
+        for (auto &completionTaskCount : pendingFree.completionTaskCounts) {
+            if (*completionTaskCount.first->getTagAddress() < completionTaskCount.second) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (auto it = pendingFrees.begin(); it != pendingFrees.end();) {
+        if (isCompleted(*it)) {
+            releaseRange(it->suballocation);
+            it = pendingFrees.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+} // namespace OCLRT
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace OCLRT {
+class CommandStreamReceiver;
+class GraphicsAllocation;
+class MemoryManager;
+class SuballocationHeap;
+struct MemoryProperties;
+
+// Serves small buffers from ranges of larger backing allocations shared by many buffers,
+// so they are made resident and put on exec lists once. Enabled with EnableBufferSuballocation.
+class BufferSuballocator : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxSuballocationSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t backingAllocationSize = 2 * MemoryConstants::megaByte;
+    // CL_DEVICE_MEM_BASE_ADDR_ALIGN is reported as 1024 bits
+    static constexpr size_t suballocationAlignment = 128;
+
+    struct Suballocation {
+        GraphicsAllocation *backingAllocation = nullptr;
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+    BufferSuballocator(MemoryManager &memoryManager);
+    ~BufferSuballocator();
+
+    static bool isSuballocationAllowed(const MemoryProperties &properties, size_t size, bool sharedContext);
+
+    Suballocation allocate(size_t size);
+    // range is reused only after all engines complete work submitted with the backing allocation so far
+    void free(const Suballocation &suballocation);
+
+    size_t peekBackingAllocationsCount() const { return backingAllocations.size(); }
+    size_t peekPendingFreesCount() const { return pendingFrees.size(); }
+
+  protected:
+    struct BackingAllocation {
+        GraphicsAllocation *allocation;
+        std::unique_ptr<SuballocationHeap> heap;
+    };
+
+    struct PendingFree {
+        Suballocation suballocation;
+        std::vector<std::pair<CommandStreamReceiver *, uint32_t>> completionTaskCounts;
+    };
+
+    bool addBackingAllocation();
+    void releaseRange(const Suballocation &suballocation);
+    void releaseCompletedFrees();
+
+    MemoryManager &memoryManager;
+    std::vector<BackingAllocation> backingAllocations;
+    std::vector<PendingFree> pendingFrees;
+    std::mutex mtx;
+};
+} // namespace OCLRT
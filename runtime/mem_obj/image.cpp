@@ -11,6 +11,7 @@
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/gmm_helper/gmm.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/gmm_helper/resource_info.h"
@@ -20,8 +21,10 @@
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/mipmap.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/strided_copy.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/surface_formats.h"
+#include "runtime/helpers/tiled_image_copy.h"
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/mem_obj_helper.h"
 #include "runtime/memory_manager/memory_manager.h"
@@ -32,6 +35,9 @@ namespace OCLRT {
 
 ImageFuncs imageFactory[IGFX_MAX_CORE] = {};
 
+// RENDER_SURFACE_STATE::TILE_MODE_YMAJOR, same value on all supported gens
+constexpr uint32_t tileModeSurfaceStateYMajor = 0x3;
+
 Image::Image(Context *context,
              cl_mem_flags flags,
              size_t size,
@@ -87,18 +93,12 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
-
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
+    auto srcStart = ptrOffset(src, srcSlicePitch * copyOrigin[2] + srcRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
+    auto dstStart = ptrOffset(dest, destSlicePitch * copyOrigin[2] + destRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
+    auto cpuCopyEngine = memoryManager ? memoryManager->peekExecutionEnvironment().getCpuCopyEngine() : nullptr;
 
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
-    }
+    copyStrided(dstStart, destRowPitch, destSlicePitch, srcStart, srcRowPitch, srcSlicePitch,
+                lineWidth, copyRegion[1], copyRegion[2], cpuCopyEngine);
 }
 
 Image::~Image() = default;
@@ -906,6 +906,80 @@ void Image::transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray
                  copySize, copyOffset);
 }
 
+bool Image::isTiledReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, const size_t *region) {
+    if (!DebugManager.flags.EnableCpuTiledImageReadWrite.get() || blocking != CL_TRUE || numEventsInWaitList != 0 || !isTiledImage) {
+        return false;
+    }
+    auto gmm = graphicsAllocation->gmm;
+    auto memoryPool = graphicsAllocation->getMemoryPool();
+    if (!gmm || gmm->isRenderCompressed || gmm->gmmResourceInfo->getTileModeSurfaceState() != tileModeSurfaceStateYMajor ||
+        gmm->gmmResourceInfo->getResourceFlags()->Info.TiledYf || gmm->gmmResourceInfo->getResourceFlags()->Info.TiledYs ||
+        !(MemoryPool::isSystemMemoryPool(memoryPool) || memoryPool == MemoryPool::SystemCpuInaccessible)) {
+        return false;
+    }
+    // planes, mip levels and samples are laid out by GMM in ways not covered by software detiling
+    if (peekSharingHandler() || associatedMemObject || isMipMapped(this) || imageDesc.num_samples > 1 ||
+        surfaceOffsets.offset != 0 || surfaceOffsets.yOffset != 0) {
+        return false;
+    }
+    // without LLC writes done through CPU mapping are not coherent with GPU reads
+    if (context->getDevice(0)->getDeviceInfo().platformLP) {
+        return false;
+    }
+    auto slicesCount = imageDesc.image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY ? region[1] : region[2];
+    if (slicesCount > 1 && qPitch == 0) {
+        return false;
+    }
+    return region[0] * surfaceFormatInfo.ImageElementSizeInBytes * region[1] * region[2] <= maxTiledImageRegionSizeForReadWriteOnCpu;
+}
+
+void Image::readTiledDataOnCpu(void *ptr, size_t rowPitch, size_t slicePitch, const MemObjSizeArray &region, const MemObjOffsetArray &origin) {
+    transferTiledData(ptr, rowPitch, slicePitch, region, origin, false);
+}
+
+void Image::writeTiledDataOnCpu(const void *ptr, size_t rowPitch, size_t slicePitch, const MemObjSizeArray &region, const MemObjOffsetArray &origin) {
+    transferTiledData(const_cast<void *>(ptr), rowPitch, slicePitch, region, origin, true);
+    graphicsAllocation->setAubWritable(true);
+}
+
+void Image::transferTiledData(void *ptr, size_t rowPitch, size_t slicePitch, MemObjSizeArray region, MemObjOffsetArray origin, bool toImage) {
+    size_t pixelSize = surfaceFormatInfo.ImageElementSizeInBytes;
+    if (rowPitch == 0) {
+        rowPitch = region[0] * pixelSize;
+    }
+    if (imageDesc.image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY) {
+        // array index of 1D array is stored on 2nd position, tiled surface keeps slices qPitch rows apart
+        std::swap(origin[1], origin[2]);
+        std::swap(region[1], region[2]);
+        if (slicePitch == 0) {
+            slicePitch = rowPitch;
+        }
+    } else if (slicePitch == 0) {
+        slicePitch = rowPitch * region[1];
+    }
+    origin[0] *= pixelSize;
+    region[0] *= pixelSize;
+
+    auto tiledStorage = graphicsAllocation->getUnderlyingBuffer();
+    bool unlockRequired = false;
+    if (!tiledStorage) {
+        unlockRequired = !graphicsAllocation->isLocked();
+        tiledStorage = memoryManager->lockResource(graphicsAllocation);
+    }
+    DBG_LOG(LogMemoryObject, __FUNCTION__, "tiled storage:", tiledStorage, "host ptr:", ptr, "toImage:", toImage);
+
+    if (toImage) {
+        copyToTileY(tiledStorage, imageDesc.image_row_pitch, qPitch, ptr, rowPitch, slicePitch, origin, region);
+    } else {
+        copyFromTileY(ptr, rowPitch, slicePitch, tiledStorage, imageDesc.image_row_pitch, qPitch, origin, region);
+    }
+
+    // unlock issues SW_FINISH after CPU write and lets next transfer set domain again
+    if (unlockRequired) {
+        memoryManager->unlockResource(graphicsAllocation);
+    }
+}
+
 cl_int Image::writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch) {
     CommandQueue *cmdQ = context->getSpecialQueue();
     size_t origin[3] = {0, 0, 0};
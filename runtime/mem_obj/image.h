@@ -7,6 +7,7 @@
 
 #pragma once
 #include "runtime/mem_obj/mem_obj.h"
+#include "runtime/helpers/basic_math.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/surface_formats.h"
 #include "runtime/helpers/validators.h"
@@ -46,6 +47,7 @@ class Image : public MemObj {
   public:
     const static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
     static const cl_ulong objectMagic = MemObj::objectMagic | 0x01;
+    const static size_t maxTiledImageRegionSizeForReadWriteOnCpu = 64 * KB;
 
     ~Image() override;
 
@@ -128,6 +130,10 @@ class Image : public MemObj {
     void transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
     void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
 
+    bool isTiledReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, const size_t *region);
+    void readTiledDataOnCpu(void *ptr, size_t rowPitch, size_t slicePitch, const MemObjSizeArray &region, const MemObjOffsetArray &origin);
+    void writeTiledDataOnCpu(const void *ptr, size_t rowPitch, size_t slicePitch, const MemObjSizeArray &region, const MemObjOffsetArray &origin);
+
     Image *redescribe();
     Image *redescribeFillImage();
     ImageCreatFunc createFunction;
@@ -201,6 +207,7 @@ class Image : public MemObj {
     void transferData(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
                       void *src, size_t srcRowPitch, size_t srcSlicePitch,
                       std::array<size_t, 3> copyRegion, std::array<size_t, 3> copyOrigin);
+    void transferTiledData(void *ptr, size_t rowPitch, size_t slicePitch, MemObjSizeArray region, MemObjOffsetArray origin, bool toImage);
 
     cl_image_format imageFormat;
     cl_image_desc imageDesc;
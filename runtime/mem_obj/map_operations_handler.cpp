@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #include "runtime/mem_obj/map_operations_handler.h"
 #include "runtime/helpers/ptr_math.h"
 
+#include <algorithm>
+
 using namespace OCLRT;
 
 size_t MapOperationsHandler::size() const {
@@ -24,7 +26,8 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(ptr, mapInfo);
+    addCoveredRange(reinterpret_cast<uintptr_t>(ptr), reinterpret_cast<uintptr_t>(ptrOffset(ptr, ptrLength)));
     return true;
 }
 
@@ -32,42 +35,121 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
-
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    auto inputStart = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEnd = inputStart + inputMapInfo.ptrLength;
 
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
-        }
+    // Segment covering requested start or covered segment starting before or at requested end
+    auto nextSegment = coveredSegments.upper_bound(inputStart);
+    if (nextSegment != coveredSegments.begin() && std::prev(nextSegment)->second.end > inputStart) {
+        return true;
     }
-    return false;
+    return nextSegment != coveredSegments.end() && nextSegment->first <= inputEnd;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.lower_bound(mappedPtr);
+    if (it != mappedPointers.end() && it->first == mappedPtr) {
+        outMapInfo = it->second;
+        return true;
     }
     return false;
 }
 
+void MapOperationsHandler::setWriteTracker(void *mappedPtr, std::shared_ptr<PageWriteTracker> writeTracker) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = mappedPointers.lower_bound(mappedPtr);
+    if (it != mappedPointers.end() && it->first == mappedPtr) {
+        it->second.writeTracker = std::move(writeTracker);
+    }
+}
+
+void MapOperationsHandler::releaseWriteTrackers() {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    for (auto &mappedPointer : mappedPointers) {
+        mappedPointer.second.writeTracker.reset();
+    }
+}
+
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
+    auto it = mappedPointers.lower_bound(mappedPtr);
+    if (it != mappedPointers.end() && it->first == mappedPtr) {
+        removeCoveredRange(reinterpret_cast<uintptr_t>(mappedPtr), reinterpret_cast<uintptr_t>(ptrOffset(mappedPtr, it->second.ptrLength)));
+        mappedPointers.erase(it);
+    }
+}
+
+void MapOperationsHandler::splitCoveredSegment(uintptr_t address) {
+    auto it = coveredSegments.upper_bound(address);
+    if (it == coveredSegments.begin()) {
+        return;
+    }
+    --it;
+    if (it->first < address && address < it->second.end) {
+        coveredSegments.emplace_hint(std::next(it), address, CoveredSegment{it->second.end, it->second.mapsCount});
+        it->second.end = address;
+    }
+}
+
+void MapOperationsHandler::mergeCoveredSegments(uintptr_t address) {
+    auto it = coveredSegments.find(address);
+    if (it == coveredSegments.end() || it == coveredSegments.begin()) {
+        return;
+    }
+    auto previous = std::prev(it);
+    if (previous->second.end == address && previous->second.mapsCount == it->second.mapsCount) {
+        previous->second.end = it->second.end;
+        coveredSegments.erase(it);
+    }
+}
+
+void MapOperationsHandler::addCoveredRange(uintptr_t start, uintptr_t end) {
+    if (start >= end) {
+        return;
+    }
+    splitCoveredSegment(start);
+    splitCoveredSegment(end);
+
+    // after split every segment in range ends at or before range end, gaps get new segments
+    auto cursor = start;
+    auto it = coveredSegments.lower_bound(start);
+    while (cursor < end) {
+        if (it == coveredSegments.end() || it->first > cursor) {
+            auto gapEnd = (it == coveredSegments.end()) ? end : std::min(end, it->first);
+            coveredSegments.emplace_hint(it, cursor, CoveredSegment{gapEnd, 1u});
+            cursor = gapEnd;
+            continue;
         }
+        it->second.mapsCount++;
+        cursor = it->second.end;
+        ++it;
+    }
+
+    mergeCoveredSegments(start);
+    mergeCoveredSegments(end);
+}
+
+void MapOperationsHandler::removeCoveredRange(uintptr_t start, uintptr_t end) {
+    if (start >= end) {
+        return;
     }
+    splitCoveredSegment(start);
+    splitCoveredSegment(end);
+
+    auto it = coveredSegments.lower_bound(start);
+    while (it != coveredSegments.end() && it->first < end) {
+        if (--it->second.mapsCount == 0) {
+            it = coveredSegments.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    mergeCoveredSegments(start);
+    mergeCoveredSegments(end);
 }
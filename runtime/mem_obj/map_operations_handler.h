@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,7 +8,7 @@
 #pragma once
 #include "runtime/helpers/properties_helper.h"
 
-#include <vector>
+#include <map>
 #include <mutex>
 
 namespace OCLRT {
@@ -20,11 +20,26 @@ class MapOperationsHandler {
     bool add(void *ptr, size_t ptrLength, cl_map_flags &mapFlags, MemObjSizeArray &size, MemObjOffsetArray &offset, uint32_t mipLevel);
     void remove(void *mappedPtr);
     bool find(void *mappedPtr, MapInfo &outMapInfo);
+    void setWriteTracker(void *mappedPtr, std::shared_ptr<PageWriteTracker> writeTracker);
+    void releaseWriteTrackers();
     size_t size() const;
 
   protected:
+    struct CoveredSegment {
+        uintptr_t end;
+        uint32_t mapsCount;
+    };
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    void addCoveredRange(uintptr_t start, uintptr_t end);
+    void removeCoveredRange(uintptr_t start, uintptr_t end);
+    void splitCoveredSegment(uintptr_t address);
+    void mergeCoveredSegments(uintptr_t address);
+
+    // mapped regions ordered by mapped pointer, equal pointers keep insertion order
+    std::multimap<const void *, MapInfo> mappedPointers;
+    // number of mapped regions covering each address, only covered segments are stored
+    std::map<uintptr_t, CoveredSegment> coveredSegments;
     mutable std::mutex mtx;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,7 +48,7 @@ MemObj::~MemObj() {
     if (allocatedMapPtr != nullptr) {
         needWait = true;
     }
-    if (mapOperationsHandler.size() > 0 && !getCpuAddressForMapping()) {
+    if (getMappedPtrsCount() > 0 && !getCpuAddressForMapping()) {
         needWait = true;
     }
     if (!destructorCallbacks.empty()) {
@@ -91,6 +91,8 @@ MemObj::~MemObj() {
         }
     }
 
+    delete mapOperationsHandler.load();
+
     if (context) {
         context->decRefInternal();
     }
@@ -112,6 +114,7 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
     cl_uint mapCount = 0;
     cl_mem clAssociatedMemObject = static_cast<cl_mem>(this->associatedMemObject);
     cl_context ctx = nullptr;
+    size_t clOffset = 0;
 
     switch (paramName) {
     case CL_MEM_TYPE:
@@ -147,8 +150,13 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
         break;
 
     case CL_MEM_OFFSET:
-        srcParamSize = sizeof(offset);
-        srcParam = &offset;
+        // buffer offset is relative to the graphics allocation, which may be shared with other buffers
+        clOffset = offset;
+        if (memObjectType == CL_MEM_OBJECT_BUFFER) {
+            clOffset = associatedMemObject ? offset - associatedMemObject->getOffset() : 0;
+        }
+        srcParamSize = sizeof(clOffset);
+        srcParam = &clOffset;
         break;
 
     case CL_MEM_ASSOCIATED_MEMOBJECT:
@@ -158,7 +166,7 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
 
     case CL_MEM_MAP_COUNT:
         srcParamSize = sizeof(mapCount);
-        mapCount = static_cast<cl_uint>(mapOperationsHandler.size());
+        mapCount = static_cast<cl_uint>(getMappedPtrsCount());
         srcParam = &mapCount;
         break;
 
@@ -283,6 +291,10 @@ void *MemObj::getCpuAddressForMemoryTransfer() {
 void MemObj::releaseAllocatedMapPtr() {
     if (allocatedMapPtr) {
         DEBUG_BREAK_IF((flags & CL_MEM_USE_HOST_PTR));
+        // tracking has to stop before memory is returned to the system
+        if (auto handler = mapOperationsHandler.load()) {
+            handler->releaseWriteTrackers();
+        }
         memoryManager->freeSystemMemory(allocatedMapPtr);
     }
     allocatedMapPtr = nullptr;
@@ -327,8 +339,43 @@ void *MemObj::getBasePtrForMap() {
 bool MemObj::addMappedPtr(void *ptr, size_t ptrLength, cl_map_flags &mapFlags,
                           MemObjSizeArray &size, MemObjOffsetArray &offset,
                           uint32_t mipLevel) {
-    return mapOperationsHandler.add(ptr, ptrLength, mapFlags, size, offset,
-                                    mipLevel);
+    return getMapOperationsHandler().add(ptr, ptrLength, mapFlags, size, offset,
+                                         mipLevel);
+}
+
+bool MemObj::findMappedPtr(void *mappedPtr, MapInfo &outMapInfo) {
+    auto handler = mapOperationsHandler.load();
+    return handler ? handler->find(mappedPtr, outMapInfo) : false;
+}
+
+void MemObj::removeMappedPtr(void *mappedPtr) {
+    if (auto handler = mapOperationsHandler.load()) {
+        handler->remove(mappedPtr);
+    }
+}
+
+void MemObj::setMappedPtrWriteTracker(void *mappedPtr, std::shared_ptr<PageWriteTracker> writeTracker) {
+    if (auto handler = mapOperationsHandler.load()) {
+        handler->setWriteTracker(mappedPtr, std::move(writeTracker));
+    }
+}
+
+size_t MemObj::getMappedPtrsCount() const {
+    auto handler = mapOperationsHandler.load();
+    return handler ? handler->size() : 0u;
+}
+
+MapOperationsHandler &MemObj::getMapOperationsHandler() {
+    auto handler = mapOperationsHandler.load();
+    if (handler == nullptr) {
+        auto newHandler = new MapOperationsHandler;
+        if (mapOperationsHandler.compare_exchange_strong(handler, newHandler)) {
+            handler = newHandler;
+        } else {
+            delete newHandler;
+        }
+    }
+    return *handler;
 }
 
 bool MemObj::mappingOnCpuAllowed() const {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,8 +59,11 @@ class MemObj : public BaseObject<_cl_mem> {
     cl_mem_flags getFlags() const;
 
     bool addMappedPtr(void *ptr, size_t ptrLength, cl_map_flags &mapFlags, MemObjSizeArray &size, MemObjOffsetArray &offset, uint32_t mipLevel);
-    bool findMappedPtr(void *mappedPtr, MapInfo &outMapInfo) { return mapOperationsHandler.find(mappedPtr, outMapInfo); }
-    void removeMappedPtr(void *mappedPtr) { return mapOperationsHandler.remove(mappedPtr); }
+    bool findMappedPtr(void *mappedPtr, MapInfo &outMapInfo);
+    void removeMappedPtr(void *mappedPtr);
+    void setMappedPtrWriteTracker(void *mappedPtr, std::shared_ptr<PageWriteTracker> writeTracker);
+    size_t getMappedPtrsCount() const;
+    MapOperationsHandler &getMapOperationsHandler();
     void *getBasePtrForMap();
 
     MOCKABLE_VIRTUAL void setAllocatedMapPtr(void *allocatedMapPtr);
@@ -118,7 +121,8 @@ class MemObj : public BaseObject<_cl_mem> {
     void *memoryStorage;
     void *hostPtr;
     void *allocatedMapPtr = nullptr;
-    MapOperationsHandler mapOperationsHandler;
+    // created on first map, most memory objects (e.g. pool sub-buffers) are never mapped
+    std::atomic<MapOperationsHandler *> mapOperationsHandler{nullptr};
     size_t offset = 0;
     MemObj *associatedMemObject = nullptr;
     cl_uint refCount = 0;
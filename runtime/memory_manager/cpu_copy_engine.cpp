@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <emmintrin.h>
+#include <thread>
+
+namespace OCLRT {
+constexpr size_t CpuCopyEngine::minChunkSize;
+constexpr size_t CpuCopyEngine::defaultNonTemporalThreshold;
+constexpr uint32_t CpuCopyEngine::maxWorkersCount;
+constexpr size_t CpuCopyEngine::maxFillPatternSize;
+
+uint32_t CpuCopyEngine::getDefaultWorkersCount() {
+    auto hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads <= 1) {
+        return 0;
+    }
+    return std::min(hardwareThreads - 1, maxWorkersCount);
+}
+
+void CpuCopyEngine::copyNonTemporal(void *destination, const void *source, size_t size) {
+    auto dst = reinterpret_cast<uint8_t *>(destination);
+    auto src = reinterpret_cast<const uint8_t *>(source);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dst, sizeof(__m128i)), dst));
+    memcpy_s(dst, headSize, src, headSize);
+    dst += headSize;
+    src += headSize;
+    size -= headSize;
+
+    auto dstVectors = reinterpret_cast<__m128i *>(dst);
+    auto srcVectors = reinterpret_cast<const __m128i *>(src);
+    auto vectorsCount = size / sizeof(__m128i);
+    size_t i = 0;
+    for (; i + 4 <= vectorsCount; i += 4) {
+        auto v0 = _mm_loadu_si128(srcVectors + i);
+        auto v1 = _mm_loadu_si128(srcVectors + i + 1);
+        auto v2 = _mm_loadu_si128(srcVectors + i + 2);
+        auto v3 = _mm_loadu_si128(srcVectors + i + 3);
+        _mm_stream_si128(dstVectors + i, v0);
+        _mm_stream_si128(dstVectors + i + 1, v1);
+        _mm_stream_si128(dstVectors + i + 2, v2);
+        _mm_stream_si128(dstVectors + i + 3, v3);
+    }
+    for (; i < vectorsCount; i++) {
+        _mm_stream_si128(dstVectors + i, _mm_loadu_si128(srcVectors + i));
+    }
+    // streaming stores are weakly ordered, make them visible before the copy is reported as done
+    _mm_sfence();
+
+    auto tailOffset = vectorsCount * sizeof(__m128i);
+    auto tailSize = size - tailOffset;
+    memcpy_s(dst + tailOffset, tailSize, src + tailOffset, tailSize);
+}
+
+void CpuCopyEngine::fillPattern(void *destination, size_t size, const void *pattern, size_t patternSize, bool nonTemporal) {
+    DEBUG_BREAK_IF(patternSize == 0 || maxFillPatternSize % patternSize != 0);
+    auto dst = reinterpret_cast<uint8_t *>(destination);
+    auto patternBytes = reinterpret_cast<const uint8_t *>(pattern);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dst, sizeof(__m128i)), dst));
+    for (size_t i = 0; i < headSize; i++) {
+        dst[i] = patternBytes[i % patternSize];
+    }
+
+    // pattern replicated starting from the first aligned byte, every valid pattern size divides the block
+    alignas(sizeof(__m128i)) uint8_t block[maxFillPatternSize];
+    for (size_t i = 0; i < maxFillPatternSize; i++) {
+        block[i] = patternBytes[(headSize + i) % patternSize];
+    }
+    dst += headSize;
+    size -= headSize;
+
+    constexpr size_t vectorsPerBlock = maxFillPatternSize / sizeof(__m128i);
+    __m128i blockVectors[vectorsPerBlock];
+    for (size_t i = 0; i < vectorsPerBlock; i++) {
+        blockVectors[i] = _mm_load_si128(reinterpret_cast<const __m128i *>(block) + i);
+    }
+
+    auto dstVectors = reinterpret_cast<__m128i *>(dst);
+    auto blocksCount = size / maxFillPatternSize;
+    if (nonTemporal) {
+        for (size_t b = 0; b < blocksCount; b++, dstVectors += vectorsPerBlock) {
+            for (size_t i = 0; i < vectorsPerBlock; i++) {
+                _mm_stream_si128(dstVectors + i, blockVectors[i]);
+            }
+        }
+        _mm_sfence();
+    } else {
+        for (size_t b = 0; b < blocksCount; b++, dstVectors += vectorsPerBlock) {
+            for (size_t i = 0; i < vectorsPerBlock; i++) {
+                _mm_store_si128(dstVectors + i, blockVectors[i]);
+            }
+        }
+    }
+
+    auto tailOffset = blocksCount * maxFillPatternSize;
+    auto tailSize = size - tailOffset;
+    memcpy_s(dst + tailOffset, tailSize, block, tailSize);
+}
+
+CpuCopyEngine::CpuCopyEngine(uint32_t workersCount, size_t nonTemporalThreshold) : nonTemporalThreshold(nonTemporalThreshold) {
+    for (uint32_t i = 0; i < workersCount; i++) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
+}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        stopWorkers = true;
+    }
+    jobsAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+void CpuCopyEngine::copy(void *destination, const void *source, size_t size) {
+    bool nonTemporal = size >= nonTemporalThreshold;
+    auto copyChunk = [=](void *chunkDestination, const void *chunkSource, size_t chunkSize) {
+        if (nonTemporal) {
+            copyNonTemporal(chunkDestination, chunkSource, chunkSize);
+        } else {
+            memcpy_s(chunkDestination, chunkSize, chunkSource, chunkSize);
+        }
+    };
+
+    size_t chunksCount = std::min(static_cast<size_t>(workers.size()) + 1, size / minChunkSize);
+    if (chunksCount <= 1) {
+        copyChunk(destination, source, size);
+        return;
+    }
+
+    auto chunkSize = alignUp(size / chunksCount, MemoryConstants::cacheLineSize);
+    chunksCount = (size + chunkSize - 1) / chunkSize;
+    execute(chunksCount, [&](size_t chunk) {
+        auto offset = chunk * chunkSize;
+        copyChunk(ptrOffset(destination, offset), ptrOffset(source, offset), std::min(chunkSize, size - offset));
+    });
+}
+
+void CpuCopyEngine::fill(void *destination, size_t size, const void *pattern, size_t patternSize) {
+    bool nonTemporal = size >= nonTemporalThreshold;
+    size_t chunksCount = std::min(static_cast<size_t>(workers.size()) + 1, size / minChunkSize);
+    if (chunksCount <= 1) {
+        fillPattern(destination, size, pattern, patternSize, nonTemporal);
+        return;
+    }
+
+    // chunks start at multiples of the pattern size, so each one begins with the first pattern byte
+    auto chunkSize = alignUp(size / chunksCount, maxFillPatternSize);
+    chunksCount = (size + chunkSize - 1) / chunkSize;
+    execute(chunksCount, [&](size_t chunk) {
+        auto offset = chunk * chunkSize;
+        fillPattern(ptrOffset(destination, offset), std::min(chunkSize, size - offset), pattern, patternSize, nonTemporal);
+    });
+}
+
+void CpuCopyEngine::execute(size_t tasksCount, const std::function<void(size_t)> &task) {
+    if (workers.empty() || tasksCount <= 1) {
+        for (size_t taskIndex = 0; taskIndex < tasksCount; taskIndex++) {
+            task(taskIndex);
+        }
+        return;
+    }
+
+    size_t pendingJobs = 0;
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        for (size_t taskIndex = 1; taskIndex < tasksCount; taskIndex++) {
+            jobs.push_back({&task, taskIndex, &pendingJobs});
+            pendingJobs++;
+        }
+    }
+    jobsAvailable.notify_all();
+
+    task(0);
+
+    // help with queued jobs instead of sleeping while workers are busy
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    while (pendingJobs > 0) {
+        if (jobs.empty()) {
+            jobsCompleted.wait(lock);
+            continue;
+        }
+        auto job = jobs.front();
+        jobs.pop_front();
+        lock.unlock();
+        (*job.task)(job.taskIndex);
+        lock.lock();
+        (*job.pendingJobs)--;
+        jobsCompleted.notify_all();
+    }
+}
+
+void CpuCopyEngine::completeJob(const Job &job) {
+    std::lock_guard<std::mutex> lock(jobsMutex);
+    (*job.pendingJobs)--;
+    jobsCompleted.notify_all();
+}
+
+void *CpuCopyEngine::run(void *arg) {
+    auto self = reinterpret_cast<CpuCopyEngine *>(arg);
+    std::unique_lock<std::mutex> lock(self->jobsMutex);
+    while (true) {
+        if (self->jobs.empty()) {
+            if (self->stopWorkers) {
+                break;
+            }
+            self->jobsAvailable.wait(lock);
+            continue;
+        }
+        auto job = self->jobs.front();
+        self->jobs.pop_front();
+        lock.unlock();
+        (*job.task)(job.taskIndex);
+        self->completeJob(job);
+        lock.lock();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class Thread;
+
+// Copies large host-side transfers with a pool of worker threads.
+// Each copy is split into chunks processed by the workers and the calling thread,
+// chunks above nonTemporalThreshold bypass caches with streaming stores.
+class CpuCopyEngine : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t minChunkSize = MemoryConstants::megaByte;
+    static constexpr size_t defaultNonTemporalThreshold = 8 * MemoryConstants::megaByte;
+    static constexpr uint32_t maxWorkersCount = 7;
+    static constexpr size_t maxFillPatternSize = 128;
+
+    static uint32_t getDefaultWorkersCount();
+    static void copyNonTemporal(void *destination, const void *source, size_t size);
+    // patternSize has to be a power of two not greater than maxFillPatternSize
+    static void fillPattern(void *destination, size_t size, const void *pattern, size_t patternSize, bool nonTemporal);
+
+    CpuCopyEngine(uint32_t workersCount, size_t nonTemporalThreshold);
+    ~CpuCopyEngine();
+
+    void copy(void *destination, const void *source, size_t size);
+    void fill(void *destination, size_t size, const void *pattern, size_t patternSize);
+    // calls task for each index in [0, tasksCount), the calling thread takes part and returns once all tasks are done
+    void execute(size_t tasksCount, const std::function<void(size_t)> &task);
+
+    uint32_t getWorkersCount() const { return static_cast<uint32_t>(workers.size()); }
+    size_t getNonTemporalThreshold() const { return nonTemporalThreshold; }
+
+  protected:
+    struct Job {
+        const std::function<void(size_t)> *task;
+        size_t taskIndex;
+        size_t *pendingJobs;
+    };
+
+    static void *run(void *arg);
+    void completeJob(const Job &job);
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<Job> jobs;
+    std::mutex jobsMutex;
+    std::condition_variable jobsAvailable;
+    std::condition_variable jobsCompleted;
+    bool stopWorkers = false;
+    size_t nonTemporalThreshold;
+};
+} // namespace OCLRT
@@ -16,6 +16,59 @@ void GraphicsAllocation::setAllocationType(AllocationType allocationType) {
     this->allocationType = allocationType;
 }
 
+const char *GraphicsAllocation::getAllocationTypeName(AllocationType type) {
+    switch (type) {
+    case AllocationType::UNKNOWN:
+        return "UNKNOWN";
+    case AllocationType::BUFFER_COMPRESSED:
+        return "BUFFER_COMPRESSED";
+    case AllocationType::BUFFER_HOST_MEMORY:
+        return "BUFFER_HOST_MEMORY";
+    case AllocationType::BUFFER:
+        return "BUFFER";
+    case AllocationType::IMAGE:
+        return "IMAGE";
+    case AllocationType::TAG_BUFFER:
+        return "TAG_BUFFER";
+    case AllocationType::LINEAR_STREAM:
+        return "LINEAR_STREAM";
+    case AllocationType::FILL_PATTERN:
+        return "FILL_PATTERN";
+    case AllocationType::PIPE:
+        return "PIPE";
+    case AllocationType::TIMESTAMP_TAG_BUFFER:
+        return "TIMESTAMP_TAG_BUFFER";
+    case AllocationType::COMMAND_BUFFER:
+        return "COMMAND_BUFFER";
+    case AllocationType::PRINTF_SURFACE:
+        return "PRINTF_SURFACE";
+    case AllocationType::GLOBAL_SURFACE:
+        return "GLOBAL_SURFACE";
+    case AllocationType::PRIVATE_SURFACE:
+        return "PRIVATE_SURFACE";
+    case AllocationType::CONSTANT_SURFACE:
+        return "CONSTANT_SURFACE";
+    case AllocationType::SCRATCH_SURFACE:
+        return "SCRATCH_SURFACE";
+    case AllocationType::INSTRUCTION_HEAP:
+        return "INSTRUCTION_HEAP";
+    case AllocationType::INDIRECT_OBJECT_HEAP:
+        return "INDIRECT_OBJECT_HEAP";
+    case AllocationType::SURFACE_STATE_HEAP:
+        return "SURFACE_STATE_HEAP";
+    case AllocationType::DYNAMIC_STATE_HEAP:
+        return "DYNAMIC_STATE_HEAP";
+    case AllocationType::SHARED_RESOURCE_COPY:
+        return "SHARED_RESOURCE_COPY";
+    case AllocationType::SVM:
+        return "SVM";
+    case AllocationType::UNDECIDED:
+        return "UNDECIDED";
+    default:
+        return "ILLEGAL_VALUE";
+    }
+}
+
 bool GraphicsAllocation::isL3Capable() {
     auto ptr = ptrOffset(cpuPtr, static_cast<size_t>(this->allocationOffset));
     if (alignUp(ptr, MemoryConstants::cacheLineSize) == ptr && alignUp(this->size, MemoryConstants::cacheLineSize) == this->size) {
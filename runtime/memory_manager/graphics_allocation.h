@@ -105,6 +105,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     void setAllocationType(AllocationType allocationType);
     AllocationType getAllocationType() const { return allocationType; }
+    static const char *getAllocationTypeName(AllocationType type);
 
     void setAubWritable(bool writable) { aubWritable = writable; }
     bool isAubWritable() const { return aubWritable; }
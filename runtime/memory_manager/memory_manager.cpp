@@ -24,7 +24,9 @@
 #include "runtime/mem_obj/image.h"
 #include "runtime/os_interface/os_context.h"
 #include "runtime/os_interface/os_interface.h"
+#include "runtime/utilities/metrics_registry.h"
 #include "runtime/utilities/stackvec.h"
+#include "runtime/utilities/trace_recorder.h"
 
 #include <algorithm>
 
@@ -305,6 +307,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
 }
 
 GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(AllocationProperties properties, DevicesBitfield devicesBitfield, const void *hostPtr) {
+    TRACE_SCOPE(Allocation, __FUNCTION__, properties.size);
     AllocationData allocationData;
     getAllocationData(allocationData, properties, devicesBitfield, hostPtr);
 
@@ -315,6 +318,7 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(Allocat
     }
     if (allocation) {
         allocation->setAllocationType(properties.allocationType);
+        MetricsRegistry::recordAllocation(static_cast<uint32_t>(properties.allocationType), allocation->getUnderlyingBufferSize());
     }
 
     return allocation;
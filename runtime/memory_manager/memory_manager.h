@@ -183,6 +183,7 @@ class MemoryManager {
     CommandStreamReceiver *getDefaultCommandStreamReceiver(uint32_t deviceId) const;
     const CsrContainer &getCommandStreamReceivers() const;
     HostPtrManager *getHostPtrManager() const { return hostPtrManager.get(); }
+    ExecutionEnvironment &peekExecutionEnvironment() const { return executionEnvironment; }
     void setDefaultEngineIndex(uint32_t index) { defaultEngineIndex = index; }
 
   protected:
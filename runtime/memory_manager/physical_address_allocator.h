@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,6 @@
 #include "runtime/memory_manager/memory_banks.h"
 #include "runtime/memory_manager/memory_constants.h"
 #include <atomic>
-#include <mutex>
 
 namespace OCLRT {
 
@@ -31,20 +30,24 @@ class PhysicalAddressAllocator {
         return reservePage(memoryBank, MemoryConstants::pageSize64k, MemoryConstants::pageSize64k);
     }
 
+    // contiguous physical range for consecutive 4K pages, reserved at once
+    uint64_t reserve4kPages(uint32_t memoryBank, size_t pagesCount) {
+        return reservePage(memoryBank, pagesCount * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    }
+
     virtual uint64_t reservePage(uint32_t memoryBank, size_t pageSize, size_t alignement) {
         UNRECOVERABLE_IF(memoryBank != MemoryBanks::MainBank);
 
-        std::unique_lock<std::mutex> lock(pageReserveMutex);
-
         auto currentAddress = mainAllocator.load();
-        auto alignmentSize = alignUp(currentAddress, alignement) - currentAddress;
-        mainAllocator += alignmentSize;
-        return mainAllocator.fetch_add(pageSize);
+        uint64_t alignedAddress = 0;
+        do {
+            alignedAddress = alignUp(currentAddress, alignement);
+        } while (!mainAllocator.compare_exchange_weak(currentAddress, alignedAddress + pageSize));
+        return alignedAddress;
     }
 
   protected:
     std::atomic<uint64_t> mainAllocator;
-    std::mutex pageReserveMutex;
     const uint64_t initialPageAddress = 0x1000;
 };
 
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub_mem_dump/page_table_entry_bits.h"
+#include "runtime/memory_manager/sparse_page_table.h"
+#include "runtime/memory_manager/page_table.inl"
+
+#include <algorithm>
+#include <limits>
+
+namespace OCLRT {
+
+template <class BaseTable>
+uintptr_t SparsePageTable<BaseTable>::map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) {
+    uintptr_t firstNodeIndex = std::numeric_limits<uintptr_t>::max();
+    uintptr_t firstNodeRes = std::numeric_limits<uintptr_t>::max();
+    uintptr_t res = std::numeric_limits<uintptr_t>::max();
+
+    mapPages(vm, size, entryBits, memoryBank, [&](uintptr_t page, uint32_t pagesCount, uint64_t physAddress, uint64_t pageEntryBits) {
+        auto nodeIndex = page / pagesPerNode;
+        if (firstNodeIndex == std::numeric_limits<uintptr_t>::max()) {
+            firstNodeIndex = nodeIndex;
+        }
+        if (nodeIndex == firstNodeIndex) {
+            firstNodeRes = std::min(static_cast<uintptr_t>(physAddress), firstNodeRes);
+        } else {
+            res = std::min(static_cast<uintptr_t>(physAddress), res);
+        }
+    });
+
+    // same as walking through page table levels, offset within page is added to address found in first leaf
+    if (firstNodeRes != std::numeric_limits<uintptr_t>::max()) {
+        res = std::min(firstNodeRes + (vm & MemoryConstants::pageMask), res);
+    }
+    return res;
+}
+
+template <class BaseTable>
+void SparsePageTable<BaseTable>::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) {
+    size_t rem = vm & MemoryConstants::pageMask;
+    size_t sizeLeft = size;
+
+    mapPages(vm, size, entryBits, memoryBank, [&](uintptr_t page, uint32_t pagesCount, uint64_t physAddress, uint64_t pageEntryBits) {
+        for (uint32_t i = 0; i < pagesCount; i++) {
+            size_t lSize = std::min(MemoryConstants::pageSize - rem, sizeLeft);
+            pageWalker(physAddress + i * MemoryConstants::pageSize + rem, lSize, offset, pageEntryBits);
+
+            sizeLeft -= lSize;
+            offset += lSize;
+            rem = 0;
+        }
+    });
+}
+
+template <class BaseTable>
+size_t SparsePageTable<BaseTable>::getRangesCount() const {
+    size_t rangesCount = 0;
+    for (auto &node : nodes) {
+        rangesCount += node.second.size();
+    }
+    return rangesCount;
+}
+
+template <class BaseTable>
+template <typename RangeVisitor>
+void SparsePageTable<BaseTable>::mapPages(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank, RangeVisitor visitor) {
+    const size_t shift = 12;
+    const size_t addressBits = BaseTable::getBits() + shift;
+    uintptr_t vmMask = addressBits >= sizeof(uintptr_t) * 8 ? std::numeric_limits<uintptr_t>::max() : (uintptr_t(1) << addressBits) - 1;
+    auto maskedVm = vm & vmMask;
+    uintptr_t firstPage = maskedVm >> shift;
+    uintptr_t lastPage = ((maskedVm + size - 1) & vmMask) >> shift;
+
+    for (uintptr_t nodeIndex = firstPage / pagesPerNode; nodeIndex <= lastPage / pagesPerNode; nodeIndex++) {
+        uintptr_t nodeBase = nodeIndex * pagesPerNode;
+        auto first = static_cast<uint32_t>(std::max(firstPage, nodeBase) - nodeBase);
+        auto last = static_cast<uint32_t>(std::min(lastPage, nodeBase + pagesPerNode - 1) - nodeBase);
+
+        auto &node = nodes[nodeIndex];
+        mapInNode(node, first, last, entryBits, memoryBank);
+
+        for (auto &range : node) {
+            if (range.firstPage + range.pagesCount <= first || range.firstPage > last) {
+                continue;
+            }
+            auto begin = std::max(range.firstPage, first);
+            auto end = std::min(range.firstPage + range.pagesCount - 1, last);
+            visitor(nodeBase + begin, end - begin + 1, range.physAddress + (begin - range.firstPage) * MemoryConstants::pageSize, range.entryBits);
+        }
+    }
+}
+
+template <class BaseTable>
+void SparsePageTable<BaseTable>::mapInNode(Node &node, uint32_t firstPage, uint32_t lastPage, uint64_t entryBits, uint32_t memoryBank) {
+    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
+    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
+    newEntryBits |= 0x1;
+
+    if (updateEntryBits) {
+        // ranges crossing boundaries of mapped pages are split, so only mapped part gets new bits
+        splitRange(node, firstPage);
+        splitRange(node, lastPage + 1);
+    }
+
+    Node updated;
+    updated.reserve(node.size() + 2);
+    auto page = firstPage;
+    auto reserveGap = [&](uint32_t gapEnd) {
+        PageRange range = {page, gapEnd - page + 1, this->allocator->reserve4kPages(memoryBank, gapEnd - page + 1), newEntryBits};
+        updated.push_back(range);
+        page = gapEnd + 1;
+    };
+
+    for (auto range : node) {
+        auto rangeEnd = range.firstPage + range.pagesCount;
+        if (page <= lastPage && range.firstPage > page) {
+            reserveGap(std::min(range.firstPage - 1, lastPage));
+        }
+        if (range.firstPage <= lastPage && rangeEnd > firstPage) {
+            if (updateEntryBits) {
+                range.entryBits = newEntryBits;
+            }
+            page = std::max(page, rangeEnd);
+        }
+        updated.push_back(range);
+    }
+    if (page <= lastPage) {
+        reserveGap(lastPage);
+    }
+
+    mergeRanges(updated);
+    node.swap(updated);
+}
+
+template <class BaseTable>
+void SparsePageTable<BaseTable>::splitRange(Node &node, uint32_t page) {
+    auto range = std::find_if(node.begin(), node.end(), [page](const PageRange &range) {
+        return range.firstPage < page && page < range.firstPage + range.pagesCount;
+    });
+    if (range == node.end()) {
+        return;
+    }
+    PageRange upperPart = *range;
+    upperPart.firstPage = page;
+    upperPart.pagesCount = range->firstPage + range->pagesCount - page;
+    upperPart.physAddress = range->physAddress + (page - range->firstPage) * MemoryConstants::pageSize;
+    range->pagesCount = page - range->firstPage;
+    node.insert(range + 1, upperPart);
+}
+
+template <class BaseTable>
+void SparsePageTable<BaseTable>::mergeRanges(Node &node) {
+    if (node.empty()) {
+        return;
+    }
+    auto last = node.begin();
+    for (auto range = node.begin() + 1; range != node.end(); range++) {
+        bool contiguous = last->firstPage + last->pagesCount == range->firstPage &&
+                          last->physAddress + last->pagesCount * MemoryConstants::pageSize == range->physAddress &&
+                          last->entryBits == range->entryBits;
+        if (contiguous) {
+            last->pagesCount += range->pagesCount;
+        } else {
+            *(++last) = *range;
+        }
+    }
+    node.erase(last + 1, node.end());
+}
+
+template class SparsePageTable<PML4>;
+template class SparsePageTable<PDPE>;
+} // namespace OCLRT
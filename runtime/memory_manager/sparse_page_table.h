@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/page_table.h"
+
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace OCLRT {
+
+// Page table with the same mappings as BaseTable, but storing only touched 2MB regions in hash map.
+// Each region keeps sorted ranges of consecutive pages with contiguous physical addresses and same entry bits,
+// so mapping large allocation reserves physical memory at once and stores few ranges instead of entry per 4K page.
+template <class BaseTable>
+class SparsePageTable : public BaseTable {
+  public:
+    SparsePageTable(PhysicalAddressAllocator *physicalAddressAllocator) : BaseTable(physicalAddressAllocator) {}
+
+    uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) override;
+    void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override;
+
+    size_t getNodesCount() const { return nodes.size(); }
+    size_t getRangesCount() const;
+
+    static const uint32_t pagesPerNode = 1 << PTE::bits;
+
+  protected:
+    struct PageRange {
+        uint32_t firstPage;
+        uint32_t pagesCount;
+        uint64_t physAddress;
+        uint64_t entryBits;
+    };
+    using Node = std::vector<PageRange>;
+
+    template <typename RangeVisitor>
+    void mapPages(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank, RangeVisitor visitor);
+    void mapInNode(Node &node, uint32_t firstPage, uint32_t lastPage, uint64_t entryBits, uint32_t memoryBank);
+    static void splitRange(Node &node, uint32_t page);
+    static void mergeRanges(Node &node);
+
+    std::unordered_map<uintptr_t, Node> nodes;
+};
+
+using SparsePPGTT = SparsePageTable<std::conditional<is64bit, PML4, PDPE>::type>;
+using SparseGGTT = SparsePageTable<PDPE>;
+} // namespace OCLRT
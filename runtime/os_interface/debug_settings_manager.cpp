@@ -270,58 +270,7 @@ const char *DebugSettingsManager<DebugLevel>::getAllocationTypeString(GraphicsAl
         return nullptr;
     }
 
-    auto type = graphicsAllocation->getAllocationType();
-
-    switch (type) {
-    case OCLRT::GraphicsAllocation::AllocationType::UNKNOWN:
-        return "UNKNOWN";
-    case OCLRT::GraphicsAllocation::AllocationType::BUFFER_COMPRESSED:
-        return "BUFFER_COMPRESSED";
-    case OCLRT::GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY:
-        return "BUFFER_HOST_MEMORY";
-    case OCLRT::GraphicsAllocation::AllocationType::BUFFER:
-        return "BUFFER";
-    case OCLRT::GraphicsAllocation::AllocationType::IMAGE:
-        return "IMAGE";
-    case OCLRT::GraphicsAllocation::AllocationType::TAG_BUFFER:
-        return "TAG_BUFFER";
-    case OCLRT::GraphicsAllocation::AllocationType::LINEAR_STREAM:
-        return "LINEAR_STREAM";
-    case OCLRT::GraphicsAllocation::AllocationType::FILL_PATTERN:
-        return "FILL_PATTERN";
-    case OCLRT::GraphicsAllocation::AllocationType::PIPE:
-        return "PIPE";
-    case OCLRT::GraphicsAllocation::AllocationType::TIMESTAMP_TAG_BUFFER:
-        return "TIMESTAMP_TAG_BUFFER";
-    case OCLRT::GraphicsAllocation::AllocationType::COMMAND_BUFFER:
-        return "COMMAND_BUFFER";
-    case OCLRT::GraphicsAllocation::AllocationType::PRINTF_SURFACE:
-        return "PRINTF_SURFACE";
-    case OCLRT::GraphicsAllocation::AllocationType::GLOBAL_SURFACE:
-        return "GLOBAL_SURFACE";
-    case OCLRT::GraphicsAllocation::AllocationType::PRIVATE_SURFACE:
-        return "PRIVATE_SURFACE";
-    case OCLRT::GraphicsAllocation::AllocationType::CONSTANT_SURFACE:
-        return "CONSTANT_SURFACE";
-    case OCLRT::GraphicsAllocation::AllocationType::SCRATCH_SURFACE:
-        return "SCRATCH_SURFACE";
-    case OCLRT::GraphicsAllocation::AllocationType::INSTRUCTION_HEAP:
-        return "INSTRUCTION_HEAP";
-    case OCLRT::GraphicsAllocation::AllocationType::INDIRECT_OBJECT_HEAP:
-        return "INDIRECT_OBJECT_HEAP";
-    case OCLRT::GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP:
-        return "SURFACE_STATE_HEAP";
-    case OCLRT::GraphicsAllocation::AllocationType::DYNAMIC_STATE_HEAP:
-        return "DYNAMIC_STATE_HEAP";
-    case OCLRT::GraphicsAllocation::AllocationType::SHARED_RESOURCE_COPY:
-        return "SHARED_RESOURCE_COPY";
-    case OCLRT::GraphicsAllocation::AllocationType::SVM:
-        return "SVM";
-    case OCLRT::GraphicsAllocation::AllocationType::UNDECIDED:
-        return "UNDECIDED";
-    default:
-        return "ILLEGAL_VALUE";
-    }
+    return GraphicsAllocation::getAllocationTypeName(graphicsAllocation->getAllocationType());
 }
 
 template class DebugSettingsManager<DebugFunctionalityLevel::None>;
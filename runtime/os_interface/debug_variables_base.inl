@@ -25,6 +25,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpAsyncWriteBufferSize, 0, "Size in MB of staging buffer for AUB file writes done on background thread, 0 - write synchronously")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, 0, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
@@ -33,6 +34,8 @@ DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpConcurrentCS, false, "Enable concurrent execution on CS (disabled by default)")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpCompactUniformMemory, false, "Write memory filled with single repeated dword, e.g. zeroed pages, as repeat memory write with one dword payload")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpIncrementalResidency, false, "Skip resident pages whose contents and page table entries were already written to AUB file, unchanged buffers are dumped once")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, SchedulerSimulationReturnInstance, 0, "prints execution model related debug information")
@@ -62,10 +65,17 @@ DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, s
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, 0, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, 0, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
+DECLARE_DEBUG_VARIABLE(std::string, EventsTrackerStreamFile, std::string("unk"), "When different than \"unk\", EventsTrackerEnable appends binary event records to this memory-mapped ring file instead of dumping graphs")
+DECLARE_DEBUG_VARIABLE(int32_t, EventsTrackerStreamSize, 64, "Size in MB of EventsTrackerStreamFile, oldest records are overwritten when it is full")
 DECLARE_DEBUG_VARIABLE(bool, PrintEMDebugInformation, false, "prints execution model related debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver choosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch paramters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
+DECLARE_DEBUG_VARIABLE(bool, EnableTracing, false, "Records api calls, flushTask, system calls, waits and allocations into per-thread ring buffers dumped in Chrome trace format at exit")
+DECLARE_DEBUG_VARIABLE(int32_t, TracingRingBufferSize, 16384, "Number of most recent events kept per thread when EnableTracing is set")
+DECLARE_DEBUG_VARIABLE(std::string, TracingOutputFile, std::string("igdrcl_trace.json"), "Name of file to save trace recorded with EnableTracing into")
+DECLARE_DEBUG_VARIABLE(bool, EnableMetrics, false, "Collects per api latency histograms, flush, cpu copy, allocation, residency and wait statistics dumped at exit")
+DECLARE_DEBUG_VARIABLE(std::string, MetricsOutputFile, std::string("igdrcl_metrics.txt"), "Name of file to save statistics collected with EnableMetrics into")
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "works on Windows only, sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing")
 DECLARE_DEBUG_VARIABLE(bool, ForceLinearImages, false, "Force linear images. Default is Y-tiled.")
@@ -80,6 +90,19 @@ DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passe
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, EnableHostPtrTracking, true, "Enable host ptr tracking")
+DECLARE_DEBUG_VARIABLE(bool, EnableObjectPooling, false, "Recycle memory of events, memory objects, blocked commands and kernel operations through slab pools")
+DECLARE_DEBUG_VARIABLE(bool, EnableLocalIdsCache, true, "Reuse local IDs generated for previous dispatches of a kernel with the same SIMD, local work size and walk order")
+DECLARE_DEBUG_VARIABLE(bool, EnableLocalWorkSizeCache, true, "Reuse local work size deduced for previous dispatches of a kernel with the same global size and work size constraints")
+DECLARE_DEBUG_VARIABLE(bool, EnableLocalWorkSizeTuning, false, "Measure candidate local work sizes for NULL local size dispatches and lock in the fastest one, tuned values are persisted in cl_cache_dir")
+DECLARE_DEBUG_VARIABLE(bool, EnableCrossThreadDataReuse, false, "Reuse cross thread data copied to indirect object heap by previous enqueue of the same kernel, patching only changed dwords")
+DECLARE_DEBUG_VARIABLE(bool, EnableCpuCopyEngine, false, "Split large CPU-side buffer transfers across worker threads, using streaming stores for transfers above 8MB")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineWorkersCount, -1, "-1: default, >=0: number of CPU copy engine worker threads besides the calling thread")
+DECLARE_DEBUG_VARIABLE(bool, EnableCpuTiledImageReadWrite, false, "Read and write small regions of Y-tiled images on CPU with software detiling instead of builtin kernels")
+DECLARE_DEBUG_VARIABLE(bool, EnableBlitterOperationsSupport, false, "Create copy engine (BCS) and route buffer copy, read and write transfers through blitter commands")
+DECLARE_DEBUG_VARIABLE(bool, EnableCpuFillBuffer, false, "Fill zero-copy buffers on CPU with SIMD stores when queue is idle and there are no dependencies")
+DECLARE_DEBUG_VARIABLE(bool, EnableTransferCoalescing, false, "Batch small copy and fill buffer enqueues without events into single scatter walker")
+DECLARE_DEBUG_VARIABLE(bool, EnableMapWriteTracking, false, "Track soft-dirty pages of blocking buffer maps for writing and write back only pages written by host on unmap")
+DECLARE_DEBUG_VARIABLE(bool, EnableBufferSuballocation, false, "Serve buffers up to 64KB from ranges of shared backing allocations to reduce residency and exec list sizes")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
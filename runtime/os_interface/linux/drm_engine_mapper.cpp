@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@ namespace OCLRT {
 unsigned int DrmEngineMapper::engineNodeMap(EngineType engineType) {
     if (EngineType::ENGINE_RCS == engineType) {
         return I915_EXEC_RENDER;
+    } else if (EngineType::ENGINE_BCS == engineType) {
+        return I915_EXEC_BLT;
     }
     UNRECOVERABLE_IF(true);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "drm_neo.h"
 #include "runtime/os_interface/os_inc_base.h"
 #include "runtime/utilities/directory.h"
+#include "runtime/utilities/trace_recorder.h"
 #include "drm/i915_drm.h"
 
 #include <cstdio>
@@ -22,6 +23,7 @@ const char *Drm::configFileName = "/config";
 
 int Drm::ioctl(unsigned long request, void *arg) {
     int ret;
+    TRACE_SCOPE(System, "ioctl", request);
     SYSTEM_ENTER();
     do {
         ret = ::ioctl(fd, request, arg);
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace OCLRT {
+
+class MappedFileLinux : public MappedFile {
+  public:
+    MappedFileLinux(int fileDescriptor, void *data, size_t size) : MappedFile(data, size), fileDescriptor(fileDescriptor) {}
+
+    ~MappedFileLinux() override {
+        munmap(data, size);
+        close(fileDescriptor);
+    }
+
+  protected:
+    int fileDescriptor;
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string &fileName, size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+    auto fileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fileDescriptor < 0) {
+        return nullptr;
+    }
+    if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if (data == MAP_FAILED) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFileLinux(fileDescriptor, data, size));
+}
+} // namespace OCLRT
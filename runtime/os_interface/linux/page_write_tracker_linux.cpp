@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/page_write_tracker_linux.h"
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace OCLRT {
+
+namespace {
+const char *pagemapPath = "/proc/self/pagemap";
+const char *clearRefsPath = "/proc/self/clear_refs";
+constexpr uint64_t pagemapSoftDirtyBit = 1ull << 55;
+constexpr size_t pagemapEntriesPerRead = 512;
+
+std::mutex trackersMutex;
+uint32_t activeTrackersCount = 0;
+
+bool clearSoftDirtyBits() {
+    auto fileDescriptor = open(clearRefsPath, O_WRONLY);
+    if (fileDescriptor < 0) {
+        return false;
+    }
+    // "4" clears soft-dirty bits of all pages of the process
+    bool cleared = write(fileDescriptor, "4", 1) == 1;
+    close(fileDescriptor);
+    return cleared;
+}
+
+bool readPagemapEntries(int pagemapFileDescriptor, uintptr_t page, size_t count, uint64_t *entries) {
+    auto offset = static_cast<off_t>(page / MemoryConstants::pageSize * sizeof(uint64_t));
+    auto size = count * sizeof(uint64_t);
+    return pread(pagemapFileDescriptor, entries, size, offset) == static_cast<ssize_t>(size);
+}
+
+bool isPageSoftDirty(int pagemapFileDescriptor, uintptr_t page) {
+    uint64_t entry = 0;
+    return readPagemapEntries(pagemapFileDescriptor, page, 1, &entry) && (entry & pagemapSoftDirtyBit) != 0;
+}
+
+bool checkSoftDirtySupport() {
+    auto memory = mmap(nullptr, MemoryConstants::pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return false;
+    }
+    bool supported = false;
+    auto pagemapFileDescriptor = open(pagemapPath, O_RDONLY);
+    if (pagemapFileDescriptor >= 0) {
+        auto page = reinterpret_cast<uintptr_t>(memory);
+        auto value = static_cast<volatile uint8_t *>(memory);
+        value[0] = 1;
+        bool cleared = clearSoftDirtyBits() && !isPageSoftDirty(pagemapFileDescriptor, page);
+        value[0] = 2;
+        supported = cleared && isPageSoftDirty(pagemapFileDescriptor, page);
+        close(pagemapFileDescriptor);
+    }
+    munmap(memory, MemoryConstants::pageSize);
+    return supported;
+}
+} // namespace
+
+std::unique_ptr<PageWriteTracker> PageWriteTracker::create(void *ptr, size_t size) {
+    std::unique_ptr<PageWriteTrackerLinux> tracker(new PageWriteTrackerLinux(ptr, size));
+    if (!tracker->start()) {
+        return nullptr;
+    }
+    return std::unique_ptr<PageWriteTracker>(tracker.release());
+}
+
+PageWriteTrackerLinux::~PageWriteTrackerLinux() {
+    stop();
+}
+
+bool PageWriteTrackerLinux::isSoftDirtySupported() {
+    static bool supported = checkSoftDirtySupport();
+    return supported;
+}
+
+bool PageWriteTrackerLinux::start() {
+    if (trackedStart == trackedEnd || !isSoftDirtySupported()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(trackersMutex);
+    // clearing bits now would lose writes not yet collected by active trackers
+    if (activeTrackersCount == 0 && !clearSoftDirtyBits()) {
+        return false;
+    }
+    activeTrackersCount++;
+    started = true;
+    return true;
+}
+
+void PageWriteTrackerLinux::stop() {
+    if (!started) {
+        return;
+    }
+    auto pagemapFileDescriptor = open(pagemapPath, O_RDONLY);
+    bool collected = pagemapFileDescriptor >= 0 && collectSoftDirtyPages(pagemapFileDescriptor);
+    if (pagemapFileDescriptor >= 0) {
+        close(pagemapFileDescriptor);
+    }
+    if (!collected) {
+        // written pages can't be told apart from other ones, so all are written back
+        for (auto page = trackedStart; page < trackedEnd; page += MemoryConstants::pageSize) {
+            markPageWritten(page);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(trackersMutex);
+    activeTrackersCount--;
+    started = false;
+}
+
+bool PageWriteTrackerLinux::collectSoftDirtyPages(int pagemapFileDescriptor) {
+    uint64_t entries[pagemapEntriesPerRead];
+    auto page = trackedStart;
+    while (page < trackedEnd) {
+        auto count = std::min(pagemapEntriesPerRead, static_cast<size_t>((trackedEnd - page) / MemoryConstants::pageSize));
+        if (!readPagemapEntries(pagemapFileDescriptor, page, count, entries)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++, page += MemoryConstants::pageSize) {
+            if (entries[i] & pagemapSoftDirtyBit) {
+                markPageWritten(page);
+            }
+        }
+    }
+    return true;
+}
+} // namespace OCLRT
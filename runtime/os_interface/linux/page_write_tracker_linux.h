@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/page_write_tracker.h"
+
+namespace OCLRT {
+
+// Tracks writes with soft-dirty bits of page table entries, read from /proc/self/pagemap when tracking stops.
+// No pages are write protected, so writes done by system calls into tracked memory succeed and are reported too.
+// Soft-dirty bits are cleared for the whole process, which is done only when no other tracker is active,
+// trackers started meanwhile also report pages written after that clear but before they started.
+class PageWriteTrackerLinux : public PageWriteTracker {
+  public:
+    PageWriteTrackerLinux(void *ptr, size_t size) : PageWriteTracker(ptr, size) {}
+    ~PageWriteTrackerLinux() override;
+
+    bool start();
+    void stop() override;
+
+    // kernels built without soft-dirty support accept clearing of bits but never set them
+    static bool isSoftDirtySupported();
+
+  protected:
+    bool collectSoftDirtyPages(int pagemapFileDescriptor);
+
+    bool started = false;
+};
+} // namespace OCLRT
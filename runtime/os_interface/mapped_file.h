@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace OCLRT {
+
+// File of fixed size mapped into process memory, writes are persisted by OS even if process terminates abnormally.
+class MappedFile : NonCopyableOrMovableClass {
+  public:
+    // creates or truncates file, returns nullptr when file can't be created or mapped
+    static std::unique_ptr<MappedFile> create(const std::string &fileName, size_t size);
+    virtual ~MappedFile() = default;
+
+    void *getData() const { return data; }
+    size_t getSize() const { return size; }
+
+  protected:
+    MappedFile(void *data, size_t size) : data(data), size(size) {}
+
+    void *data;
+    size_t size;
+};
+} // namespace OCLRT
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/page_write_tracker.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+constexpr size_t bitsPerWord = 64;
+
+PageWriteTracker::PageWriteTracker(void *ptr, size_t size) : start(reinterpret_cast<uintptr_t>(ptr)), size(size) {
+    firstPage = alignDown(start, MemoryConstants::pageSize);
+    trackedStart = alignUp(start, MemoryConstants::pageSize);
+    trackedEnd = std::max(trackedStart, alignDown(start + size, MemoryConstants::pageSize));
+    pagesCount = (alignUp(start + size, MemoryConstants::pageSize) - firstPage) / MemoryConstants::pageSize;
+
+    auto wordsCount = (pagesCount + bitsPerWord - 1) / bitsPerWord;
+    writtenPages.reset(new std::atomic<uint64_t>[wordsCount]);
+    for (size_t i = 0; i < wordsCount; i++) {
+        writtenPages[i] = 0;
+    }
+
+    // pages shared with memory outside of tracked range are never tracked
+    if (trackedStart != start) {
+        markPageWritten(start);
+    }
+    if (trackedEnd < start + size) {
+        markPageWritten(start + size - 1);
+    }
+}
+
+bool PageWriteTracker::markPageWritten(uintptr_t address) {
+    if (address < start || address >= start + size) {
+        return false;
+    }
+    auto pageIndex = (address - firstPage) / MemoryConstants::pageSize;
+    writtenPages[pageIndex / bitsPerWord].fetch_or(1ull << (pageIndex % bitsPerWord));
+    return true;
+}
+
+bool PageWriteTracker::isPageWritten(size_t pageIndex) const {
+    return (writtenPages[pageIndex / bitsPerWord].load() & (1ull << (pageIndex % bitsPerWord))) != 0;
+}
+
+std::vector<PageWriteTracker::Range> PageWriteTracker::getWrittenRanges() const {
+    std::vector<Range> writtenRanges;
+    size_t pageIndex = 0;
+    while (pageIndex < pagesCount) {
+        if (!isPageWritten(pageIndex)) {
+            pageIndex++;
+            continue;
+        }
+        auto firstWrittenPage = pageIndex;
+        while (pageIndex < pagesCount && isPageWritten(pageIndex)) {
+            pageIndex++;
+        }
+        auto rangeStart = std::max(start, firstPage + firstWrittenPage * MemoryConstants::pageSize);
+        auto rangeEnd = std::min(start + size, firstPage + pageIndex * MemoryConstants::pageSize);
+        writtenRanges.push_back({rangeStart - start, rangeEnd - rangeStart});
+    }
+    return writtenRanges;
+}
+} // namespace OCLRT
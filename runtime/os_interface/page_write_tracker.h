@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OCLRT {
+
+// Reports which pages of host memory were written by CPU since tracking started.
+// Only pages fully covered by tracked range are tracked,
+// partial head and tail pages are always reported as written.
+class PageWriteTracker : NonCopyableOrMovableClass {
+  public:
+    struct Range {
+        size_t offset;
+        size_t size;
+    };
+
+    // returns nullptr when writes to given memory can't be tracked
+    static std::unique_ptr<PageWriteTracker> create(void *ptr, size_t size);
+    virtual ~PageWriteTracker() = default;
+
+    // collects written pages, pages written afterwards are not reported
+    virtual void stop() = 0;
+
+    // written ranges relative to tracked pointer, adjacent pages are merged
+    std::vector<Range> getWrittenRanges() const;
+    bool markPageWritten(uintptr_t address);
+    bool isPageWritten(size_t pageIndex) const;
+
+  protected:
+    PageWriteTracker(void *ptr, size_t size);
+
+    uintptr_t start;
+    size_t size;
+    uintptr_t firstPage;
+    uintptr_t trackedStart;
+    uintptr_t trackedEnd;
+    size_t pagesCount;
+    std::unique_ptr<std::atomic<uint64_t>[]> writtenPages;
+};
+} // namespace OCLRT
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/mapped_file.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+namespace OCLRT {
+
+class MappedFileWin : public MappedFile {
+  public:
+    MappedFileWin(HANDLE file, HANDLE mapping, void *data, size_t size) : MappedFile(data, size), file(file), mapping(mapping) {}
+
+    ~MappedFileWin() override {
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        CloseHandle(file);
+    }
+
+  protected:
+    HANDLE file;
+    HANDLE mapping;
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string &fileName, size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+    auto file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    auto size64 = static_cast<uint64_t>(size);
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return nullptr;
+    }
+    auto data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFileWin(file, mapping, data, size));
+}
+} // namespace OCLRT
@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/page_write_tracker.h"
+
+namespace OCLRT {
+
+std::unique_ptr<PageWriteTracker> PageWriteTracker::create(void *ptr, size_t size) {
+    return nullptr;
+}
+} // namespace OCLRT
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,7 @@ class ThkWrapper {
     Func mFunc = nullptr;
 
     inline NTSTATUS operator()(Param param) const {
+        TRACE_SCOPE(System, "thk", getId<Param>());
         if (UseTimer) {
             SYSTEM_ENTER()
             NTSTATUS Status;
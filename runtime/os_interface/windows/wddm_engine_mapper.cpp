@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,8 @@ namespace OCLRT {
 GPUNODE_ORDINAL WddmEngineMapper::engineNodeMap(EngineType engineType) {
     if (EngineType::ENGINE_RCS == engineType) {
         return GPUNODE_3D;
+    } else if (EngineType::ENGINE_BCS == engineType) {
+        return GPUNODE_BLT;
     }
     UNRECOVERABLE_IF(true);
 }
@@ -23,9 +23,13 @@
 #pragma once
 #include "runtime/utilities/perf_profiler.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/utilities/metrics_registry.h"
+#include "runtime/utilities/trace_recorder.h"
 
-#define API_ENTER(retValPointer) \
-    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                           \
+    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    TRACE_SCOPE(Api, __FUNCTION__, 0);                                                                                     \
+    METRICS_API_SCOPE(__FUNCTION__)
 #define SYSTEM_ENTER()
 #define SYSTEM_LEAVE(id)
 #define WAIT_ENTER()
@@ -38,8 +42,10 @@
 #undef WAIT_ENTER
 #undef WAIT_LEAVE
 
-#define API_ENTER(x) \
-    PerfProfilerApiWrapper globalPerfProfilersWrapperInstanceForSingleApiFunction(__FUNCTION__)
+#define API_ENTER(x)                                                                            \
+    PerfProfilerApiWrapper globalPerfProfilersWrapperInstanceForSingleApiFunction(__FUNCTION__); \
+    TRACE_SCOPE(Api, __FUNCTION__, 0);                                                          \
+    METRICS_API_SCOPE(__FUNCTION__)
 
 #define SYSTEM_ENTER()      \
     PerfProfiler::create(); \
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/async_file_writer.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCLRT {
+constexpr size_t AsyncFileWriter::defaultChunkSize;
+
+AsyncFileWriter::AsyncFileWriter(std::ostream &output, size_t chunkSize, size_t maxChunksCount)
+    : output(output), chunkSize(chunkSize), maxChunksCount(std::max(maxChunksCount, static_cast<size_t>(1))) {
+    worker = Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    drain();
+    std::unique_lock<std::mutex> lock(mutex);
+    stopWorker = true;
+    lock.unlock();
+    workAvailable.notify_one();
+    worker->join();
+}
+
+void AsyncFileWriter::write(const char *data, size_t size) {
+    // current chunk is touched only by writers, copy does not block background thread
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    while (size > 0) {
+        if (!currentChunk) {
+            std::unique_lock<std::mutex> lock(mutex);
+            acquireChunk(lock);
+        }
+        auto copySize = std::min(size, chunkSize - currentChunk->used);
+        memcpy(currentChunk->data.get() + currentChunk->used, data, copySize);
+        currentChunk->used += copySize;
+        data += copySize;
+        size -= copySize;
+        if (currentChunk->used == chunkSize) {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitChunk();
+        }
+    }
+}
+
+void AsyncFileWriter::flush() {
+    std::lock_guard<std::mutex> writeLock(writeMutex);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (currentChunk && currentChunk->used > 0) {
+        submitChunk();
+    }
+}
+
+void AsyncFileWriter::drain() {
+    flush();
+    std::unique_lock<std::mutex> lock(mutex);
+    chunkReleased.wait(lock, [this] { return pendingChunks.empty() && !writing; });
+    output.flush();
+}
+
+void AsyncFileWriter::acquireChunk(std::unique_lock<std::mutex> &lock) {
+    if (freeChunks.empty() && allocatedChunksCount < maxChunksCount) {
+        currentChunk.reset(new Chunk);
+        currentChunk->data.reset(new char[chunkSize]);
+        allocatedChunksCount++;
+        return;
+    }
+    // whole arena is in flight, writer is faster than disk and has to wait
+    chunkReleased.wait(lock, [this] { return !freeChunks.empty(); });
+    currentChunk = std::move(freeChunks.back());
+    freeChunks.pop_back();
+}
+
+void AsyncFileWriter::submitChunk() {
+    // Called with mutex acquired
+    pendingChunks.push_back(std::move(currentChunk));
+    workAvailable.notify_one();
+}
+
+void *AsyncFileWriter::run(void *arg) {
+    auto self = reinterpret_cast<AsyncFileWriter *>(arg);
+    std::unique_lock<std::mutex> lock(self->mutex);
+    while (true) {
+        self->workAvailable.wait(lock, [self] { return !self->pendingChunks.empty() || self->stopWorker; });
+        // pending chunks are written before stopping, so no data is lost on destruction
+        if (self->pendingChunks.empty()) {
+            break;
+        }
+        auto chunk = std::move(self->pendingChunks.front());
+        self->pendingChunks.pop_front();
+        self->writing = true;
+        lock.unlock();
+
+        self->output.write(chunk->data.get(), chunk->used);
+
+        lock.lock();
+        chunk->used = 0;
+        self->freeChunks.push_back(std::move(chunk));
+        self->writing = false;
+        self->chunkReleased.notify_all();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
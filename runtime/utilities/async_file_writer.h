@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace OCLRT {
+class Thread;
+
+// Buffers writes in staging arena of fixed size chunks and writes full chunks to output stream on background thread.
+// Caller only pays for copy into arena, it waits for background thread only when all chunks are in flight.
+class AsyncFileWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultChunkSize = 1024 * 1024;
+
+    AsyncFileWriter(std::ostream &output, size_t chunkSize, size_t maxChunksCount);
+    ~AsyncFileWriter();
+
+    // whole data of single call stays contiguous in output, also when written from many threads
+    void write(const char *data, size_t size);
+    // hands partially filled chunk to background thread without waiting for it
+    void flush();
+    // returns once everything written so far reached output stream
+    void drain();
+
+    size_t getChunkSize() const { return chunkSize; }
+    size_t getAllocatedChunksCount() const { return allocatedChunksCount; }
+
+  protected:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t used = 0;
+    };
+
+    void acquireChunk(std::unique_lock<std::mutex> &lock);
+    void submitChunk();
+    static void *run(void *arg);
+
+    std::ostream &output;
+    const size_t chunkSize;
+    const size_t maxChunksCount;
+    size_t allocatedChunksCount = 0;
+    std::unique_ptr<Chunk> currentChunk;
+    std::deque<std::unique_ptr<Chunk>> pendingChunks;
+    std::vector<std::unique_ptr<Chunk>> freeChunks;
+    bool writing = false;
+    bool stopWorker = false;
+    // serializes writers and guards currentChunk, mutex guards state shared with background thread
+    std::mutex writeMutex;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable chunkReleased;
+    std::unique_ptr<Thread> worker;
+};
+} // namespace OCLRT
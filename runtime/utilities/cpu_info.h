@@ -48,6 +48,7 @@ struct CpuInfo {
     static const uint64_t featureAvX512Cd = 0x400000000ULL;
     static const uint64_t featureSha = 0x800000000ULL;
     static const uint64_t featureMpx = 0x1000000000ULL;
+    static const uint64_t featureAvX512Bw = 0x2000000000ULL;
 
     CpuInfo() : features(featureNone) {
     }
@@ -61,8 +62,11 @@ struct CpuInfo {
         uint32_t functionId,
         uint32_t subfunctionId) const;
 
+    uint64_t xgetbv(uint32_t index) const;
+
     void detect() const {
         uint32_t cpuInfo[4];
+        bool osSupportsAvx512 = false;
 
         cpuid(cpuInfo, 0u);
         auto numFunctionIds = cpuInfo[0];
@@ -140,6 +144,12 @@ struct CpuInfo {
             {
                 features |= cpuInfo[2] & BIT(30) ? featureRdrnd : featureNone;
             }
+
+            // AVX512 needs OS to preserve opmask and ZMM state (XCR0 bits 1, 2, 5, 6, 7)
+            if (cpuInfo[2] & BIT(27)) {
+                auto mask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+                osSupportsAvx512 = (xgetbv(0u) & mask) == mask;
+            }
         }
 
         if (numFunctionIds >= 7u) {
@@ -161,6 +171,14 @@ struct CpuInfo {
             {
                 features |= cpuInfo[1] & BIT(11) ? featureRtm : featureNone;
             }
+
+            {
+                features |= osSupportsAvx512 && (cpuInfo[1] & BIT(16)) ? featureAvX512F : featureNone;
+            }
+
+            {
+                features |= osSupportsAvx512 && (cpuInfo[1] & BIT(30)) ? featureAvX512Bw : featureNone;
+            }
         }
 
         cpuid(cpuInfo, 0x80000000);
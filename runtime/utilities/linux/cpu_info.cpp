@@ -47,4 +47,12 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t index) const {
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv"
+                     : "=a"(eax), "=d"(edx)
+                     : "c"(index));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
 } // namespace OCLRT
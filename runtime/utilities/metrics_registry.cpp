@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/metrics_registry.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+
+namespace OCLRT {
+constexpr uint32_t Histogram::subBucketBits;
+constexpr uint32_t Histogram::subBucketsCount;
+constexpr uint32_t Histogram::bucketsCount;
+constexpr uint32_t MetricsRegistry::maxAllocationTypesCount;
+
+static_assert(static_cast<uint32_t>(GraphicsAllocation::AllocationType::UNDECIDED) < MetricsRegistry::maxAllocationTypesCount, "maxAllocationTypesCount too small");
+
+uint32_t Histogram::getBucketIndex(uint64_t value) {
+    if (value < subBucketsCount) {
+        return static_cast<uint32_t>(value);
+    }
+    auto shift = static_cast<uint32_t>(Math::log2(value)) - subBucketBits;
+    return (shift + 1) * subBucketsCount + static_cast<uint32_t>((value >> shift) - subBucketsCount);
+}
+
+uint64_t Histogram::getBucketUpperBound(uint32_t bucketIndex) {
+    if (bucketIndex < 2 * subBucketsCount) {
+        return bucketIndex;
+    }
+    auto shift = bucketIndex / subBucketsCount - 1;
+    uint64_t subBucket = subBucketsCount + bucketIndex % subBucketsCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void Histogram::record(uint64_t value) {
+    buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto currentMin = min.load(std::memory_order_relaxed);
+    while (value < currentMin && !min.compare_exchange_weak(currentMin, value, std::memory_order_relaxed)) {
+    }
+    auto currentMax = max.load(std::memory_order_relaxed);
+    while (value > currentMax && !max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::getMin() const {
+    return getCount() ? min.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t Histogram::getPercentile(double percentile) const {
+    auto valuesCount = getCount();
+    if (valuesCount == 0) {
+        return 0;
+    }
+    auto rank = std::max(static_cast<uint64_t>(std::ceil(percentile / 100.0 * valuesCount)), static_cast<uint64_t>(1));
+    uint64_t valuesBelow = 0;
+    for (uint32_t bucketIndex = 0; bucketIndex < bucketsCount; bucketIndex++) {
+        valuesBelow += buckets[bucketIndex].load(std::memory_order_relaxed);
+        if (valuesBelow >= rank) {
+            return std::min(getBucketUpperBound(bucketIndex), getMax());
+        }
+    }
+    return getMax();
+}
+
+MetricsRegistry::MetricsRegistry() = default;
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry &MetricsRegistry::getInstance() {
+    // never destroyed, api histograms cached in function-local statics are used by calls
+    // from application static destructors, report is written from atexit handler instead
+    static MetricsRegistry *globalMetricsRegistry = []() {
+        auto registry = new MetricsRegistry;
+        atexit([]() {
+            if (DebugManager.flags.EnableMetrics.get()) {
+                getInstance().dumpToFile(DebugManager.flags.MetricsOutputFile.get());
+            }
+        });
+        return registry;
+    }();
+    return *globalMetricsRegistry;
+}
+
+void MetricsRegistry::recordAllocation(uint32_t allocationType, size_t size) {
+    auto metricsRegistry = getEnabledInstance();
+    if (metricsRegistry && allocationType < maxAllocationTypesCount) {
+        metricsRegistry->allocations[allocationType].count.fetch_add(1, std::memory_order_relaxed);
+        metricsRegistry->allocations[allocationType].bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+Histogram &MetricsRegistry::getApiHistogram(const char *apiName) {
+    std::lock_guard<std::mutex> lock(apiHistogramsMutex);
+    for (auto &apiHistogram : apiHistograms) {
+        if (apiHistogram.apiName == apiName) {
+            return *apiHistogram.histogram;
+        }
+    }
+    apiHistograms.push_back({apiName, std::unique_ptr<Histogram>(new Histogram)});
+    return *apiHistograms.back().histogram;
+}
+
+size_t MetricsRegistry::getApiHistogramsCount() {
+    std::lock_guard<std::mutex> lock(apiHistogramsMutex);
+    return apiHistograms.size();
+}
+
+namespace {
+void dumpHistogram(std::ostream &output, const char *kind, const char *name, const Histogram &histogram) {
+    auto count = histogram.getCount();
+    output << kind << " " << name << " count=" << count
+           << " mean=" << (count ? histogram.getSum() / count : 0)
+           << " min=" << histogram.getMin()
+           << " p50=" << histogram.getPercentile(50.0)
+           << " p90=" << histogram.getPercentile(90.0)
+           << " p99=" << histogram.getPercentile(99.0)
+           << " max=" << histogram.getMax() << "\n";
+}
+} // namespace
+
+void MetricsRegistry::dump(std::ostream &output) {
+    for (uint32_t counter = 0; counter < static_cast<uint32_t>(MetricCounter::Count); counter++) {
+        output << "counter " << getCounterName(static_cast<MetricCounter>(counter)) << " " << counters[counter].load(std::memory_order_relaxed) << "\n";
+    }
+    for (uint32_t typeIndex = 0; typeIndex < maxAllocationTypesCount; typeIndex++) {
+        auto count = allocations[typeIndex].count.load(std::memory_order_relaxed);
+        if (count) {
+            output << "allocations " << GraphicsAllocation::getAllocationTypeName(static_cast<GraphicsAllocation::AllocationType>(typeIndex))
+                   << " count=" << count << " bytes=" << allocations[typeIndex].bytes.load(std::memory_order_relaxed) << "\n";
+        }
+    }
+    for (uint32_t histogram = 0; histogram < static_cast<uint32_t>(MetricHistogram::Count); histogram++) {
+        dumpHistogram(output, "histogram", getHistogramName(static_cast<MetricHistogram>(histogram)), histograms[histogram]);
+    }
+
+    std::lock_guard<std::mutex> lock(apiHistogramsMutex);
+    for (auto &apiHistogram : apiHistograms) {
+        dumpHistogram(output, "api", apiHistogram.apiName.c_str(), *apiHistogram.histogram);
+    }
+}
+
+bool MetricsRegistry::dumpToFile(const std::string &fileName) {
+    std::ofstream outputFile(fileName, std::ios::out | std::ios::trunc);
+    if (!outputFile.good()) {
+        return false;
+    }
+    dump(outputFile);
+    return outputFile.good();
+}
+
+const char *MetricsRegistry::getCounterName(MetricCounter counter) {
+    switch (counter) {
+    case MetricCounter::Flushes:
+        return "flushes";
+    case MetricCounter::CpuCopiedBytes:
+        return "cpuCopiedBytes";
+    default:
+        return "unknown";
+    }
+}
+
+const char *MetricsRegistry::getHistogramName(MetricHistogram histogram) {
+    switch (histogram) {
+    case MetricHistogram::ResidencyListSize:
+        return "residencyListSize";
+    case MetricHistogram::WaitTime:
+        return "waitTimeNs";
+    default:
+        return "unknown";
+    }
+}
+} // namespace OCLRT
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+
+enum class MetricCounter : uint32_t {
+    Flushes,
+    CpuCopiedBytes,
+    Count
+};
+
+enum class MetricHistogram : uint32_t {
+    ResidencyListSize,
+    WaitTime,
+    Count
+};
+
+// Log-linear histogram of 64-bit values, each power of two range is split into subBucketsCount buckets,
+// so reported percentiles are within 1/subBucketsCount of the recorded values.
+// Recording is lock-free and may be done from many threads concurrently.
+class Histogram : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t subBucketBits = 4;
+    static constexpr uint32_t subBucketsCount = 1u << subBucketBits;
+    static constexpr uint32_t bucketsCount = (64 - subBucketBits + 1) * subBucketsCount;
+
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(uint32_t bucketIndex);
+
+    void record(uint64_t value);
+
+    uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t getSum() const { return sum.load(std::memory_order_relaxed); }
+    uint64_t getMin() const;
+    uint64_t getMax() const { return max.load(std::memory_order_relaxed); }
+    uint64_t getPercentile(double percentile) const;
+
+  protected:
+    std::atomic<uint64_t> buckets[bucketsCount] = {};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> min{UINT64_MAX};
+    std::atomic<uint64_t> max{0};
+};
+
+// Counters and histograms of runtime activity enabled with EnableMetrics.
+// Unlike LogApiCalls and EnableTracing only aggregates are kept, so it is cheap enough to leave on under load.
+class MetricsRegistry : NonCopyableOrMovableClass {
+  public:
+    // indexed with GraphicsAllocation::AllocationType, kept as integer so api entry points do not depend on memory manager headers
+    static constexpr uint32_t maxAllocationTypesCount = 32;
+
+    MetricsRegistry();
+    ~MetricsRegistry();
+
+    static MetricsRegistry &getInstance();
+    static MetricsRegistry *getEnabledInstance() {
+        return DebugManager.flags.EnableMetrics.get() ? &getInstance() : nullptr;
+    }
+
+    static uint64_t getTimestamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static void increment(MetricCounter counter, uint64_t value = 1) {
+        if (auto metricsRegistry = getEnabledInstance()) {
+            metricsRegistry->counters[static_cast<uint32_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+    static void record(MetricHistogram histogram, uint64_t value) {
+        if (auto metricsRegistry = getEnabledInstance()) {
+            metricsRegistry->getHistogram(histogram).record(value);
+        }
+    }
+    static void recordAllocation(uint32_t allocationType, size_t size);
+    static Histogram *getEnabledApiHistogram(const char *apiName) {
+        auto metricsRegistry = getEnabledInstance();
+        return metricsRegistry ? &metricsRegistry->getApiHistogram(apiName) : nullptr;
+    }
+
+    uint64_t getCounter(MetricCounter counter) const {
+        return counters[static_cast<uint32_t>(counter)].load(std::memory_order_relaxed);
+    }
+    uint64_t getAllocationsCount(uint32_t allocationType) const {
+        return allocations[allocationType].count.load(std::memory_order_relaxed);
+    }
+    uint64_t getAllocatedBytes(uint32_t allocationType) const {
+        return allocations[allocationType].bytes.load(std::memory_order_relaxed);
+    }
+    Histogram &getHistogram(MetricHistogram histogram) { return histograms[static_cast<uint32_t>(histogram)]; }
+    Histogram &getApiHistogram(const char *apiName);
+    size_t getApiHistogramsCount();
+
+    void dump(std::ostream &output);
+    bool dumpToFile(const std::string &fileName);
+
+    static const char *getCounterName(MetricCounter counter);
+    static const char *getHistogramName(MetricHistogram histogram);
+
+  protected:
+    struct AllocationStatistics {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+    };
+    struct ApiHistogram {
+        std::string apiName;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    std::atomic<uint64_t> counters[static_cast<uint32_t>(MetricCounter::Count)] = {};
+    AllocationStatistics allocations[maxAllocationTypesCount];
+    Histogram histograms[static_cast<uint32_t>(MetricHistogram::Count)];
+    std::mutex apiHistogramsMutex;
+    std::vector<ApiHistogram> apiHistograms;
+};
+
+// Records duration of enclosing scope in nanoseconds, does nothing for nullptr histogram.
+class MetricsScope : NonCopyableOrMovableClass {
+  public:
+    MetricsScope(Histogram *histogram) : histogram(histogram) {
+        if (histogram) {
+            start = MetricsRegistry::getTimestamp();
+        }
+    }
+
+    ~MetricsScope() {
+        if (histogram) {
+            histogram->record(MetricsRegistry::getTimestamp() - start);
+        }
+    }
+
+  protected:
+    Histogram *histogram;
+    uint64_t start = 0;
+};
+} // namespace OCLRT
+
+// histogram of an api function is looked up once, on its first call
+#define METRICS_API_SCOPE(apiName)                                                                                               \
+    static OCLRT::Histogram *const apiLatencyHistogramForSingleCall = OCLRT::MetricsRegistry::getEnabledApiHistogram(apiName); \
+    OCLRT::MetricsScope metricsApiScopeForSingleCall(apiLatencyHistogramForSingleCall)
+
+#define METRICS_SCOPE(histogram)                                                                                     \
+    OCLRT::MetricsScope metricsScopeForSingleCall(OCLRT::MetricsRegistry::getEnabledInstance()                       \
+                                                      ? &OCLRT::MetricsRegistry::getInstance().getHistogram(histogram) \
+                                                      : nullptr)
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/object_pool.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+#include <new>
+#include <type_traits>
+
+namespace OCLRT {
+namespace PooledObjects {
+namespace {
+// every block starts with a header identifying the pool it came from (nullptr for heap blocks)
+struct BlockHeader {
+    ObjectPool *pool;
+};
+constexpr size_t headerSize = alignof(std::max_align_t) > sizeof(BlockHeader) ? alignof(std::max_align_t) : sizeof(BlockHeader);
+
+constexpr size_t sizeClassesCount = 6;
+static_assert((minBlockSize << (sizeClassesCount - 1)) == maxBlockSize, "size classes have to cover [minBlockSize, maxBlockSize]");
+
+class SizeClassPools {
+  public:
+    SizeClassPools() {
+        for (size_t i = 0; i < sizeClassesCount; i++) {
+            auto blockSize = minBlockSize << i;
+            new (&storage[i]) ObjectPool(blockSize, slabSize / blockSize);
+        }
+    }
+
+    ObjectPool *getPool(size_t sizeClass) {
+        return reinterpret_cast<ObjectPool *>(&storage[sizeClass]);
+    }
+
+  protected:
+    std::aligned_storage<sizeof(ObjectPool), alignof(ObjectPool)>::type storage[sizeClassesCount];
+};
+
+SizeClassPools &getPools() {
+    // pools are never destroyed, pooled objects may still be released during static destruction
+    static std::aligned_storage<sizeof(SizeClassPools), alignof(SizeClassPools)>::type poolsStorage;
+    static SizeClassPools *pools = new (&poolsStorage) SizeClassPools;
+    return *pools;
+}
+} // namespace
+
+ObjectPool *getPoolForSize(size_t size) {
+    size_t blockSize = minBlockSize;
+    for (size_t i = 0; i < sizeClassesCount; i++) {
+        if (size <= blockSize) {
+            return getPools().getPool(i);
+        }
+        blockSize <<= 1;
+    }
+    return nullptr;
+}
+
+void *allocate(size_t size) {
+    auto ptr = allocate(size, std::nothrow);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *allocate(size_t size, const std::nothrow_t &) noexcept {
+    ObjectPool *pool = nullptr;
+    if (DebugManager.flags.EnableObjectPooling.get()) {
+        pool = getPoolForSize(size + headerSize);
+    }
+    void *block = pool ? pool->allocate(std::nothrow) : ::operator new(size + headerSize, std::nothrow);
+    if (block == nullptr) {
+        return nullptr;
+    }
+    static_cast<BlockHeader *>(block)->pool = pool;
+    return static_cast<uint8_t *>(block) + headerSize;
+}
+
+void free(void *ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    auto block = static_cast<uint8_t *>(ptr) - headerSize;
+    auto pool = reinterpret_cast<BlockHeader *>(block)->pool;
+    if (pool) {
+        pool->free(block);
+    } else {
+        ::operator delete(block);
+    }
+}
+
+void trim() {
+    for (size_t i = 0; i < sizeClassesCount; i++) {
+        getPools().getPool(i)->trim();
+    }
+}
+} // namespace PooledObjects
+} // namespace OCLRT
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/utilities/spinlock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace OCLRT {
+
+// Hands out fixed-size memory blocks carved out of larger slabs.
+// Released blocks are kept on a free list and reused by subsequent allocations.
+class ObjectPool : NonCopyableOrMovableClass {
+  public:
+    ObjectPool(size_t blockSize, size_t blocksPerSlab)
+        : blockSize(alignBlockSize(blockSize)), blocksPerSlab(blocksPerSlab) {
+        DEBUG_BREAK_IF(blocksPerSlab == 0);
+    }
+
+    ~ObjectPool() {
+        releaseSlabs();
+    }
+
+    void *allocate() {
+        auto block = allocate(std::nothrow);
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        return block;
+    }
+
+    // returns nullptr when memory for a new slab can't be allocated
+    void *allocate(const std::nothrow_t &) noexcept {
+        std::unique_lock<SpinLock> lock(poolLock);
+        if (freeBlocks == nullptr && !populateFreeBlocks()) {
+            return nullptr;
+        }
+        auto block = freeBlocks;
+        freeBlocks = block->next;
+        usedBlocksCount++;
+        return block;
+    }
+
+    void free(void *ptr) {
+        if (ptr == nullptr) {
+            return;
+        }
+        std::unique_lock<SpinLock> lock(poolLock);
+        DEBUG_BREAK_IF(usedBlocksCount == 0);
+        auto block = static_cast<FreeBlock *>(ptr);
+        block->next = freeBlocks;
+        freeBlocks = block;
+        usedBlocksCount--;
+    }
+
+    // releases slab memory back to the system when no block is in use
+    bool trim() {
+        std::unique_lock<SpinLock> lock(poolLock);
+        if (usedBlocksCount != 0) {
+            return false;
+        }
+        freeBlocks = nullptr;
+        releaseSlabs();
+        return true;
+    }
+
+    size_t getBlockSize() const { return blockSize; }
+    size_t peekSlabsCount() const { return slabsCount; }
+    size_t peekUsedBlocksCount() const { return usedBlocksCount; }
+
+  protected:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    // slabs are linked through a header at their start, so adding one needs no other allocation
+    struct SlabHeader {
+        SlabHeader *next;
+    };
+
+    static constexpr size_t alignBlockSize(size_t size) {
+        return ((size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    }
+
+    bool populateFreeBlocks() {
+        constexpr size_t slabHeaderSize = alignBlockSize(sizeof(SlabHeader));
+        auto slabMemory = new (std::nothrow) uint8_t[slabHeaderSize + blockSize * blocksPerSlab];
+        if (slabMemory == nullptr) {
+            return false;
+        }
+        auto slab = reinterpret_cast<SlabHeader *>(slabMemory);
+        slab->next = slabs;
+        slabs = slab;
+        slabsCount++;
+
+        auto slabStart = slabMemory + slabHeaderSize;
+        for (size_t i = blocksPerSlab; i > 0; i--) {
+            auto block = reinterpret_cast<FreeBlock *>(slabStart + (i - 1) * blockSize);
+            block->next = freeBlocks;
+            freeBlocks = block;
+        }
+        return true;
+    }
+
+    void releaseSlabs() {
+        while (slabs != nullptr) {
+            auto next = slabs->next;
+            delete[] reinterpret_cast<uint8_t *>(slabs);
+            slabs = next;
+        }
+        slabsCount = 0;
+    }
+
+    const size_t blockSize;
+    const size_t blocksPerSlab;
+    FreeBlock *freeBlocks = nullptr;
+    size_t usedBlocksCount = 0;
+    SlabHeader *slabs = nullptr;
+    size_t slabsCount = 0;
+    SpinLock poolLock;
+};
+
+// Size-class front-end over a set of ObjectPools, used by frequently created runtime objects
+// (events, memory objects, blocked commands, kernel operations). Pooling is enabled with EnableObjectPooling.
+namespace PooledObjects {
+constexpr size_t minBlockSize = 64;
+constexpr size_t maxBlockSize = 2048;
+constexpr size_t slabSize = 64 * 1024;
+
+void *allocate(size_t size);
+void *allocate(size_t size, const std::nothrow_t &) noexcept;
+void free(void *ptr);
+void trim();
+ObjectPool *getPoolForSize(size_t size);
+} // namespace PooledObjects
+
+} // namespace OCLRT
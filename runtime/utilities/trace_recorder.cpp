@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/trace_recorder.h"
+#include "runtime/helpers/basic_math.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace OCLRT {
+
+namespace {
+std::atomic<uint64_t> recordersCount{0};
+
+struct CurrentThreadRingBuffer {
+    uint64_t recorderId;
+    TraceRingBuffer *ringBuffer;
+};
+thread_local CurrentThreadRingBuffer currentThreadRingBuffer = {0, nullptr};
+
+void writeMicroseconds(std::ostream &output, uint64_t nanoseconds) {
+    output << nanoseconds / 1000 << "." << std::setw(3) << std::setfill('0') << nanoseconds % 1000 << std::setfill(' ');
+}
+} // namespace
+
+TraceRingBuffer::TraceRingBuffer(size_t capacity, uint32_t threadId) : threadId(threadId), ownerThread(std::this_thread::get_id()) {
+    capacity = static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(std::max(capacity, static_cast<size_t>(2)))));
+    events.reset(new TraceEvent[capacity]);
+    mask = capacity - 1;
+}
+
+void TraceRingBuffer::copyEvents(std::vector<TraceEvent> &output) const {
+    auto capacity = getCapacity();
+    auto end = writeIndex.load(std::memory_order_acquire);
+    auto begin = end > capacity ? end - capacity : 0u;
+    auto firstCopied = output.size();
+    for (auto index = begin; index < end; index++) {
+        output.push_back(events[index & mask]);
+    }
+
+    // owning thread could overwrite the oldest entries while they were copied, drop them
+    // together with the slot of event that may be half-written at index endAfterCopy
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto endAfterCopy = writeIndex.load(std::memory_order_relaxed);
+    if (endAfterCopy + 1 > begin + capacity) {
+        auto overwrittenCount = static_cast<size_t>(std::min(endAfterCopy + 1 - capacity - begin, end - begin));
+        output.erase(output.begin() + firstCopied, output.begin() + firstCopied + overwrittenCount);
+    }
+}
+
+TraceRecorder::TraceRecorder(size_t ringBufferCapacity) : recorderId(++recordersCount), ringBufferCapacity(ringBufferCapacity) {
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+TraceRecorder &TraceRecorder::getInstance() {
+    // never destroyed, platform teardown and application static destructors may still record events
+    // into it and threads keep cached pointers to its ring buffers
+    static TraceRecorder *globalTraceRecorder = []() {
+        auto recorder = new TraceRecorder(static_cast<size_t>(DebugManager.flags.TracingRingBufferSize.get()));
+        atexit([]() {
+            if (DebugManager.flags.EnableTracing.get()) {
+                getInstance().dumpToFile(DebugManager.flags.TracingOutputFile.get());
+            }
+        });
+        return recorder;
+    }();
+    return *globalTraceRecorder;
+}
+
+TraceRingBuffer &TraceRecorder::getRingBufferForCurrentThread() {
+    if (currentThreadRingBuffer.recorderId != recorderId) {
+        std::lock_guard<std::mutex> lock(ringBuffersMutex);
+        auto ownerThread = std::this_thread::get_id();
+        auto ringBuffer = std::find_if(ringBuffers.begin(), ringBuffers.end(), [&](const std::unique_ptr<TraceRingBuffer> &ringBuffer) {
+            return ringBuffer->getOwnerThread() == ownerThread;
+        });
+        if (ringBuffer == ringBuffers.end()) {
+            auto threadId = static_cast<uint32_t>(ringBuffers.size() + 1);
+            ringBuffers.emplace_back(new TraceRingBuffer(ringBufferCapacity, threadId));
+            ringBuffer = ringBuffers.end() - 1;
+        }
+        currentThreadRingBuffer = {recorderId, ringBuffer->get()};
+    }
+    return *currentThreadRingBuffer.ringBuffer;
+}
+
+size_t TraceRecorder::getRingBuffersCount() {
+    std::lock_guard<std::mutex> lock(ringBuffersMutex);
+    return ringBuffers.size();
+}
+
+const char *TraceRecorder::getCategoryName(TraceCategory category) {
+    switch (category) {
+    case TraceCategory::Api:
+        return "api";
+    case TraceCategory::FlushTask:
+        return "flushTask";
+    case TraceCategory::System:
+        return "system";
+    case TraceCategory::Wait:
+        return "wait";
+    case TraceCategory::Allocation:
+        return "allocation";
+    case TraceCategory::Queued:
+        return "queued";
+    case TraceCategory::Submitted:
+        return "submitted";
+    case TraceCategory::GpuExecution:
+        return "gpuExecution";
+    }
+    return "unknown";
+}
+
+void TraceRecorder::dump(std::ostream &output) {
+    std::lock_guard<std::mutex> lock(ringBuffersMutex);
+    std::vector<TraceEvent> events;
+    bool firstEvent = true;
+    uint64_t asyncId = 0;
+
+    // event names are function names and string literals, no escaping is needed
+    output << "{\"traceEvents\":[";
+    for (auto &ringBuffer : ringBuffers) {
+        events.clear();
+        ringBuffer->copyEvents(events);
+        for (auto &event : events) {
+            output << (firstEvent ? "\n" : ",\n");
+            firstEvent = false;
+            if (event.track == TraceEvent::hostThreadTrack) {
+                output << "{\"name\":\"" << event.name << "\",\"cat\":\"" << getCategoryName(event.category)
+                       << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << ringBuffer->getThreadId() << ",\"ts\":";
+                writeMicroseconds(output, event.start);
+                output << ",\"dur\":";
+                writeMicroseconds(output, event.duration);
+                output << ",\"args\":{\"value\":" << event.argument << "}}";
+                continue;
+            }
+
+            // commands in flight overlap on GPU tracks, async begin/end pairs do not have to nest
+            asyncId++;
+            auto writeAsyncPhase = [&](const char *phase, uint64_t timestamp) {
+                output << "{\"name\":\"" << event.name << "\",\"cat\":\"" << getCategoryName(event.category)
+                       << "\",\"ph\":\"" << phase << "\",\"id\":" << asyncId << ",\"pid\":1,\"tid\":" << event.track << ",\"ts\":";
+                writeMicroseconds(output, timestamp);
+                output << ",\"args\":{\"value\":" << event.argument << "}}";
+            };
+            writeAsyncPhase("b", event.start);
+            output << ",\n";
+            writeAsyncPhase("e", event.start + event.duration);
+        }
+    }
+    if (asyncId > 0) {
+        output << ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"GPU\"}}";
+    }
+    output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+bool TraceRecorder::dumpToFile(const std::string &fileName) {
+    std::ofstream outputFile(fileName, std::ios::out | std::ios::trunc);
+    if (!outputFile.good()) {
+        return false;
+    }
+    dump(outputFile);
+    return outputFile.good();
+}
+} // namespace OCLRT
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OCLRT {
+
+enum class TraceCategory : uint32_t {
+    Api,
+    FlushTask,
+    System,
+    Wait,
+    Allocation,
+    Queued,
+    Submitted,
+    GpuExecution
+};
+
+struct TraceEvent {
+    // events of the host thread that recorded them, other tracks are GPU engines
+    static constexpr uint32_t hostThreadTrack = 0;
+
+    const char *name;
+    uint64_t start;
+    uint64_t duration;
+    uint64_t argument;
+    TraceCategory category;
+    uint32_t track = hostThreadTrack;
+};
+
+// Fixed-size buffer of the most recent events recorded by a single thread.
+// Only the owning thread writes, snapshots may be taken from any thread without blocking it.
+class TraceRingBuffer : NonCopyableOrMovableClass {
+  public:
+    TraceRingBuffer(size_t capacity, uint32_t threadId);
+
+    void record(const TraceEvent &event) {
+        auto index = writeIndex.load(std::memory_order_relaxed);
+        events[index & mask] = event;
+        writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    void copyEvents(std::vector<TraceEvent> &output) const;
+
+    size_t getCapacity() const { return mask + 1; }
+    uint32_t getThreadId() const { return threadId; }
+    std::thread::id getOwnerThread() const { return ownerThread; }
+    uint64_t getRecordedEventsCount() const { return writeIndex.load(std::memory_order_acquire); }
+
+  protected:
+    std::unique_ptr<TraceEvent[]> events;
+    size_t mask;
+    uint32_t threadId;
+    std::thread::id ownerThread;
+    std::atomic<uint64_t> writeIndex{0};
+};
+
+// Collects events of all threads enabled with EnableTracing and dumps them in Chrome trace event format,
+// which can be loaded by chrome://tracing and Perfetto UI.
+class TraceRecorder : NonCopyableOrMovableClass {
+  public:
+    TraceRecorder(size_t ringBufferCapacity);
+    ~TraceRecorder();
+
+    static TraceRecorder &getInstance();
+    static TraceRecorder *getEnabledInstance() {
+        return DebugManager.flags.EnableTracing.get() ? &getInstance() : nullptr;
+    }
+
+    static uint64_t getTimestamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void record(TraceCategory category, const char *name, uint64_t start, uint64_t end, uint64_t argument, uint32_t track = TraceEvent::hostThreadTrack) {
+        getRingBufferForCurrentThread().record({name, start, end - start, argument, category, track});
+    }
+
+    TraceRingBuffer &getRingBufferForCurrentThread();
+    size_t getRingBuffersCount();
+
+    void dump(std::ostream &output);
+    bool dumpToFile(const std::string &fileName);
+
+    static const char *getCategoryName(TraceCategory category);
+
+  protected:
+    const uint64_t recorderId;
+    const size_t ringBufferCapacity;
+    std::mutex ringBuffersMutex;
+    std::vector<std::unique_ptr<TraceRingBuffer>> ringBuffers;
+};
+
+class TraceScope : NonCopyableOrMovableClass {
+  public:
+    TraceScope(TraceCategory category, const char *name, uint64_t argument = 0, TraceRecorder *recorder = TraceRecorder::getEnabledInstance())
+        : recorder(recorder), name(name), argument(argument), category(category) {
+        if (recorder) {
+            start = TraceRecorder::getTimestamp();
+        }
+    }
+
+    ~TraceScope() {
+        if (recorder) {
+            recorder->record(category, name, start, TraceRecorder::getTimestamp(), argument);
+        }
+    }
+
+  protected:
+    TraceRecorder *recorder;
+    const char *name;
+    uint64_t argument;
+    uint64_t start = 0;
+    TraceCategory category;
+};
+} // namespace OCLRT
+
+#define TRACE_SCOPE(category, name, argument) \
+    OCLRT::TraceScope traceScopeForSingleCall(OCLRT::TraceCategory::category, name, static_cast<uint64_t>(argument))
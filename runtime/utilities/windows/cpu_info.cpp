@@ -21,6 +21,7 @@
  */
 
 #include "runtime/utilities/cpu_info.h"
+#include <immintrin.h>
 #include <intrin.h>
 
 namespace OCLRT {
@@ -46,4 +47,8 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t index) const {
+    return _xgetbv(index);
+}
+
 } // namespace OCLRT
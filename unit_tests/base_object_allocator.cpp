@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "runtime/platform/platform.h"
 #include "runtime/program/program.h"
 #include "runtime/sampler/sampler.h"
+#include "runtime/utilities/object_pool.h"
 
 #include <mutex>
 
@@ -60,6 +61,66 @@ void BaseObject<B>::operator delete(void *ptr, const std::nothrow_t &tag) noexce
     return ::operator delete(ptr, tag);
 }
 
+template <>
+void *BaseObject<_cl_event>::operator new(size_t sz) {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    ++numBaseObjects;
+    return PooledObjects::allocate(sz);
+}
+
+template <>
+void BaseObject<_cl_event>::operator delete(void *ptr, size_t) {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    --numBaseObjects;
+    PooledObjects::free(ptr);
+}
+
+template <>
+void *BaseObject<_cl_event>::operator new(size_t sz, const std::nothrow_t &tag) noexcept {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    void *ptr = PooledObjects::allocate(sz, tag);
+    if (ptr)
+        ++numBaseObjects;
+    return ptr;
+}
+
+template <>
+void BaseObject<_cl_event>::operator delete(void *ptr, const std::nothrow_t &tag) noexcept {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    --numBaseObjects;
+    PooledObjects::free(ptr);
+}
+
+template <>
+void *BaseObject<_cl_mem>::operator new(size_t sz) {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    ++numBaseObjects;
+    return PooledObjects::allocate(sz);
+}
+
+template <>
+void BaseObject<_cl_mem>::operator delete(void *ptr, size_t) {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    --numBaseObjects;
+    PooledObjects::free(ptr);
+}
+
+template <>
+void *BaseObject<_cl_mem>::operator new(size_t sz, const std::nothrow_t &tag) noexcept {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    void *ptr = PooledObjects::allocate(sz, tag);
+    if (ptr)
+        ++numBaseObjects;
+    return ptr;
+}
+
+template <>
+void BaseObject<_cl_mem>::operator delete(void *ptr, const std::nothrow_t &tag) noexcept {
+    std::lock_guard<std::mutex> lock(numBaseObjectsMutex);
+    --numBaseObjects;
+    PooledObjects::free(ptr);
+}
+
 template class BaseObject<_cl_accelerator_intel>;
 template class BaseObject<_cl_command_queue>;
 template class BaseObject<_cl_context>;
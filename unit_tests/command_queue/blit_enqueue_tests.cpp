@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/user_event.h"
+#include "runtime/helpers/timestamp_packet.h"
+#include "runtime/mem_obj/buffer.h"
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/libult/ult_command_stream_receiver.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+struct BlitEnqueueTests : public ::testing::Test {
+    template <typename FamilyType>
+    void setUpT() {
+        DebugManager.flags.EnableBlitterOperationsSupport.set(true);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+        context = std::make_unique<MockContext>(device.get());
+
+        cl_int retVal = CL_SUCCESS;
+        srcBuffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+        dstBuffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    }
+
+    template <typename FamilyType>
+    UltCommandStreamReceiver<FamilyType> &getBcsCsr() {
+        return static_cast<UltCommandStreamReceiver<FamilyType> &>(*device->getBlitterEngine()->commandStreamReceiver);
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr size_t bufferSize = 1024;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<Buffer> srcBuffer;
+    std::unique_ptr<Buffer> dstBuffer;
+};
+
+constexpr size_t BlitEnqueueTests::bufferSize;
+
+HWTEST_F(BlitEnqueueTests, givenBlitterEngineWhenEnqueueCopyBufferIsCalledThenCopyIsSubmittedToBlitterAndComputeQueueWaitsForIt) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    setUpT<FamilyType>();
+
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto &bcsCsr = getBcsCsr<FamilyType>();
+    auto bcsTaskCount = bcsCsr.peekTaskCount();
+
+    auto retVal = cmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, bufferSize, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(bcsTaskCount + 1, bcsCsr.peekTaskCount());
+
+    HardwareParse bcsParser;
+    bcsParser.parseCommands<FamilyType>(bcsCsr.commandStream);
+    auto bltItor = find<XY_SRC_COPY_BLT *>(bcsParser.cmdList.begin(), bcsParser.cmdList.end());
+    ASSERT_NE(bcsParser.cmdList.end(), bltItor);
+    auto bltCmd = genCmdCast<XY_SRC_COPY_BLT *>(*bltItor);
+    EXPECT_EQ(srcBuffer->getGraphicsAllocation()->getGpuAddress() + srcBuffer->getOffset(), bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(dstBuffer->getGraphicsAllocation()->getGpuAddress() + dstBuffer->getOffset(), bltCmd->getDestinationBaseAddress());
+
+    ASSERT_EQ(1u, cmdQ->timestampPacketContainer->peekNodes().size());
+    auto blitOutputAddress = cmdQ->timestampPacketContainer->peekNodes()[0]->tag->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd);
+
+    HardwareParse queueParser;
+    queueParser.parseCommands<FamilyType>(*cmdQ->commandStream);
+    bool semaphoreOnBlitFound = false;
+    for (auto &cmd : queueParser.cmdList) {
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(cmd);
+        if (semaphoreCmd && semaphoreCmd->getSemaphoreGraphicsAddress() == blitOutputAddress) {
+            semaphoreOnBlitFound = true;
+        }
+    }
+    EXPECT_TRUE(semaphoreOnBlitFound);
+    EXPECT_EQ(queueParser.cmdList.end(), find<typename FamilyType::GPGPU_WALKER *>(queueParser.cmdList.begin(), queueParser.cmdList.end()));
+}
+
+HWTEST_F(BlitEnqueueTests, givenUserEventInWaitListWhenAskedIfBlitEnqueueIsAllowedThenReturnFalse) {
+    setUpT<FamilyType>();
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+
+    UserEvent userEvent;
+    cl_event waitList[] = {&userEvent};
+    EXPECT_TRUE(cmdQ->isBlitEnqueueAllowed(srcBuffer.get(), dstBuffer.get(), 0, nullptr));
+    EXPECT_FALSE(cmdQ->isBlitEnqueueAllowed(srcBuffer.get(), dstBuffer.get(), 1, waitList));
+}
+
+HWTEST_F(BlitEnqueueTests, givenProfilingQueueWhenAskedIfBlitEnqueueIsAllowedThenReturnFalse) {
+    setUpT<FamilyType>();
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), properties);
+
+    EXPECT_FALSE(cmdQ->isBlitEnqueueAllowed(srcBuffer.get(), dstBuffer.get(), 0, nullptr));
+}
+
+HWTEST_F(BlitEnqueueTests, givenTimestampPacketWriteDisabledWhenAskedIfBlitEnqueueIsAllowedThenReturnFalse) {
+    setUpT<FamilyType>();
+    device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = false;
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+
+    EXPECT_FALSE(cmdQ->isBlitEnqueueAllowed(srcBuffer.get(), dstBuffer.get(), 0, nullptr));
+}
@@ -9,6 +9,7 @@
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/event/user_event.h"
 #include "runtime/os_interface/os_context.h"
 #include "reg_configs_common.h"
 #include "runtime/helpers/ptr_math.h"
@@ -18,6 +19,7 @@
 #include "unit_tests/command_queue/enqueue_fixture.h"
 #include "unit_tests/command_queue/enqueue_fill_buffer_fixture.h"
 #include "unit_tests/gen_common/gen_commands_common_validation.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/helpers/unit_test_helper.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "test.h"
@@ -504,3 +506,54 @@ HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationI
 
     EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
 }
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenCpuFillEnabledAndIdleQueueWhenZeroCopyBufferIsFilledThenPatternIsWrittenOnCpuWithoutGpuSubmission) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuFillBuffer.set(true);
+
+    auto &csr = pCmdQ->getCommandStreamReceiver();
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+    ASSERT_TRUE(dstBuffer->isMemObjZeroCopy());
+    auto bufferMemory = reinterpret_cast<uint8_t *>(dstBuffer->getCpuAddressForMemoryTransfer());
+    memset(bufferMemory, 0, dstBuffer->getSize());
+
+    const uint8_t pattern[4] = {0x1, 0x2, 0x3, 0x4};
+    const size_t offset = sizeof(pattern);
+    const size_t size = dstBuffer->getSize() - 2 * sizeof(pattern);
+    auto taskCountBefore = csr.peekTaskCount();
+    cl_event event = nullptr;
+
+    auto retVal = pCmdQ->enqueueFillBuffer(dstBuffer.get(), pattern, sizeof(pattern), offset, size, 0, nullptr, &event);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+    EXPECT_EQ(0u, bufferMemory[offset - 1]);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(pattern[i % sizeof(pattern)], bufferMemory[offset + i]) << i;
+    }
+    EXPECT_EQ(0u, bufferMemory[offset + size]);
+
+    auto pEvent = castToObject<Event>(event);
+    ASSERT_NE(nullptr, pEvent);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_FILL_BUFFER), pEvent->getCommandType());
+    EXPECT_EQ(CL_COMPLETE, pEvent->peekExecutionStatus());
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenCpuFillEnabledAndEventsInWaitListWhenBufferIsFilledThenBuiltinKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuFillBuffer.set(true);
+
+    auto &csr = pCmdQ->getCommandStreamReceiver();
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+    UserEvent userEvent;
+    userEvent.setStatus(CL_COMPLETE);
+    cl_event waitList[] = {&userEvent};
+
+    const uint32_t pattern = 0xdeadbeef;
+    auto retVal = pCmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), 0, sizeof(pattern), 1, waitList, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+}
@@ -1,14 +1,16 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/command_stream/aub_subcapture.h"
 #include "runtime/event/user_event.h"
 #include "runtime/memory_manager/surface.h"
 #include "unit_tests/fixtures/enqueue_handler_fixture.h"
+#include "unit_tests/helpers/hw_parse.h"
 #include "unit_tests/mocks/mock_command_queue.h"
 #include "unit_tests/mocks/mock_csr.h"
 #include "unit_tests/mocks/mock_context.h"
@@ -360,3 +362,121 @@ HWTEST_F(EnqueueHandlerTestBasic, givenEnqueueHandlerWhenCommandIsBlokingThenCom
     EXPECT_EQ(mockCsr->waitForTaskCountRequiredTaskCount, mockCmdQ->completionStampTaskCount);
     mockCmdQ->release();
 }
+
+HWTEST_F(EnqueueHandlerTest, givenLocalWorkSizeTunerWhenKernelWithNullLocalSizeIsEnqueuedThenTrialWithTimestampsIsDispatched) {
+    typedef typename FamilyType::MI_STORE_REGISTER_MEM MI_STORE_REGISTER_MEM;
+    MockKernelWithInternals mockKernel(*pDevice);
+    mockKernel.mockKernel->localWorkSizeTuner.reset(new LocalWorkSizeTuner(""));
+    auto &tuner = *mockKernel.mockKernel->getLocalWorkSizeTuner();
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    size_t gws[] = {1024, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, tuner.peekPendingTrialsCount());
+    EXPECT_EQ(1u, tuner.peekEntriesCount());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(mockCmdQ->getCS(0), 0);
+    EXPECT_LE(4u, hwParser.getCommandCount<MI_STORE_REGISTER_MEM>());
+
+    *csr.getTagAddress() = csr.peekTaskCount();
+    tuner.retireCompletedTrials();
+    EXPECT_EQ(0u, tuner.peekPendingTrialsCount());
+}
+
+HWTEST_F(EnqueueHandlerTest, givenLocalWorkSizeTunerWhenKernelIsEnqueuedOnBlockedQueueThenTrialIsCancelled) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    mockKernel.mockKernel->localWorkSizeTuner.reset(new LocalWorkSizeTuner(""));
+    auto &tuner = *mockKernel.mockKernel->getLocalWorkSizeTuner();
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    UserEvent userEvent(context);
+    cl_event clUserEvent = &userEvent;
+    size_t gws[] = {1024, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, &clUserEvent, nullptr);
+    EXPECT_EQ(0u, tuner.peekPendingTrialsCount());
+    EXPECT_EQ(1u, tuner.peekEntriesCount());
+
+    // candidate of blocked enqueue is released, so it is still tried required number of times
+    DispatchInfo dispatchInfo(mockKernel.mockKernel, 1, {1024, 1, 1}, {0, 0, 0}, {0, 0, 0});
+    auto key = createLocalWorkSizeCacheKey(dispatchInfo);
+    auto defaultLocalWorkSize = computeWorkgroupSize(dispatchInfo);
+    bool trialRequired = false;
+    for (uint32_t i = 0; i < LocalWorkSizeTuner::measurementsPerCandidate; i++) {
+        EXPECT_EQ(defaultLocalWorkSize, tuner.selectLocalWorkSize(key, defaultLocalWorkSize, trialRequired));
+        EXPECT_TRUE(trialRequired);
+    }
+
+    userEvent.setStatus(CL_COMPLETE);
+    mockCmdQ->isQueueBlocked();
+}
+
+HWTEST_F(EnqueueHandlerTest, givenLocalWorkSizeTunerWhenKernelWithExplicitLocalSizeIsEnqueuedThenNoTrialIsDispatched) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    mockKernel.mockKernel->localWorkSizeTuner.reset(new LocalWorkSizeTuner(""));
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    size_t gws[] = {1024, 1, 1};
+    size_t lws[] = {64, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    EXPECT_EQ(0u, mockKernel.mockKernel->getLocalWorkSizeTuner()->peekPendingTrialsCount());
+    EXPECT_EQ(0u, mockKernel.mockKernel->getLocalWorkSizeTuner()->peekEntriesCount());
+}
+
+HWTEST_F(EnqueueHandlerTest, givenLocalWorkSizeTunerWhenKernelIsEnqueuedWithProfiledEventThenNoTrialIsDispatched) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    mockKernel.mockKernel->localWorkSizeTuner.reset(new LocalWorkSizeTuner(""));
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, properties));
+
+    size_t gws[] = {1024, 1, 1};
+    cl_event event = nullptr;
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(0u, mockKernel.mockKernel->getLocalWorkSizeTuner()->peekPendingTrialsCount());
+    castToObject<Event>(event)->release();
+}
+
+HWTEST_F(EnqueueHandlerTest, givenCrossThreadDataReuseEnabledWhenSameKernelIsEnqueuedTwiceThenIndirectDataIsNotCopiedAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableCrossThreadDataReuse.set(true);
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    size_t gws[] = {64, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    auto &ioh = mockCmdQ->getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 0);
+    auto iohUsed = ioh.getUsed();
+
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(iohUsed, ioh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getCrossThreadDataTracker().peekReusedCount());
+}
+
+HWTEST_F(EnqueueHandlerTest, givenCrossThreadDataReuseEnabledWhenChangedKernelIsEnqueuedAfterPreviousCompletedThenOnlyDirtyDwordsArePatched) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableCrossThreadDataReuse.set(true);
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    size_t gws[] = {64, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    auto &ioh = mockCmdQ->getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 0);
+    auto iohUsed = ioh.getUsed();
+
+    auto crossThreadData = reinterpret_cast<uint32_t *>(mockKernel.mockKernel->getCrossThreadData());
+    crossThreadData[10] = 0x1234;
+    *csr.getTagAddress() = csr.peekTaskCount();
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(iohUsed, ioh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getCrossThreadDataTracker().peekPatchedDwordsCount());
+
+    crossThreadData[10] = 0x5678;
+    *csr.getTagAddress() = 0;
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_LT(iohUsed, ioh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getCrossThreadDataTracker().peekReusedCount());
+    *csr.getTagAddress() = csr.peekTaskCount();
+}
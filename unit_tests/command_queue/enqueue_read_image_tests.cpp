@@ -6,6 +6,7 @@
  */
 
 #include "runtime/built_ins/builtins_dispatch_builder.h"
+#include "runtime/helpers/tiled_image_copy.h"
 #include "runtime/memory_manager/allocations_list.h"
 #include "reg_configs_common.h"
 #include "unit_tests/command_queue/enqueue_read_image_fixture.h"
@@ -423,6 +424,61 @@ HWTEST_F(EnqueueReadImageTest, givenEnqueueReadImageNonBlockingWhenAUBDumpAllocs
     EXPECT_FALSE(srcImage->getGraphicsAllocation()->isAllocDumpable());
 }
 
+HWTEST_F(EnqueueReadImageTest, givenCpuTiledImageReadWriteEnabledWhenSmallRegionOfTiledImageIsReadBlockingThenItIsDetiledOnCpuWithoutGpuSubmission) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuTiledImageReadWrite.set(true);
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 32;
+    imageDesc.image_height = 32;
+    std::unique_ptr<Image> srcImage(Image2dHelper<>::create(context, &imageDesc));
+    size_t origin[] = {2, 4, 0};
+    size_t region[] = {5, 3, 1};
+    if (pDevice->getDeviceInfo().platformLP) {
+        EXPECT_FALSE(srcImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, region));
+        return;
+    }
+    ASSERT_TRUE(srcImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, region));
+
+    auto tiledStorage = reinterpret_cast<uint8_t *>(srcImage->getGraphicsAllocation()->getUnderlyingBuffer());
+    for (size_t i = 0; i < srcImage->getSize(); i++) {
+        tiledStorage[i] = static_cast<uint8_t>(i * 7);
+    }
+    float dst[15] = {};
+    auto taskCount = pCmdQ->taskCount;
+
+    auto retVal = EnqueueReadImageHelper<>::enqueueReadImage(pCmdQ, srcImage.get(), CL_TRUE, origin, region, 0, 0, dst);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+
+    auto rowPitch = srcImage->getImageDesc().image_row_pitch;
+    for (size_t y = 0; y < region[1]; y++) {
+        for (size_t x = 0; x < region[0]; x++) {
+            auto expected = ptrOffset(tiledStorage, getTileYOffset((origin[0] + x) * sizeof(float), origin[1] + y, rowPitch));
+            EXPECT_EQ(0, memcmp(expected, &dst[y * region[0] + x], sizeof(float)));
+        }
+    }
+}
+
+HWTEST_F(EnqueueReadImageTest, givenTiledImageWhenReadIsNonBlockingOrRegionIsLargeThenCpuTiledReadIsNotAllowed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuTiledImageReadWrite.set(true);
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 256;
+    imageDesc.image_height = 128;
+    std::unique_ptr<Image> srcImage(Image2dHelper<>::create(context, &imageDesc));
+    size_t smallRegion[] = {4, 4, 1};
+    size_t largeRegion[] = {256, 128, 1};
+
+    EXPECT_FALSE(srcImage->isTiledReadWriteOnCpuAllowed(CL_FALSE, 0, smallRegion));
+    EXPECT_FALSE(srcImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 1, smallRegion));
+    EXPECT_FALSE(srcImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, largeRegion));
+
+    DebugManager.flags.EnableCpuTiledImageReadWrite.set(false);
+    EXPECT_FALSE(srcImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, smallRegion));
+}
+
 typedef EnqueueReadImageMipMapTest MipMapReadImageTest;
 
 HWTEST_P(MipMapReadImageTest, GivenImageWithMipLevelNonZeroWhenReadImageIsCalledThenProperMipLevelIsSet) {
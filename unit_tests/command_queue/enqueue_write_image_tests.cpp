@@ -6,12 +6,16 @@
  */
 
 #include "runtime/built_ins/builtins_dispatch_builder.h"
+#include "runtime/helpers/tiled_image_copy.h"
 #include "reg_configs_common.h"
 #include "runtime/memory_manager/allocations_list.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "unit_tests/command_queue/enqueue_write_image_fixture.h"
 #include "unit_tests/gen_common/gen_commands_common_validation.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/helpers/unit_test_helper.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
 #include "unit_tests/mocks/mock_builtin_dispatch_info_builder.h"
 #include "test.h"
 
@@ -362,6 +366,87 @@ HWTEST_F(EnqueueWriteImageTest, GivenImage1DThatIsZeroCopyWhenWriteImageWithTheS
     pEvent->release();
 }
 
+HWTEST_F(EnqueueWriteImageTest, givenCpuTiledImageReadWriteEnabledWhenSmallRegionOfTiledImageIsWrittenBlockingThenItIsTiledOnCpuWithoutGpuSubmission) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuTiledImageReadWrite.set(true);
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 32;
+    imageDesc.image_height = 32;
+    std::unique_ptr<Image> dstImage(Image2dHelper<>::create(context, &imageDesc));
+    size_t origin[] = {3, 1, 0};
+    size_t region[] = {5, 3, 1};
+    if (pDevice->getDeviceInfo().platformLP) {
+        EXPECT_FALSE(dstImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, region));
+        return;
+    }
+    ASSERT_TRUE(dstImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, region));
+
+    auto tiledStorage = reinterpret_cast<uint8_t *>(dstImage->getGraphicsAllocation()->getUnderlyingBuffer());
+    memset(tiledStorage, 0, dstImage->getSize());
+    size_t hostRowPitch = 8 * sizeof(float);
+    float src[8 * 3];
+    for (size_t i = 0; i < 8 * 3; i++) {
+        src[i] = static_cast<float>(i + 1);
+    }
+    auto taskCount = pCmdQ->taskCount;
+
+    auto retVal = EnqueueWriteImageHelper<>::enqueueWriteImage(pCmdQ, dstImage.get(), CL_TRUE, origin, region, hostRowPitch, 0, src);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+
+    auto rowPitch = dstImage->getImageDesc().image_row_pitch;
+    for (size_t y = 0; y < region[1]; y++) {
+        for (size_t x = 0; x < region[0]; x++) {
+            auto written = ptrOffset(tiledStorage, getTileYOffset((origin[0] + x) * sizeof(float), origin[1] + y, rowPitch));
+            EXPECT_EQ(0, memcmp(written, &src[y * 8 + x], sizeof(float)));
+        }
+    }
+}
+
+struct LockingMemoryManager : public MockMemoryManager {
+    LockingMemoryManager(ExecutionEnvironment &executionEnvironment) : MockMemoryManager(executionEnvironment) {}
+    void *lockResourceImpl(GraphicsAllocation &gfxAllocation) override {
+        lockResourceCalled++;
+        return lockedStorage;
+    }
+    void *lockedStorage = nullptr;
+};
+
+HWTEST_F(EnqueueWriteImageTest, givenTiledImageWithoutCpuPointerWhenItIsWrittenOnCpuThenStorageIsUnlockedAfterEachTransfer) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuTiledImageReadWrite.set(true);
+
+    ExecutionEnvironment executionEnvironment;
+    LockingMemoryManager memoryManager(executionEnvironment);
+    MockContext ctx;
+    ctx.setMemoryManager(&memoryManager);
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 32;
+    imageDesc.image_height = 32;
+    std::unique_ptr<Image> dstImage(Image2dHelper<>::create(&ctx, &imageDesc));
+    size_t origin[] = {0, 0, 0};
+    size_t region[] = {4, 4, 1};
+    if (!dstImage->isTiledReadWriteOnCpuAllowed(CL_TRUE, 0, region)) {
+        return;
+    }
+
+    auto allocation = dstImage->getGraphicsAllocation();
+    auto storage = allocation->getUnderlyingBuffer();
+    memoryManager.lockedStorage = storage;
+    allocation->setCpuPtrAndGpuAddress(nullptr, allocation->getGpuAddress());
+
+    float src[4 * 4] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        auto retVal = EnqueueWriteImageHelper<>::enqueueWriteImage(pCmdQ, dstImage.get(), CL_TRUE, origin, region, 0, 0, src);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(i + 1, memoryManager.lockResourceCalled);
+        EXPECT_EQ(i + 1, memoryManager.unlockResourceCalled);
+        EXPECT_FALSE(allocation->isLocked());
+    }
+    allocation->setCpuPtrAndGpuAddress(storage, allocation->getGpuAddress());
+}
+
 typedef EnqueueWriteImageMipMapTest MipMapWriteImageTest;
 
 HWTEST_P(MipMapWriteImageTest, GivenImageWithMipLevelNonZeroWhenReadImageIsCalledThenProperMipLevelIsSet) {
@@ -8,9 +8,11 @@
 #include "runtime/command_queue/local_id_gen.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/utilities/cpu_info.h"
 #include "gtest/gtest.h"
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 using namespace OCLRT;
 
@@ -419,6 +421,143 @@ TEST_P(LocalIdsLayoutForImagesTest, givenLocalWorkgroupSizeCompatibleWithLayoutF
     validateGRF();
 }
 
+namespace OCLRT {
+struct uint16x8_t;
+struct uint16x16_t;
+struct uint16x32_t;
+} // namespace OCLRT
+
+bool isAvx512Supported() {
+    return CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw);
+}
+
+TEST(LocalIdsAvx512Test, givenCpuWithAvx512WhenLocalIdHelperIsInitializedThenAvx512GeneratorsAreUsedForSimd32) {
+    if (!isAvx512Supported()) {
+        return;
+    }
+    decltype(LocalIDHelper::generateSimd32) expectedGenerator = generateLocalIDsSimd<uint16x32_t, 32>;
+    decltype(LocalIDHelper::generateWithLayoutForImagesSimd32) expectedGeneratorForImages = generateLocalIDsWithLayoutForImagesSimd<uint16x32_t, 32>;
+    EXPECT_EQ(expectedGenerator, LocalIDHelper::generateSimd32);
+    EXPECT_EQ(expectedGeneratorForImages, LocalIDHelper::generateWithLayoutForImagesSimd32);
+}
+
+struct LocalIdsAvx512Simd32Test : ::testing::TestWithParam<std::tuple<uint16_t, uint16_t, uint16_t>> {
+    void SetUp() override {
+        localWorkSize = {{std::get<0>(GetParam()), std::get<1>(GetParam()), std::get<2>(GetParam())}};
+        threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32, localWorkSize[0] * localWorkSize[1] * localWorkSize[2]));
+        size = threadsPerWorkGroup * getPerThreadSizeLocalIDs(32);
+        expected = allocateAlignedMemory(size, 32);
+        generated = allocateAlignedMemory(size, 32);
+        memset(expected.get(), 0xff, size);
+        memset(generated.get(), 0xff, size);
+    }
+
+    std::array<uint16_t, 3> localWorkSize;
+    uint16_t threadsPerWorkGroup;
+    size_t size;
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> expected;
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> generated;
+};
+
+TEST_P(LocalIdsAvx512Simd32Test, givenCpuWithAvx512WhenLocalIdsAreGeneratedThenTheyMatchSse4Generator) {
+    if (!isAvx512Supported()) {
+        return;
+    }
+    std::array<uint8_t, 3> dimensionsOrders[] = {{{0, 1, 2}}, {{1, 0, 2}}, {{2, 1, 0}}};
+    for (auto &dimensionsOrder : dimensionsOrders) {
+        generateLocalIDsSimd<uint16x8_t, 32>(expected.get(), localWorkSize, threadsPerWorkGroup, dimensionsOrder);
+        generateLocalIDsSimd<uint16x32_t, 32>(generated.get(), localWorkSize, threadsPerWorkGroup, dimensionsOrder);
+        EXPECT_EQ(0, memcmp(expected.get(), generated.get(), size));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Avx512,
+                        LocalIdsAvx512Simd32Test,
+                        ::testing::Combine(::testing::Values(1, 7, 16, 31, 32, 33, 64, 256),
+                                           ::testing::Values(1, 3, 4),
+                                           ::testing::Values(1, 2)));
+
+struct LocalIdsLayoutForImagesVectorizedTest : ::testing::TestWithParam<std::tuple<uint16_t, uint16_t, uint16_t>> {
+    void SetUp() override {
+        simd = std::get<0>(GetParam());
+        localWorkSize = {{std::get<1>(GetParam()), std::get<2>(GetParam()), 1u}};
+        auto numGrfs = (localWorkSize[0] * localWorkSize[1] + (simd - 1)) / simd;
+        rowWidth = simd == 32u ? 32u : 16u;
+        size = 3u * rowWidth * numGrfs * sizeof(uint16_t);
+        expected = allocateAlignedMemory(size, 32);
+        generated = allocateAlignedMemory(size, 32);
+        memset(expected.get(), 0xff, size);
+        memset(generated.get(), 0xff, size);
+        generateExpected();
+    }
+
+    // per lane reference layout, without the fast path for GRFs that do not wrap in Y
+    void generateExpected() {
+        uint16_t xDelta = simd == 8u ? 2u : 4u;
+        uint16_t yDelta = (simd == 8u || localWorkSize[1] == 4u) ? 4u : rowWidth / xDelta;
+        auto buffer = reinterpret_cast<uint16_t *>(expected.get());
+        uint16_t x = 0u;
+        uint16_t y = 0u;
+        for (size_t offset = 0; offset < size / sizeof(uint16_t); offset += 3 * rowWidth) {
+            generateLocalIDsWithLayoutForImagesGrf(buffer + offset, buffer + offset + rowWidth, buffer + offset + 2 * rowWidth,
+                                                   localWorkSize, simd, x, y, yDelta);
+            x += xDelta;
+        }
+    }
+
+    void (*getGenerator(bool useAvx2, bool useAvx512))(void *, const std::array<uint16_t, 3> &) {
+        if (simd == 8u) {
+            return generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 8>;
+        }
+        if (simd == 16u) {
+            return useAvx2 ? generateLocalIDsWithLayoutForImagesSimd<uint16x16_t, 16> : generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 16>;
+        }
+        if (useAvx512) {
+            return generateLocalIDsWithLayoutForImagesSimd<uint16x32_t, 32>;
+        }
+        return useAvx2 ? generateLocalIDsWithLayoutForImagesSimd<uint16x16_t, 32> : generateLocalIDsWithLayoutForImagesSimd<uint16x8_t, 32>;
+    }
+
+    uint16_t simd;
+    uint16_t rowWidth;
+    std::array<uint16_t, 3> localWorkSize;
+    size_t size;
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> expected;
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> generated;
+};
+
+TEST_P(LocalIdsLayoutForImagesVectorizedTest, givenSse4GeneratorWhenLocalIdsWithLayoutForImagesAreGeneratedThenTheyMatchPerLaneLayout) {
+    getGenerator(false, false)(generated.get(), localWorkSize);
+    EXPECT_EQ(0, memcmp(expected.get(), generated.get(), size));
+}
+
+TEST_P(LocalIdsLayoutForImagesVectorizedTest, givenCpuWithAvx2WhenLocalIdsWithLayoutForImagesAreGeneratedThenTheyMatchPerLaneLayout) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        return;
+    }
+    getGenerator(true, false)(generated.get(), localWorkSize);
+    EXPECT_EQ(0, memcmp(expected.get(), generated.get(), size));
+}
+
+TEST_P(LocalIdsLayoutForImagesVectorizedTest, givenCpuWithAvx512WhenLocalIdsWithLayoutForImagesAreGeneratedThenTheyMatchPerLaneLayout) {
+    if (!isAvx512Supported()) {
+        return;
+    }
+    getGenerator(true, true)(generated.get(), localWorkSize);
+    EXPECT_EQ(0, memcmp(expected.get(), generated.get(), size));
+}
+
+TEST_P(LocalIdsLayoutForImagesVectorizedTest, whenLocalIdsForImageOnlyKernelAreGeneratedThenTheyMatchPerLaneLayout) {
+    generateLocalIDs(generated.get(), simd, localWorkSize, {{0u, 1u, 2u}}, true);
+    EXPECT_EQ(0, memcmp(expected.get(), generated.get(), size));
+}
+
+INSTANTIATE_TEST_CASE_P(LayoutForImagesVectorizedTests,
+                        LocalIdsLayoutForImagesVectorizedTest,
+                        ::testing::Combine(::testing::Values(8, 16, 32),
+                                           ::testing::Values(4, 8, 12, 16, 20, 64),
+                                           ::testing::Values(4, 8, 12, 16, 20, 36)));
+
 #define SIMDParams ::testing::Values(8, 16, 32)
 #if HEAVY_DUTY_TESTING
 #define LWSXParams ::testing::Values(1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 128, 256)
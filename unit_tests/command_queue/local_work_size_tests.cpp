@@ -650,3 +650,61 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheEnabledWhenWorkgroupSizeIsComputedTwiceForSameShapeThenCachedValueIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(true);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(kernel.mockKernel, 2, Vec3<size_t>(1024, 768, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+
+    auto &cache = kernel.mockKernel->getLocalWorkSizeCache();
+    auto lws = computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(1u, cache.peekEntriesCount());
+    EXPECT_EQ(0u, cache.peekHitsCount());
+
+    EXPECT_EQ(lws, computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, cache.peekEntriesCount());
+    EXPECT_EQ(1u, cache.peekHitsCount());
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheEnabledWhenSlmSizeChangesThenWorkgroupSizeIsRecomputed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(true);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(kernel.mockKernel, 1, Vec3<size_t>(4096, 1, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+
+    auto &cache = kernel.mockKernel->getLocalWorkSizeCache();
+    computeWorkgroupSize(dispatchInfo);
+    kernel.mockKernel->setTotalSLMSize(4096);
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, cache.peekEntriesCount());
+    EXPECT_EQ(0u, cache.peekHitsCount());
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheDisabledWhenWorkgroupSizeIsComputedThenCacheIsNotUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(false);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(kernel.mockKernel, 1, Vec3<size_t>(4096, 1, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+
+    computeWorkgroupSize(dispatchInfo);
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(0u, kernel.mockKernel->getLocalWorkSizeCache().peekEntriesCount());
+}
+
+TEST(localWorkSizeTest, givenSameShapeWhenComputeWorkSizeAlgorithmChangesThenCachedValueIsNotReused) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(true);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(kernel.mockKernel, 2, Vec3<size_t>(1024, 1024, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+
+    computeWorkgroupSize(dispatchInfo);
+    DebugManager.flags.EnableComputeWorkSizeSquared.set(!DebugManager.flags.EnableComputeWorkSizeSquared.get());
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, kernel.mockKernel->getLocalWorkSizeCache().peekEntriesCount());
+    EXPECT_EQ(0u, kernel.mockKernel->getLocalWorkSizeCache().peekHitsCount());
+}
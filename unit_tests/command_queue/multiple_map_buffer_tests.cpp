@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,8 +17,6 @@ using namespace OCLRT;
 struct MultipleMapBufferTest : public DeviceFixture, public ::testing::Test {
     template <typename T>
     struct MockBuffer : public BufferHw<T> {
-        using Buffer::mapOperationsHandler;
-
         template <class... Params>
         MockBuffer(Params... params) : BufferHw<T>(params...) {
             this->createFunction = BufferHw<T>::create;
@@ -122,13 +120,13 @@ HWTEST_F(MultipleMapBufferTest, givenValidReadAndWriteBufferWhenMappedOnGpuThenA
     size_t size = 3;
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 0, nullptr, nullptr, nullptr);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->readBufferCalled, 1u);
     EXPECT_EQ(cmdQ->enqueueSize, size);
     EXPECT_EQ(cmdQ->enqueueOffset, offset);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->writeBufferCalled, 1u);
     EXPECT_EQ(cmdQ->enqueueSize, size);
     EXPECT_EQ(cmdQ->enqueueOffset, offset);
@@ -144,11 +142,11 @@ HWTEST_F(MultipleMapBufferTest, givenReadOnlyMapWhenUnmappedOnGpuThenEnqueueMark
     size_t size = 3;
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_READ, offset, size, 0, nullptr, nullptr, nullptr);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->readBufferCalled, 1u);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->writeBufferCalled, 0u);
     EXPECT_EQ(cmdQ->enqueueMarkerCalled, 1u);
 }
@@ -158,7 +156,7 @@ HWTEST_F(MultipleMapBufferTest, givenNotMappedPtrWhenUnmapedOnGpuThenReturnError
     auto cmdQ = createMockCmdQ<FamilyType>();
     EXPECT_FALSE(buffer->mappingOnCpuAllowed());
 
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), buffer->getBasePtrForMap(), 0, nullptr, nullptr);
     EXPECT_EQ(CL_INVALID_VALUE, retVal);
 }
@@ -174,7 +172,7 @@ HWTEST_F(MultipleMapBufferTest, givenErrorFromReadBufferWhenMappedOnGpuThenDontA
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_READ, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr);
     EXPECT_EQ(CL_OUT_OF_RESOURCES, retVal);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapBufferTest, givenErrorFromWriteBufferWhenUnmappedOnGpuThenDontRemoveMappedPtr) {
@@ -187,12 +185,12 @@ HWTEST_F(MultipleMapBufferTest, givenErrorFromWriteBufferWhenUnmappedOnGpuThenDo
     size_t size = 3;
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
     EXPECT_EQ(1u, cmdQ->writeBufferCalled);
     EXPECT_EQ(CL_OUT_OF_RESOURCES, retVal);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapBufferTest, givenUnblockedQueueWhenMappedOnCpuThenAddMappedPtrAndRemoveOnUnmap) {
@@ -204,13 +202,13 @@ HWTEST_F(MultipleMapBufferTest, givenUnblockedQueueWhenMappedOnCpuThenAddMappedP
     size_t size = 3;
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(1u, buffer->transferToHostPtrCalled);
     EXPECT_EQ(buffer->copySize, size);
     EXPECT_EQ(buffer->copyOffset, offset);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(1u, buffer->transferFromHostPtrCalled);
     EXPECT_EQ(buffer->copySize, size);
     EXPECT_EQ(buffer->copyOffset, offset);
@@ -225,11 +223,11 @@ HWTEST_F(MultipleMapBufferTest, givenUnblockedQueueWhenReadOnlyMappedOnCpuThenDo
     size_t size = 3;
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_READ, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(1u, buffer->transferToHostPtrCalled);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(0u, buffer->transferFromHostPtrCalled);
 }
 
@@ -247,14 +245,14 @@ HWTEST_F(MultipleMapBufferTest, givenBlockedQueueWhenMappedOnCpuThenAddMappedPtr
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 1, &clMapEvent, nullptr, &retVal);
     mapEvent.setStatus(CL_COMPLETE);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(buffer->copySize, size);
     EXPECT_EQ(buffer->copyOffset, offset);
     EXPECT_EQ(1u, buffer->transferToHostPtrCalled);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 1, &clUnmapEvent, nullptr);
     unmapEvent.setStatus(CL_COMPLETE);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(buffer->copySize, size);
     EXPECT_EQ(buffer->copyOffset, offset);
     EXPECT_EQ(1u, buffer->transferFromHostPtrCalled);
@@ -275,11 +273,11 @@ HWTEST_F(MultipleMapBufferTest, givenBlockedQueueWhenMappedReadOnlyOnCpuThenDont
     mapEvent.setStatus(CL_COMPLETE);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(1u, buffer->transferToHostPtrCalled);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtr, 1, &clUnmapEvent, nullptr);
     unmapEvent.setStatus(CL_COMPLETE);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(0u, buffer->transferFromHostPtrCalled);
 }
 
@@ -306,26 +304,26 @@ HWTEST_F(MultipleMapBufferTest, givenMultimpleMapsWhenUnmappingThenRemoveCorrect
         mappedPtrs[i].ptr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE,
                                                mappedPtrs[i].offset[0], mappedPtrs[i].size[0], 0, nullptr, nullptr, &retVal);
         EXPECT_NE(nullptr, mappedPtrs[i].ptr);
-        EXPECT_EQ(i + 1, buffer->mapOperationsHandler.size());
+        EXPECT_EQ(i + 1, buffer->getMappedPtrsCount());
         EXPECT_EQ(cmdQ->enqueueSize, mappedPtrs[i].size[0]);
         EXPECT_EQ(cmdQ->enqueueOffset, mappedPtrs[i].offset[0]);
     }
 
     // reordered unmap
     clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtrs[1].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(2u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[1].ptr);
     EXPECT_EQ(cmdQ->enqueueSize, mappedPtrs[1].size[0]);
     EXPECT_EQ(cmdQ->enqueueOffset, mappedPtrs[1].offset[0]);
 
     clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtrs[2].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[2].ptr);
     EXPECT_EQ(cmdQ->enqueueSize, mappedPtrs[2].size[0]);
     EXPECT_EQ(cmdQ->enqueueOffset, mappedPtrs[2].offset[0]);
 
     clEnqueueUnmapMemObject(cmdQ.get(), buffer.get(), mappedPtrs[0].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(0u, buffer->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[0].ptr);
     EXPECT_EQ(cmdQ->enqueueSize, mappedPtrs[0].size[0]);
     EXPECT_EQ(cmdQ->enqueueOffset, mappedPtrs[0].offset[0]);
@@ -341,13 +339,13 @@ HWTEST_F(MultipleMapBufferTest, givenOverlapingPtrWhenMappingOnGpuForWriteThenRe
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_READ, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 
     offset++;
     void *mappedPtr2 = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr2);
     EXPECT_EQ(CL_INVALID_OPERATION, retVal);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapBufferTest, givenOverlapingPtrWhenMappingOnCpuForWriteThenReturnError) {
@@ -360,11 +358,11 @@ HWTEST_F(MultipleMapBufferTest, givenOverlapingPtrWhenMappingOnCpuForWriteThenRe
     void *mappedPtr = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_READ, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 
     offset++;
     void *mappedPtr2 = clEnqueueMapBuffer(cmdQ.get(), buffer.get(), CL_FALSE, CL_MAP_WRITE, offset, size, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr2);
     EXPECT_EQ(CL_INVALID_OPERATION, retVal);
-    EXPECT_EQ(1u, buffer->mapOperationsHandler.size());
+    EXPECT_EQ(1u, buffer->getMappedPtrsCount());
 }
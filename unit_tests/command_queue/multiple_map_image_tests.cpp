@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,8 +18,6 @@ using namespace OCLRT;
 struct MultipleMapImageTest : public DeviceFixture, public ::testing::Test {
     template <typename T>
     struct MockImage : public ImageHw<T> {
-        using Image::mapOperationsHandler;
-
         template <class... Params>
         MockImage(Params... params) : ImageHw<T>(params...) {
             this->createFunction = ImageHw<T>::create;
@@ -126,13 +124,13 @@ HWTEST_F(MultipleMapImageTest, givenValidReadAndWriteImageWhenMappedOnGpuThenAdd
     MemObjSizeArray region = {{3, 4, 1}};
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->enqueueRegion, region);
     EXPECT_EQ(cmdQ->enqueueOrigin, origin);
     EXPECT_EQ(cmdQ->readImageCalled, 1u);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->enqueueRegion, region);
     EXPECT_EQ(cmdQ->enqueueOrigin, origin);
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtr);
@@ -148,13 +146,13 @@ HWTEST_F(MultipleMapImageTest, givenReadOnlyMapWhenUnmappedOnGpuThenEnqueueMarke
     MemObjSizeArray region = {{3, 4, 1}};
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_READ, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->enqueueRegion, region);
     EXPECT_EQ(cmdQ->enqueueOrigin, origin);
     EXPECT_EQ(cmdQ->readImageCalled, 1u);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->writeImageCalled, 0u);
     EXPECT_EQ(cmdQ->enqueueMarkerCalled, 1u);
 }
@@ -164,7 +162,7 @@ HWTEST_F(MultipleMapImageTest, givenNotMappedPtrWhenUnmapedOnGpuThenReturnError)
     auto cmdQ = createMockCmdQ<FamilyType>();
     EXPECT_FALSE(image->mappingOnCpuAllowed());
 
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), image->getBasePtrForMap(), 0, nullptr, nullptr);
     EXPECT_EQ(CL_INVALID_VALUE, retVal);
 }
@@ -180,7 +178,7 @@ HWTEST_F(MultipleMapImageTest, givenErrorFromReadImageWhenMappedOnGpuThenDontAdd
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_READ, origin, region, nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr);
     EXPECT_EQ(CL_OUT_OF_RESOURCES, retVal);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapImageTest, givenErrorFromWriteImageWhenUnmappedOnGpuThenDontRemoveMappedPtr) {
@@ -193,12 +191,12 @@ HWTEST_F(MultipleMapImageTest, givenErrorFromWriteImageWhenUnmappedOnGpuThenDont
     size_t region[] = {2, 1, 1};
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, origin, region, nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 0, nullptr, nullptr);
     EXPECT_EQ(CL_OUT_OF_RESOURCES, retVal);
     EXPECT_EQ(cmdQ->writeImageCalled, 1u);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapImageTest, givenUnblockedQueueWhenMappedOnCpuThenAddMappedPtrAndRemoveOnUnmap) {
@@ -210,13 +208,13 @@ HWTEST_F(MultipleMapImageTest, givenUnblockedQueueWhenMappedOnCpuThenAddMappedPt
     MemObjSizeArray region = {{3, 1, 1}};
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(1u, image->transferToHostPtrCalled);
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(1u, image->transferFromHostPtrCalled);
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
@@ -231,13 +229,13 @@ HWTEST_F(MultipleMapImageTest, givenUnblockedQueueWhenReadOnlyMappedOnCpuThenDon
     MemObjSizeArray region = {{3, 1, 1}};
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_READ, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(1u, image->transferToHostPtrCalled);
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(0u, image->transferFromHostPtrCalled);
 }
 
@@ -256,13 +254,13 @@ HWTEST_F(MultipleMapImageTest, givenBlockedQueueWhenMappedOnCpuThenAddMappedPtrA
     mapEvent.setStatus(CL_COMPLETE);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(1u, image->transferToHostPtrCalled);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 1, &clUnmapEvent, nullptr);
     unmapEvent.setStatus(CL_COMPLETE);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(1u, image->transferFromHostPtrCalled);
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
@@ -283,13 +281,13 @@ HWTEST_F(MultipleMapImageTest, givenBlockedQueueWhenMappedReadOnlyOnCpuThenDontM
     mapEvent.setStatus(CL_COMPLETE);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(1u, image->transferToHostPtrCalled);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(image->copyRegion, region);
     EXPECT_EQ(image->copyOrigin, origin);
 
     retVal = clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtr, 1, &clUnmapEvent, nullptr);
     unmapEvent.setStatus(CL_COMPLETE);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(0u, image->transferFromHostPtrCalled);
 }
 
@@ -314,26 +312,26 @@ HWTEST_F(MultipleMapImageTest, givenMultimpleMapsWhenUnmappingThenRemoveCorrectP
         mappedPtrs[i].ptr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, &mappedPtrs[i].offset[0], &mappedPtrs[i].size[0],
                                               nullptr, nullptr, 0, nullptr, nullptr, &retVal);
         EXPECT_NE(nullptr, mappedPtrs[i].ptr);
-        EXPECT_EQ(i + 1, image->mapOperationsHandler.size());
+        EXPECT_EQ(i + 1, image->getMappedPtrsCount());
         EXPECT_EQ(cmdQ->enqueueRegion, mappedPtrs[i].size);
         EXPECT_EQ(cmdQ->enqueueOrigin, mappedPtrs[i].offset);
     }
 
     // reordered unmap
     clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtrs[1].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, image->mapOperationsHandler.size());
+    EXPECT_EQ(2u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[1].ptr);
     EXPECT_EQ(cmdQ->enqueueRegion, mappedPtrs[1].size);
     EXPECT_EQ(cmdQ->enqueueOrigin, mappedPtrs[1].offset);
 
     clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtrs[2].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[2].ptr);
     EXPECT_EQ(cmdQ->enqueueRegion, mappedPtrs[2].size);
     EXPECT_EQ(cmdQ->enqueueOrigin, mappedPtrs[2].offset);
 
     clEnqueueUnmapMemObject(cmdQ.get(), image.get(), mappedPtrs[0].ptr, 0, nullptr, nullptr);
-    EXPECT_EQ(0u, image->mapOperationsHandler.size());
+    EXPECT_EQ(0u, image->getMappedPtrsCount());
     EXPECT_EQ(cmdQ->unmapPtr, mappedPtrs[0].ptr);
     EXPECT_EQ(cmdQ->enqueueRegion, mappedPtrs[0].size);
     EXPECT_EQ(cmdQ->enqueueOrigin, mappedPtrs[0].offset);
@@ -349,13 +347,13 @@ HWTEST_F(MultipleMapImageTest, givenOverlapingPtrWhenMappingOnGpuForWriteThenRet
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_READ, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 
     origin[0]++;
     void *mappedPtr2 = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr2);
     EXPECT_EQ(CL_INVALID_OPERATION, retVal);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 }
 
 HWTEST_F(MultipleMapImageTest, givenOverlapingPtrWhenMappingOnCpuForWriteThenReturnError) {
@@ -368,11 +366,11 @@ HWTEST_F(MultipleMapImageTest, givenOverlapingPtrWhenMappingOnCpuForWriteThenRet
     void *mappedPtr = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_READ, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_NE(nullptr, mappedPtr);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 
     origin[0]++;
     void *mappedPtr2 = clEnqueueMapImage(cmdQ.get(), image.get(), CL_TRUE, CL_MAP_WRITE, &origin[0], &region[0], nullptr, nullptr, 0, nullptr, nullptr, &retVal);
     EXPECT_EQ(nullptr, mappedPtr2);
     EXPECT_EQ(CL_INVALID_OPERATION, retVal);
-    EXPECT_EQ(1u, image->mapOperationsHandler.size());
+    EXPECT_EQ(1u, image->getMappedPtrsCount());
 }
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/recorded_command_list.h"
+#include "runtime/event/event.h"
+#include "runtime/mem_obj/buffer.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/ptr_math.h"
+#include "unit_tests/fixtures/enqueue_handler_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "test.h"
+
+#include <cstring>
+
+using namespace OCLRT;
+
+typedef EnqueueHandlerTest RecordedCommandListTest;
+
+HWTEST_F(RecordedCommandListTest, givenRecordingInProgressWhenBeginRecordingIsCalledThenErrorIsReturned) {
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    EXPECT_NE(nullptr, mockCmdQ->peekRecordedCommandList());
+    EXPECT_EQ(CL_INVALID_OPERATION, mockCmdQ->beginRecording());
+}
+
+HWTEST_F(RecordedCommandListTest, givenNoRecordingWhenEndRecordingIsCalledThenErrorIsReturned) {
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(nullptr, commandList);
+}
+
+HWTEST_F(RecordedCommandListTest, givenProfilingQueueWhenBeginRecordingIsCalledThenErrorIsReturned) {
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, properties));
+
+    EXPECT_EQ(CL_INVALID_OPERATION, mockCmdQ->beginRecording());
+    EXPECT_EQ(nullptr, mockCmdQ->peekRecordedCommandList());
+}
+
+HWTEST_F(RecordedCommandListTest, givenRecordingWhenKernelIsEnqueuedThenItIsRecordedInsteadOfSubmitted) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+    auto taskCountBefore = csr.peekTaskCount();
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+
+    cl_int retVal = CL_INVALID_VALUE;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(nullptr, mockCmdQ->peekRecordedCommandList());
+    EXPECT_EQ(2u, commandList->getDispatches().size());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(commandList->getCommandStream(), 0);
+    EXPECT_EQ(2u, hwParser.getCommandCount<typename FamilyType::GPGPU_WALKER>());
+}
+
+HWTEST_F(RecordedCommandListTest, givenRecordingWhenKernelIsEnqueuedWithEventThenItIsSubmittedAndRecordingIsInvalidated) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+    auto taskCountBefore = csr.peekTaskCount();
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event));
+    EXPECT_FALSE(mockCmdQ->peekRecordedCommandList()->isValid());
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(taskCountBefore + 1, csr.peekTaskCount());
+    EXPECT_EQ(0u, mockCmdQ->peekRecordedCommandList()->getDispatches().size());
+
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(nullptr, commandList);
+    castToObject<Event>(event)->release();
+}
+
+HWTEST_F(RecordedCommandListTest, givenInvalidatedRecordingWhenKernelIsEnqueuedThenItIsSubmittedInsteadOfRecorded) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueBarrierWithWaitList(0, nullptr, nullptr));
+    EXPECT_FALSE(mockCmdQ->peekRecordedCommandList()->isValid());
+
+    auto taskCountBefore = csr.peekTaskCount();
+    size_t gws[] = {1, 1, 1};
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCountBefore + 1, csr.peekTaskCount());
+    EXPECT_EQ(0u, mockCmdQ->peekRecordedCommandList()->getCommandStream().getUsed());
+}
+
+HWTEST_F(RecordedCommandListTest, givenRecordingWhenBufferIsMappedOnCpuThenMapIsDoneAndRecordingIsInvalidated) {
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_TRUE(buffer->mappingOnCpuAllowed());
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    cl_event event = nullptr;
+    auto mappedPtr = mockCmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_READ, 0, MemoryConstants::pageSize, 0, nullptr, &event, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(buffer->getCpuAddressForMapping(), mappedPtr);
+    ASSERT_NE(nullptr, event);
+    EXPECT_FALSE(mockCmdQ->peekRecordedCommandList()->isValid());
+
+    auto commandList = mockCmdQ->endRecording(retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(nullptr, commandList);
+    castToObject<Event>(event)->release();
+}
+
+HWTEST_F(RecordedCommandListTest, givenRecordedCommandListWhenEnqueuedThenItIsSubmittedWithBatchBufferStart) {
+    typedef typename FamilyType::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    auto taskCountBefore = csr.peekTaskCount();
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueRecordedCommandList(*commandList));
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueRecordedCommandList(*commandList));
+    EXPECT_EQ(taskCountBefore + 2, csr.peekTaskCount());
+    EXPECT_EQ(csr.peekTaskCount(), commandList->peekLastTaskCount());
+    EXPECT_TRUE(commandList->isClosed());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(mockCmdQ->getCS(0), 0);
+    auto bbStartCount = 0u;
+    for (auto it = hwParser.cmdList.begin(); it != hwParser.cmdList.end(); it++) {
+        auto bbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*it);
+        if (bbStart && bbStart->getBatchBufferStartAddressGraphicsaddress472() == commandList->getCommandStream().getGraphicsAllocation()->getGpuAddress()) {
+            bbStartCount++;
+        }
+    }
+    EXPECT_EQ(2u, bbStartCount);
+}
+
+HWTEST_F(RecordedCommandListTest, givenCommandListRecordedOnOtherQueueWhenEnqueuedThenErrorIsReturned) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto otherCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, otherCmdQ->enqueueRecordedCommandList(*commandList));
+}
+
+HWTEST_F(RecordedCommandListTest, givenChangedKernelArgumentWhenCommandListIsPatchedThenOnlyChangedSlotIsUpdated) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    mockKernel.kernelInfo.kernelArgInfo.resize(2);
+    mockKernel.kernelInfo.kernelArgInfo[0].kernelArgPatchInfoVector.push_back({0, sizeof(uint64_t), 0});
+    mockKernel.kernelInfo.kernelArgInfo[1].kernelArgPatchInfoVector.push_back({sizeof(uint64_t), sizeof(uint64_t), 0});
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    auto surfaceStateSize = sizeof(typename FamilyType::RENDER_SURFACE_STATE);
+    EXPECT_FALSE(commandList->hasStaleKernelArguments(surfaceStateSize));
+
+    uint64_t newArgValue = 0x1234;
+    memcpy(mockKernel.mockKernel->getCrossThreadData() + sizeof(uint64_t), &newArgValue, sizeof(newArgValue));
+    EXPECT_TRUE(commandList->hasStaleKernelArguments(surfaceStateSize));
+    EXPECT_EQ(1u, commandList->patchKernelArguments(surfaceStateSize));
+    EXPECT_FALSE(commandList->hasStaleKernelArguments(surfaceStateSize));
+
+    auto &ioh = commandList->getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    auto recordedCrossThreadData = ptrOffset(ioh.getCpuBase(), commandList->getDispatches()[0].crossThreadDataOffset);
+    EXPECT_EQ(0, memcmp(ptrOffset(recordedCrossThreadData, sizeof(uint64_t)), &newArgValue, sizeof(newArgValue)));
+}
+
+HWTEST_F(RecordedCommandListTest, givenChangedLocalMemorySizeWhenCommandListIsEnqueuedThenErrorIsReturned) {
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cl_int retVal = CL_SUCCESS;
+    auto commandList = mockCmdQ->endRecording(retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_FALSE(commandList->hasChangedLocalMemorySize());
+
+    auto recordedSlmTotalSize = mockKernel.mockKernel->slmTotalSize;
+    mockKernel.mockKernel->slmTotalSize = recordedSlmTotalSize + KB;
+    EXPECT_TRUE(commandList->hasChangedLocalMemorySize());
+    auto taskCountBefore = csr.peekTaskCount();
+    EXPECT_EQ(CL_INVALID_OPERATION, mockCmdQ->enqueueRecordedCommandList(*commandList));
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+
+    mockKernel.mockKernel->slmTotalSize = recordedSlmTotalSize;
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueRecordedCommandList(*commandList));
+}
+
+HWTEST_F(RecordedCommandListTest, givenCrossThreadDataReuseEnabledWhenKernelIsSubmittedDuringInvalidatedRecordingThenIndirectDataIsReused) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableCrossThreadDataReuse.set(true);
+    MockKernelWithInternals mockKernel(*pDevice);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+
+    ASSERT_EQ(CL_SUCCESS, mockCmdQ->beginRecording());
+    size_t gws[] = {64, 1, 1};
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(0u, mockKernel.mockKernel->getCrossThreadDataTracker().peekReusedCount());
+
+    // submitted dispatches use heap of the queue, not the one of the command list
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueBarrierWithWaitList(0, nullptr, nullptr));
+    EXPECT_FALSE(mockCmdQ->peekRecordedCommandList()->isValid());
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    auto &ioh = mockCmdQ->getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 0);
+    auto iohUsed = ioh.getUsed();
+
+    mockCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(iohUsed, ioh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getCrossThreadDataTracker().peekReusedCount());
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/transfer_coalescer.h"
+#include "runtime/mem_obj/buffer.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+struct TransferCoalescerTests : public ::testing::Test {
+    void SetUp() override {
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        context = std::make_unique<MockContext>(device.get());
+
+        cl_int retVal = CL_SUCCESS;
+        srcBuffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+        dstBuffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    }
+
+    template <typename FamilyType>
+    size_t getWalkersCount(LinearStream &commandStream) {
+        HardwareParse hwParser;
+        hwParser.parseCommands<FamilyType>(commandStream);
+        size_t walkersCount = 0;
+        for (auto &cmd : hwParser.cmdList) {
+            if (genCmdCast<typename FamilyType::GPGPU_WALKER *>(cmd)) {
+                walkersCount++;
+            }
+        }
+        return walkersCount;
+    }
+
+    static constexpr size_t bufferSize = 4096;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<Buffer> srcBuffer;
+    std::unique_ptr<Buffer> dstBuffer;
+};
+
+constexpr size_t TransferCoalescerTests::bufferSize;
+
+TEST_F(TransferCoalescerTests, givenDisjointCopiesBetweenSameBuffersWhenAddedThenDescriptorsAreBatched) {
+    TransferCoalescer coalescer;
+    EXPECT_TRUE(coalescer.isEmpty());
+
+    EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 128, 64));
+    EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 512, 0, 16));
+    EXPECT_FALSE(coalescer.isEmpty());
+
+    auto transfers = coalescer.takePending();
+    EXPECT_TRUE(coalescer.isEmpty());
+    ASSERT_NE(nullptr, transfers);
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_COPY_BUFFER), transfers->commandType);
+    EXPECT_EQ(srcBuffer.get(), transfers->srcBuffer);
+    EXPECT_EQ(dstBuffer.get(), transfers->dstBuffer);
+    EXPECT_EQ(80u, transfers->workItemsCount);
+    ASSERT_EQ(2u, transfers->descriptors.size());
+    EXPECT_EQ(0u, transfers->descriptors[0].srcOffset);
+    EXPECT_EQ(128u, transfers->descriptors[0].dstOffset);
+    EXPECT_EQ(0u, transfers->descriptors[0].firstWorkItem);
+    EXPECT_EQ(512u, transfers->descriptors[1].srcOffset);
+    EXPECT_EQ(0u, transfers->descriptors[1].dstOffset);
+    EXPECT_EQ(64u, transfers->descriptors[1].firstWorkItem);
+}
+
+TEST_F(TransferCoalescerTests, givenPendingCopyWhenIncompatibleTransferIsAddedThenItIsRejected) {
+    TransferCoalescer coalescer;
+    char pattern = 0x5a;
+    EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 128, 64));
+
+    EXPECT_FALSE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 160, 64));
+    EXPECT_FALSE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 96, 33));
+    EXPECT_FALSE(coalescer.addCopy(dstBuffer.get(), srcBuffer.get(), 0, 1024, 64));
+    EXPECT_FALSE(coalescer.addFill(dstBuffer.get(), &pattern, sizeof(pattern), 1024, 64));
+    EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 96, 32));
+    EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 192, 32));
+}
+
+TEST_F(TransferCoalescerTests, givenMaxTransfersWhenAddingNextOneThenCoalescerIsFullAndRejectsIt) {
+    TransferCoalescer coalescer;
+    for (size_t i = 0; i < TransferCoalescer::maxTransfersCount; i++) {
+        EXPECT_FALSE(coalescer.isFull());
+        EXPECT_TRUE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, i, 1));
+    }
+    EXPECT_TRUE(coalescer.isFull());
+    EXPECT_FALSE(coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, TransferCoalescer::maxTransfersCount, 1));
+}
+
+TEST_F(TransferCoalescerTests, givenFillsWhenAddedThenPatternsAreAppendedAndReferencedByOffset) {
+    TransferCoalescer coalescer;
+    uint8_t pattern1 = 0x11;
+    uint32_t pattern4 = 0x44332211;
+    EXPECT_TRUE(coalescer.addFill(dstBuffer.get(), &pattern1, sizeof(pattern1), 0, 16));
+    EXPECT_TRUE(coalescer.addFill(dstBuffer.get(), &pattern4, sizeof(pattern4), 64, 32));
+
+    auto transfers = coalescer.takePending();
+    ASSERT_NE(nullptr, transfers);
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_FILL_BUFFER), transfers->commandType);
+    EXPECT_EQ(nullptr, transfers->srcBuffer);
+    ASSERT_EQ(5u, transfers->patterns.size());
+    EXPECT_EQ(0x11u, transfers->patterns[0]);
+    EXPECT_EQ(0, memcmp(&pattern4, &transfers->patterns[1], sizeof(pattern4)));
+    ASSERT_EQ(2u, transfers->descriptors.size());
+    EXPECT_EQ(0u, transfers->descriptors[0].srcOffset);
+    EXPECT_EQ(1u, transfers->descriptors[0].patternSize);
+    EXPECT_EQ(1u, transfers->descriptors[1].srcOffset);
+    EXPECT_EQ(4u, transfers->descriptors[1].patternSize);
+    EXPECT_EQ(16u, transfers->descriptors[1].firstWorkItem);
+}
+
+TEST_F(TransferCoalescerTests, givenPendingTransfersWhenTakenThenBuffersAreRetainedUntilTransfersAreReleased) {
+    TransferCoalescer coalescer;
+    auto srcRefCount = srcBuffer->getRefInternalCount();
+    auto dstRefCount = dstBuffer->getRefInternalCount();
+
+    coalescer.addCopy(srcBuffer.get(), dstBuffer.get(), 0, 0, 16);
+    EXPECT_EQ(srcRefCount + 1, srcBuffer->getRefInternalCount());
+    EXPECT_EQ(dstRefCount + 1, dstBuffer->getRefInternalCount());
+
+    coalescer.takePending();
+    EXPECT_EQ(srcRefCount, srcBuffer->getRefInternalCount());
+    EXPECT_EQ(dstRefCount, dstBuffer->getRefInternalCount());
+}
+
+TEST_F(TransferCoalescerTests, givenLargeOrSelfCopyWhenAskedIfCoalescableThenReturnFalse) {
+    EXPECT_TRUE(TransferCoalescer::isCopyCoalescable(srcBuffer.get(), dstBuffer.get(), 0, 0, 64));
+    EXPECT_FALSE(TransferCoalescer::isCopyCoalescable(srcBuffer.get(), dstBuffer.get(), 0, 0, 0));
+    EXPECT_FALSE(TransferCoalescer::isCopyCoalescable(srcBuffer.get(), dstBuffer.get(), 0, 0, TransferCoalescer::maxTransferSize + 1));
+    EXPECT_FALSE(TransferCoalescer::isCopyCoalescable(srcBuffer.get(), srcBuffer.get(), 0, 1024, 64));
+
+    EXPECT_TRUE(TransferCoalescer::isFillCoalescable(4, 0, 64));
+    EXPECT_FALSE(TransferCoalescer::isFillCoalescable(4, 0, TransferCoalescer::maxTransferSize + 1));
+}
+
+HWTEST_F(TransferCoalescerTests, givenTransferCoalescingEnabledWhenSmallCopiesAreEnqueuedThenSingleWalkerIsSubmittedOnFlush) {
+    DebugManager.flags.EnableTransferCoalescing.set(true);
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto taskCount = cmdQ->taskCount;
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, 64, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 256, 512, 64, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCount, cmdQ->taskCount);
+    EXPECT_FALSE(cmdQ->getTransferCoalescer().isEmpty());
+
+    cmdQ->flush();
+    EXPECT_TRUE(cmdQ->getTransferCoalescer().isEmpty());
+    EXPECT_EQ(taskCount + 1, cmdQ->taskCount);
+    EXPECT_EQ(1u, getWalkersCount<FamilyType>(*cmdQ->commandStream));
+}
+
+HWTEST_F(TransferCoalescerTests, givenPendingFillsWhenCopyIsEnqueuedThenFillsAreSubmittedBeforeCopyIsBatched) {
+    DebugManager.flags.EnableTransferCoalescing.set(true);
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto taskCount = cmdQ->taskCount;
+    uint32_t pattern = 0xdeadbeef;
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), 0, 64, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), 128, 64, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCount, cmdQ->taskCount);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, 64, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCount + 1, cmdQ->taskCount);
+    EXPECT_FALSE(cmdQ->getTransferCoalescer().isEmpty());
+
+    cmdQ->finish(false);
+    EXPECT_EQ(taskCount + 2, cmdQ->taskCount);
+    EXPECT_EQ(2u, getWalkersCount<FamilyType>(*cmdQ->commandStream));
+}
+
+HWTEST_F(TransferCoalescerTests, givenOutputEventWhenSmallCopyIsEnqueuedThenItIsNotCoalesced) {
+    DebugManager.flags.EnableTransferCoalescing.set(true);
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto taskCount = cmdQ->taskCount;
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, 64, 0, nullptr, &event));
+    EXPECT_TRUE(cmdQ->getTransferCoalescer().isEmpty());
+    EXPECT_EQ(taskCount + 1, cmdQ->taskCount);
+    clReleaseEvent(event);
+}
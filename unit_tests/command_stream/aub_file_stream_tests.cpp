@@ -16,7 +16,9 @@
 #include "unit_tests/mocks/mock_aub_manager.h"
 #include "driver_version.h"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <memory>
 
 using namespace OCLRT;
@@ -603,3 +605,203 @@ HWTEST_F(AubFileStreamTests, givenAddPatchInfoCommentsCalledWhenTargetAllocation
         lineNo++;
     }
 }
+
+namespace {
+struct CapturingAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
+    void write(const char *data, size_t size) override {
+        written.append(data, size);
+    }
+    std::string written;
+};
+
+struct CountingAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writeMemoryCalled++;
+    }
+    void writePTE(uint64_t physAddress, uint64_t entry, uint32_t addressSpace) override {
+        writePTECalled++;
+    }
+    uint32_t writeMemoryCalled = 0;
+    uint32_t writePTECalled = 0;
+};
+
+const size_t sizeMemoryWriteHeader = sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite) - sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite::data);
+} // namespace
+
+TEST(AubFileStreamTest, givenCompactUniformMemoryEnabledWhenUniformMemoryIsWrittenThenSingleDwordIsRepeated) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpCompactUniformMemory.set(true);
+    CapturingAubFileStream stream;
+
+    std::vector<uint32_t> page(1024, 0xabcdabcd);
+    stream.writeMemory(0x1000, page.data(), 4096, AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+
+    ASSERT_EQ(sizeMemoryWriteHeader + sizeof(uint32_t), stream.written.size());
+    auto header = reinterpret_cast<const AubMemDump::CmdServicesMemTraceMemoryWrite *>(stream.written.data());
+    EXPECT_EQ(static_cast<uint32_t>(AubMemDump::CmdServicesMemTraceMemoryWrite::RepeatMemoryValues::Repeat), header->repeatMemory);
+    EXPECT_EQ(0x1000u, header->address);
+    EXPECT_EQ(4096u, header->dataSizeInBytes);
+    EXPECT_EQ((sizeMemoryWriteHeader + sizeof(uint32_t)) / sizeof(uint32_t) - 1, header->dwordCount);
+    EXPECT_EQ(0xabcdabcdu, header->data[0]);
+
+    page[5] = 0;
+    stream.written.clear();
+    stream.writeMemory(0x1000, page.data(), 4096, AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+
+    ASSERT_EQ(sizeMemoryWriteHeader + 4096, stream.written.size());
+    header = reinterpret_cast<const AubMemDump::CmdServicesMemTraceMemoryWrite *>(stream.written.data());
+    EXPECT_EQ(static_cast<uint32_t>(AubMemDump::CmdServicesMemTraceMemoryWrite::RepeatMemoryValues::NoRepeat), header->repeatMemory);
+}
+
+TEST(AubFileStreamTest, givenCompactUniformMemoryDisabledWhenUniformMemoryIsWrittenThenWholeMemoryIsWritten) {
+    CapturingAubFileStream stream;
+    std::vector<uint32_t> page(1024, 0);
+    stream.writeMemory(0x1000, page.data(), 4096, AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+    EXPECT_EQ(sizeMemoryWriteHeader + 4096, stream.written.size());
+}
+
+TEST(AubFileStreamTest, givenAsyncWriteBufferWhenStreamIsClosedThenFileContainsAllWritesInOrder) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpAsyncWriteBufferSize.set(2);
+    std::string fileName = "async_file_name.aub";
+
+    std::string expected;
+    {
+        AUBCommandStreamReceiver::AubFileStream stream;
+        stream.open(fileName.c_str());
+        ASSERT_TRUE(stream.isOpen());
+        EXPECT_NE(nullptr, stream.asyncWriter);
+
+        std::vector<uint32_t> page(1024);
+        for (uint32_t i = 0; i < 1024; i++) {
+            std::fill(page.begin(), page.end(), i);
+            stream.writeMemory(i * 4096, page.data(), 4096, AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+            if (i % 100 == 0) {
+                stream.flush();
+            }
+        }
+        stream.close();
+        EXPECT_EQ(nullptr, stream.asyncWriter);
+
+        CapturingAubFileStream expectedStream;
+        for (uint32_t i = 0; i < 1024; i++) {
+            std::fill(page.begin(), page.end(), i);
+            expectedStream.writeMemory(i * 4096, page.data(), 4096, AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+        }
+        expected = expectedStream.written;
+    }
+
+    std::ifstream aubFile(fileName, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(aubFile)), std::istreambuf_iterator<char>());
+    aubFile.close();
+    std::remove(fileName.c_str());
+    EXPECT_EQ(expected.size(), written.size());
+    EXPECT_TRUE(expected == written);
+}
+
+TEST(AubFileStreamTest, givenPageWrittenToStreamWhenTrackPageWriteIsCalledThenStateOfPageInFileIsReturned) {
+    AUBCommandStreamReceiver::AubFileStream stream;
+    using PageDumpState = AUBCommandStreamReceiver::AubFileStream::PageDumpState;
+    std::vector<char> page(4096, 1);
+
+    EXPECT_EQ(PageDumpState::NotDumped, stream.trackPageWrite(0x10000, 0x2000, 0x3, page.data(), 4096));
+    EXPECT_EQ(PageDumpState::EntryAndContentDumped, stream.trackPageWrite(0x10000, 0x2000, 0x3, page.data(), 4096));
+
+    page[100] = 2;
+    EXPECT_EQ(PageDumpState::EntryDumped, stream.trackPageWrite(0x10000, 0x2000, 0x3, page.data(), 4096));
+    EXPECT_EQ(PageDumpState::EntryDumped, stream.trackPageWrite(0x10100, 0x2100, 0x3, page.data(), 256));
+    EXPECT_EQ(PageDumpState::NotDumped, stream.trackPageWrite(0x10100, 0x2100, 0x7, page.data(), 256));
+    EXPECT_EQ(PageDumpState::NotDumped, stream.trackPageWrite(0x10100, 0x5100, 0x7, page.data(), 256));
+
+    stream.invalidateDumpedContent(0x10ff0, 0x20);
+    EXPECT_EQ(PageDumpState::EntryDumped, stream.trackPageWrite(0x10100, 0x5100, 0x7, page.data(), 256));
+    EXPECT_EQ(PageDumpState::EntryAndContentDumped, stream.trackPageWrite(0x10100, 0x5100, 0x7, page.data(), 256));
+
+    stream.invalidateDumpedPages(0x10ff0, 0x20);
+    EXPECT_EQ(PageDumpState::NotDumped, stream.trackPageWrite(0x10100, 0x5100, 0x7, page.data(), 256));
+
+    stream.close();
+    EXPECT_EQ(PageDumpState::NotDumped, stream.trackPageWrite(0x10100, 0x5100, 0x7, page.data(), 256));
+}
+
+HWTEST_F(AubFileStreamTests, givenIncrementalResidencyWhenUnchangedMemoryIsWrittenAgainThenNothingIsDumped) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpIncrementalResidency.set(true);
+    pDevice->executionEnvironment->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    CountingAubFileStream stream;
+    aubCsr->stream = &stream;
+
+    uint64_t gpuAddress = 0x100000;
+    std::vector<char> buffer(2 * MemoryConstants::pageSize, 0);
+    auto entryBits = BIT(PageTableEntry::presentBit) | BIT(PageTableEntry::writableBit);
+
+    aubCsr->writeMemory(gpuAddress, buffer.data(), buffer.size(), MemoryBanks::MainBank, entryBits, DevicesBitfield(0));
+    EXPECT_EQ(2u, stream.writeMemoryCalled);
+    EXPECT_NE(0u, stream.writePTECalled);
+
+    stream.writeMemoryCalled = 0;
+    stream.writePTECalled = 0;
+    aubCsr->writeMemory(gpuAddress, buffer.data(), buffer.size(), MemoryBanks::MainBank, entryBits, DevicesBitfield(0));
+    EXPECT_EQ(0u, stream.writeMemoryCalled);
+    EXPECT_EQ(0u, stream.writePTECalled);
+
+    buffer[MemoryConstants::pageSize + 1] = 1;
+    aubCsr->writeMemory(gpuAddress, buffer.data(), buffer.size(), MemoryBanks::MainBank, entryBits, DevicesBitfield(0));
+    EXPECT_EQ(1u, stream.writeMemoryCalled);
+    EXPECT_EQ(0u, stream.writePTECalled);
+}
+
+HWTEST_F(AubFileStreamTests, givenIncrementalResidencyDisabledWhenUnchangedMemoryIsWrittenAgainThenItIsDumpedAgain) {
+    pDevice->executionEnvironment->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    CountingAubFileStream stream;
+    aubCsr->stream = &stream;
+
+    std::vector<char> buffer(MemoryConstants::pageSize, 0);
+    auto entryBits = BIT(PageTableEntry::presentBit) | BIT(PageTableEntry::writableBit);
+
+    aubCsr->writeMemory(0x100000, buffer.data(), buffer.size(), MemoryBanks::MainBank, entryBits, DevicesBitfield(0));
+    stream.writeMemoryCalled = 0;
+    stream.writePTECalled = 0;
+    aubCsr->writeMemory(0x100000, buffer.data(), buffer.size(), MemoryBanks::MainBank, entryBits, DevicesBitfield(0));
+    EXPECT_EQ(1u, stream.writeMemoryCalled);
+    EXPECT_NE(0u, stream.writePTECalled);
+}
+
+HWTEST_F(AubFileStreamTests, givenIncrementalResidencyWhenBatchBufferIsSubmittedThenMemoryOfGpuWritableResidentAllocationsIsDumpedAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpIncrementalResidency.set(true);
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+    LinearStream cs(aubExecutionEnvironment->commandBuffer);
+    CountingAubFileStream stream;
+    aubCsr->stream = &stream;
+
+    std::vector<char> bufferMemory(MemoryConstants::pageSize, 0);
+    std::vector<char> isaMemory(MemoryConstants::pageSize, 0);
+    MockGraphicsAllocation bufferAllocation(bufferMemory.data(), bufferMemory.size());
+    bufferAllocation.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    MockGraphicsAllocation isaAllocation(isaMemory.data(), isaMemory.size());
+    isaAllocation.setAllocationType(GraphicsAllocation::AllocationType::KERNEL_ISA);
+
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+    ResidencyContainer allocationsForResidency = {&bufferAllocation, &isaAllocation};
+    aubCsr->flush(batchBuffer, allocationsForResidency);
+
+    // GPU could have changed buffer, CPU writing back the same content must not be skipped, its entries are unchanged
+    bufferAllocation.setAubWritable(true);
+    stream.writeMemoryCalled = 0;
+    stream.writePTECalled = 0;
+    EXPECT_TRUE(aubCsr->writeMemory(bufferAllocation));
+    EXPECT_NE(0u, stream.writeMemoryCalled);
+    EXPECT_EQ(0u, stream.writePTECalled);
+
+    stream.writeMemoryCalled = 0;
+    stream.writePTECalled = 0;
+    EXPECT_TRUE(aubCsr->writeMemory(isaAllocation));
+    EXPECT_EQ(0u, stream.writeMemoryCalled);
+    EXPECT_EQ(0u, stream.writePTECalled);
+}
@@ -212,6 +212,26 @@ TEST(DeviceCreation, givenDeviceWhenAskingForDefaultEngineThenReturnValidValue)
     EXPECT_EQ(0, defaultEngine.id);
 }
 
+TEST(DeviceCreation, givenBlitterOperationsSupportDisabledWhenDeviceIsCreatedThenBlitterEngineIsNotCreated) {
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    EXPECT_EQ(nullptr, device->getBlitterEngine());
+}
+
+TEST(DeviceCreation, givenBlitterOperationsSupportEnabledWhenDeviceIsCreatedThenBlitterEngineIsCreatedAfterGpgpuEngines) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableBlitterOperationsSupport.set(true);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    auto numGpgpuEngines = HwHelper::get(platformDevices[0]->pPlatform->eRenderCoreFamily).getGpgpuEngineInstances().size();
+
+    auto blitterEngine = device->getBlitterEngine();
+    ASSERT_NE(nullptr, blitterEngine);
+    EXPECT_EQ(ENGINE_BCS, blitterEngine->osContext->getEngineType().type);
+    EXPECT_NE(nullptr, blitterEngine->commandStreamReceiver);
+    EXPECT_NE(device->getDefaultEngine().commandStreamReceiver, blitterEngine->commandStreamReceiver);
+    EXPECT_EQ(numGpgpuEngines + 1, device->getMemoryManager()->getOsContextCount());
+}
+
 TEST(DeviceCreation, givenFtrSimulationModeFlagTrueWhenNoOtherSimulationFlagsArePresentThenIsSimulationReturnsTrue) {
     FeatureTable skuTable = *platformDevices[0]->pSkuTable;
     skuTable.ftrSimulationMode = true;
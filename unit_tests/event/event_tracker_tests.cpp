@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,13 @@
 #include "runtime/event/event.h"
 #include "runtime/helpers/file_io.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_device.h"
 
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <iterator>
 
 struct ClonedStream : std::stringstream {
     ClonedStream(std::string &clonedOutput)
@@ -45,6 +49,9 @@ class EventsTrackerMock : public EventsTracker {
     IFList<TrackedEvent, true, true> *getList() {
         return &trackedEvents;
     }
+    void enableStreamingToMemory(void *stream, size_t streamSize) {
+        streamWriter.reset(new EventsStreamWriter(stream, streamSize));
+    }
     std::string streamMock;
     std::unique_ptr<EventsTracker> originGlobal;
 };
@@ -673,3 +680,122 @@ TEST(EventsTracker, givenEventsFromDifferentThreadsThenDumpingProperly) {
 
     EXPECT_STREQ(expected.str().c_str(), evTrackerMockMT->streamMock.c_str());
 }
+
+TEST(EventsTracker, givenStreamingEnabledWhenEventIsCreatedChangedAndDestroyedThenRecordsAreStreamedInsteadOfGraphs) {
+    DebugManagerStateRestore dbRestore;
+    DebugManager.flags.EventsTrackerEnable.set(true);
+
+    EventsTrackerMock evTrackerMock;
+    evTrackerMock.overrideGlobal();
+    auto globalTrackerMock = static_cast<EventsTrackerMock *>(&EventsTracker::getEventsTracker());
+    std::vector<uint64_t> stream(1024);
+    globalTrackerMock->enableStreamingToMemory(stream.data(), stream.size() * sizeof(uint64_t));
+
+    Event *ev = new Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady);
+    ev->setStatus(CL_RUNNING);
+    delete ev;
+
+    EXPECT_TRUE(globalTrackerMock->streamMock.empty());
+
+    std::vector<EventsStream::RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), stream.size() * sizeof(uint64_t), records));
+    ASSERT_LE(3u, records.size());
+    EXPECT_EQ(EventsStream::RecordType::Create, records.front().type);
+    EXPECT_EQ(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ev)), records.front().event);
+    EXPECT_EQ(CL_COMMAND_NDRANGE_KERNEL, records.front().value);
+    EXPECT_EQ(EventsStream::RecordType::Destroy, records.back().type);
+    auto runningTransition = std::find_if(records.begin(), records.end(), [](const EventsStream::RecordData &record) {
+        return record.type == EventsStream::RecordType::StatusTransition && record.value == CL_RUNNING;
+    });
+    EXPECT_NE(records.end(), runningTransition);
+
+    evTrackerMock.restoreGlobal();
+}
+
+TEST(EventsTracker, givenStreamingEnabledWhenDependencyIsNotifiedThenEdgeIsStreamed) {
+    EventsTrackerMock evTrackerMock;
+    std::vector<uint64_t> stream(1024);
+    evTrackerMock.enableStreamingToMemory(stream.data(), stream.size() * sizeof(uint64_t));
+
+    UserEvent parentEvent;
+    UserEvent childEvent;
+    evTrackerMock.notifyDependency(&parentEvent, &childEvent);
+
+    std::vector<EventsStream::RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), stream.size() * sizeof(uint64_t), records));
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(EventsStream::RecordType::Dependency, records[0].type);
+    EXPECT_EQ(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&parentEvent)), records[0].event);
+    EXPECT_EQ(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&childEvent)), records[0].argument);
+}
+
+TEST(EventsTracker, givenStreamingDisabledWhenDependencyIsNotifiedThenNothingIsDumped) {
+    EventsTrackerMock evTrackerMock;
+    UserEvent parentEvent;
+    UserEvent childEvent;
+    evTrackerMock.notifyDependency(&parentEvent, &childEvent);
+    EXPECT_EQ(nullptr, evTrackerMock.getStreamWriter());
+    EXPECT_TRUE(evTrackerMock.streamMock.empty());
+}
+
+TEST(EventsTracker, givenStreamingEnabledWhenCommandPhasesAreNotifiedThenTheyAreStreamed) {
+    EventsTrackerMock evTrackerMock;
+    std::vector<uint64_t> stream(1024);
+    evTrackerMock.enableStreamingToMemory(stream.data(), stream.size() * sizeof(uint64_t));
+
+    UserEvent event;
+    auto commandStreamReceiver = reinterpret_cast<const CommandStreamReceiver *>(0x1000);
+    evTrackerMock.notifySubmission(&event, commandStreamReceiver, 5, false);
+    evTrackerMock.notifySubmission(&event, commandStreamReceiver, 6, true);
+    evTrackerMock.notifyFlush(commandStreamReceiver, 6);
+    evTrackerMock.notifyGpuExecution(&event, 100, 200);
+
+    std::vector<EventsStream::RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), stream.size() * sizeof(uint64_t), records));
+    ASSERT_EQ(5u, records.size());
+    auto eventId = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&event));
+    EXPECT_EQ(EventsStream::RecordType::Submission, records[0].type);
+    EXPECT_EQ(eventId, records[0].event);
+    EXPECT_EQ(0x1000u, records[0].argument);
+    EXPECT_EQ(5, records[0].value);
+    EXPECT_EQ(EventsStream::RecordType::BlockedSubmission, records[1].type);
+    EXPECT_EQ(6, records[1].value);
+    EXPECT_EQ(EventsStream::RecordType::Flush, records[2].type);
+    EXPECT_EQ(0x1000u, records[2].event);
+    EXPECT_EQ(6u, records[2].argument);
+    EXPECT_EQ(EventsStream::RecordType::GpuStart, records[3].type);
+    EXPECT_EQ(100u, records[3].argument);
+    EXPECT_EQ(EventsStream::RecordType::GpuEnd, records[4].type);
+    EXPECT_EQ(200u, records[4].argument);
+}
+
+TEST(EventsTracker, givenStreamingEnabledWhenCompletionStampIsUpdatedWithNotReadyTaskCountThenSubmissionIsNotStreamed) {
+    DebugManagerStateRestore dbRestore;
+    DebugManager.flags.EventsTrackerEnable.set(true);
+
+    EventsTrackerMock evTrackerMock;
+    evTrackerMock.overrideGlobal();
+    auto globalTrackerMock = static_cast<EventsTrackerMock *>(&EventsTracker::getEventsTracker());
+    std::vector<uint64_t> stream(1024);
+    globalTrackerMock->enableStreamingToMemory(stream.data(), stream.size() * sizeof(uint64_t));
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context(device.get());
+    MockCommandQueue cmdQ(&context, device.get(), nullptr);
+    {
+        Event event(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady);
+        event.updateCompletionStamp(Event::eventNotReady, Event::eventNotReady, 0);
+        event.updateCompletionStamp(3, 1, 0);
+    }
+
+    std::vector<EventsStream::RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), stream.size() * sizeof(uint64_t), records));
+    std::vector<EventsStream::RecordData> submissions;
+    std::copy_if(records.begin(), records.end(), std::back_inserter(submissions), [](const EventsStream::RecordData &record) {
+        return record.type == EventsStream::RecordType::Submission;
+    });
+    ASSERT_EQ(1u, submissions.size());
+    EXPECT_EQ(3, submissions[0].value);
+
+    evTrackerMock.restoreGlobal();
+}
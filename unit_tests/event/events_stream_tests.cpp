@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/events_stream.h"
+
+#include "CL/cl.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using namespace OCLRT;
+using EventsStream::RecordData;
+using EventsStream::RecordType;
+
+namespace {
+size_t getStreamSize(size_t recordsCount) {
+    return sizeof(EventsStream::Header) + recordsCount * sizeof(EventsStream::Record);
+}
+
+uint64_t toId(uintptr_t address) {
+    return static_cast<uint64_t>(address);
+}
+} // namespace
+
+TEST(EventsStreamTest, givenWrittenRecordsWhenReadingThenTheyAreReturnedInOrder) {
+    std::vector<uint64_t> stream(getStreamSize(8) / sizeof(uint64_t));
+    EventsStreamWriter writer(stream.data(), getStreamSize(8));
+    EXPECT_EQ(8u, writer.getRecordsCapacity());
+
+    auto event = reinterpret_cast<void *>(0x1000);
+    writer.write(RecordType::Create, event, 0x2000, CL_COMMAND_NDRANGE_KERNEL);
+    writer.write(RecordType::StatusTransition, event, 0, CL_SUBMITTED);
+    writer.write(RecordType::Destroy, event, 0, 0);
+    EXPECT_EQ(3u, writer.getWrittenRecordsCount());
+
+    std::vector<RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), getStreamSize(8), records));
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(RecordType::Create, records[0].type);
+    EXPECT_EQ(0x1000u, records[0].event);
+    EXPECT_EQ(0x2000u, records[0].argument);
+    EXPECT_EQ(CL_COMMAND_NDRANGE_KERNEL, records[0].value);
+    EXPECT_EQ(RecordType::StatusTransition, records[1].type);
+    EXPECT_EQ(CL_SUBMITTED, records[1].value);
+    EXPECT_EQ(RecordType::Destroy, records[2].type);
+    for (size_t i = 0; i < records.size(); i++) {
+        EXPECT_EQ(i + 1, records[i].sequence);
+    }
+    EXPECT_LE(records[0].timestamp, records[2].timestamp);
+}
+
+TEST(EventsStreamTest, givenMoreRecordsThanCapacityWhenReadingThenOnlyMostRecentAreReturned) {
+    std::vector<uint64_t> stream(getStreamSize(4) / sizeof(uint64_t));
+    EventsStreamWriter writer(stream.data(), getStreamSize(4));
+    for (uint64_t i = 0; i < 10; i++) {
+        writer.write(RecordType::Create, reinterpret_cast<void *>(i), 0, 0);
+    }
+
+    std::vector<RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), getStreamSize(4), records));
+    ASSERT_EQ(4u, records.size());
+    for (uint64_t i = 0; i < 4; i++) {
+        EXPECT_EQ(i + 6, records[i].event);
+    }
+}
+
+TEST(EventsStreamTest, givenRecordBeingWrittenWhenReadingThenItIsSkipped) {
+    std::vector<uint64_t> stream(getStreamSize(4) / sizeof(uint64_t));
+    EventsStreamWriter writer(stream.data(), getStreamSize(4));
+    writer.write(RecordType::Create, nullptr, 0, 0);
+    writer.write(RecordType::Destroy, nullptr, 0, 0);
+
+    auto header = reinterpret_cast<EventsStream::Header *>(stream.data());
+    auto streamRecords = reinterpret_cast<EventsStream::Record *>(header + 1);
+    streamRecords[1].sequence = 0;
+
+    std::vector<RecordData> records;
+    ASSERT_TRUE(EventsStream::readRecords(stream.data(), getStreamSize(4), records));
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(RecordType::Create, records[0].type);
+}
+
+TEST(EventsStreamTest, givenMemoryWithoutStreamWhenReadingThenFalseIsReturned) {
+    std::vector<uint64_t> stream(getStreamSize(4) / sizeof(uint64_t));
+    std::vector<RecordData> records;
+    EXPECT_FALSE(EventsStream::readRecords(stream.data(), getStreamSize(4), records));
+    EXPECT_FALSE(EventsStream::readRecords(stream.data(), sizeof(EventsStream::Header) - 1, records));
+
+    EventsStreamWriter writer(stream.data(), getStreamSize(4));
+    EXPECT_FALSE(EventsStream::readRecords(stream.data(), getStreamSize(3), records));
+    EXPECT_TRUE(records.empty());
+}
+
+TEST(EventsStreamGraphTest, givenRecordsWhenGraphIsBuiltThenEachEventLifetimeIsSeparateNode) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x1), RecordType::Create, CL_COMMAND_USER},
+        {2, 20, toId(0x200), toId(0x1), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {3, 30, toId(0x100), toId(0x200), RecordType::Dependency, 0},
+        {4, 40, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {5, 50, toId(0x100), 0, RecordType::StatusTransition, CL_QUEUED},
+        {6, 60, toId(0x100), 0, RecordType::Destroy, 0},
+        {7, 70, toId(0x100), toId(0x1), RecordType::Create, CL_COMMAND_READ_BUFFER},
+        {8, 80, toId(0x300), 0, RecordType::StatusTransition, CL_SUBMITTED}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+    auto &nodes = graph.getNodes();
+    ASSERT_EQ(4u, nodes.size());
+
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_USER), nodes[0].commandType);
+    EXPECT_EQ(CL_COMPLETE, nodes[0].executionStatus);
+    EXPECT_EQ(10u, nodes[0].createTimestamp);
+    EXPECT_EQ(40u, nodes[0].submitTimestamp);
+    EXPECT_EQ(40u, nodes[0].completeTimestamp);
+    EXPECT_EQ(60u, nodes[0].destroyTimestamp);
+    ASSERT_EQ(1u, nodes[0].children.size());
+    EXPECT_EQ(1u, nodes[0].children[0]);
+    ASSERT_EQ(1u, nodes[1].parents.size());
+    EXPECT_EQ(0u, nodes[1].parents[0]);
+
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_READ_BUFFER), nodes[2].commandType);
+    EXPECT_EQ(CL_QUEUED, nodes[2].executionStatus);
+
+    // event created before oldest record in ring
+    EXPECT_EQ(toId(0x300), nodes[3].event);
+    EXPECT_EQ(EventsStreamGraph::noTimestamp, nodes[3].createTimestamp);
+    EXPECT_EQ(80u, nodes[3].submitTimestamp);
+}
+
+TEST(EventsStreamGraphTest, givenDependentEventsWhenCriticalPathIsQueriedThenChainOfLatestCompletedParentsIsReturned) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), 0, RecordType::Create, CL_COMMAND_USER},
+        {2, 11, toId(0x200), 0, RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {3, 12, toId(0x300), 0, RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {4, 13, toId(0x400), 0, RecordType::Create, CL_COMMAND_READ_BUFFER},
+        {5, 14, toId(0x100), toId(0x300), RecordType::Dependency, 0},
+        {6, 15, toId(0x200), toId(0x400), RecordType::Dependency, 0},
+        {7, 16, toId(0x300), toId(0x400), RecordType::Dependency, 0},
+        {8, 20, toId(0x200), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {9, 50, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {10, 55, toId(0x300), 0, RecordType::StatusTransition, CL_SUBMITTED},
+        {11, 70, toId(0x300), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {12, 75, toId(0x400), 0, RecordType::StatusTransition, CL_SUBMITTED},
+        {13, 90, toId(0x400), 0, RecordType::StatusTransition, CL_COMPLETE}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+    std::vector<size_t> expectedPath = {0, 2, 3};
+    EXPECT_EQ(expectedPath, graph.getCriticalPath());
+
+    std::stringstream out;
+    graph.dumpCriticalPath(out);
+    EXPECT_EQ("e0 CL_COMMAND_USER queue=0x0 wait=0 queued=40 executing=0\n"
+              "e2 CL_COMMAND_NDRANGE_KERNEL queue=0x0 wait=5 queued=43 executing=15\n"
+              "e3 CL_COMMAND_READ_BUFFER queue=0x0 wait=5 queued=62 executing=15\n",
+              out.str());
+}
+
+TEST(EventsStreamGraphTest, givenNoCompletedEventsWhenCriticalPathIsQueriedThenItIsEmpty) {
+    EventsStreamGraph graph;
+    EXPECT_TRUE(graph.getCriticalPath().empty());
+
+    graph.build({{1, 10, toId(0x100), 0, RecordType::Create, CL_COMMAND_USER}});
+    EXPECT_TRUE(graph.getCriticalPath().empty());
+}
+
+TEST(EventsStreamGraphTest, givenGraphWhenDumpingDotThenNodesAndEdgesAreWritten) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x10), RecordType::Create, CL_COMMAND_USER},
+        {2, 11, toId(0x200), toId(0x10), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {3, 12, toId(0x100), toId(0x200), RecordType::Dependency, 0},
+        {4, 13, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {5, 14, toId(0x200), 0, RecordType::StatusTransition, CL_SUBMITTED}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+    std::stringstream out;
+    graph.dumpDot(out);
+    EXPECT_EQ("digraph events_stream {\n"
+              "node [shape=record]\n"
+              "e0[label=\"{CL_COMMAND_USER|CL_COMPLETE|event=0x100, queue=0x10}\",color=green];\n"
+              "e1[label=\"{CL_COMMAND_NDRANGE_KERNEL|CL_SUBMITTED|event=0x200, queue=0x10}\",color=yellow];\n"
+              "e0->e1;\n"
+              "}\n",
+              out.str());
+}
+
+TEST(EventsStreamGraphTest, givenSubmissionAndFlushRecordsWhenGraphIsBuiltThenTaskIsMatchedWithItsFlush) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x10), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {2, 11, toId(0xc0), 1, RecordType::Flush, 0},
+        {3, 12, toId(0x100), toId(0xc0), RecordType::Submission, 1},
+        {4, 20, toId(0x200), toId(0x10), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {5, 21, toId(0x200), toId(0xc0), RecordType::BlockedSubmission, 2},
+        {6, 22, toId(0x300), toId(0x10), RecordType::Create, CL_COMMAND_READ_BUFFER},
+        {7, 23, toId(0x300), toId(0xc0), RecordType::Submission, 3},
+        {8, 30, toId(0xc0), 2, RecordType::Flush, 0},
+        {9, 31, toId(0x100), 40, RecordType::GpuStart, 0},
+        {10, 32, toId(0x100), 50, RecordType::GpuEnd, 0}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+    auto &nodes = graph.getNodes();
+    ASSERT_EQ(3u, nodes.size());
+
+    // flushed with immediate dispatch before event got its task count
+    EXPECT_EQ(toId(0xc0), nodes[0].commandStreamReceiver);
+    EXPECT_EQ(1u, nodes[0].taskCount);
+    EXPECT_FALSE(nodes[0].blocked);
+    EXPECT_EQ(12u, nodes[0].taskSubmitTimestamp);
+    EXPECT_EQ(12u, nodes[0].flushTimestamp);
+    EXPECT_EQ(40u, nodes[0].gpuStartTimestamp);
+    EXPECT_EQ(50u, nodes[0].gpuEndTimestamp);
+
+    // batched until later flush
+    EXPECT_TRUE(nodes[1].blocked);
+    EXPECT_EQ(21u, nodes[1].taskSubmitTimestamp);
+    EXPECT_EQ(30u, nodes[1].flushTimestamp);
+
+    EXPECT_EQ(23u, nodes[2].taskSubmitTimestamp);
+    EXPECT_EQ(EventsStreamGraph::noTimestamp, nodes[2].flushTimestamp);
+}
+
+TEST(EventsStreamGraphTest, givenCommandBlockedByUserEventWhenStallsAreQueriedThenLifetimeIsSplitIntoPhases) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x1), RecordType::Create, CL_COMMAND_USER},
+        {2, 20, toId(0x200), toId(0x1), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {3, 21, toId(0x100), toId(0x200), RecordType::Dependency, 0},
+        {4, 100, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {5, 110, toId(0x200), toId(0xc0), RecordType::BlockedSubmission, 7},
+        {6, 130, toId(0xc0), 7, RecordType::Flush, 0},
+        {7, 195, toId(0x200), 150, RecordType::GpuStart, 0},
+        {8, 195, toId(0x200), 190, RecordType::GpuEnd, 0},
+        {9, 200, toId(0x200), 0, RecordType::StatusTransition, CL_COMPLETE}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+
+    auto stalls = graph.getStalls(1);
+    EXPECT_EQ(80u, stalls.dependencyWait);
+    EXPECT_EQ(0u, stalls.blockingParent);
+    EXPECT_EQ(10u, stalls.submission);
+    EXPECT_EQ(20u, stalls.batching);
+    EXPECT_EQ(20u, stalls.gpuQueue);
+    EXPECT_EQ(40u, stalls.gpuExecution);
+    EXPECT_EQ(10u, stalls.completionNotify);
+
+    auto sinceParentCompleted = graph.getStalls(1, 100);
+    EXPECT_EQ(0u, sinceParentCompleted.dependencyWait);
+    EXPECT_EQ(10u, sinceParentCompleted.submission);
+    EXPECT_EQ(40u, sinceParentCompleted.gpuExecution);
+
+    std::stringstream out;
+    graph.dumpStalls(out);
+    EXPECT_EQ("e0 CL_COMMAND_USER queue=0x1 critical dependency=0 submission=0 batching=0 gpuQueue=0 execution=90 notify=0\n"
+              "e1 CL_COMMAND_NDRANGE_KERNEL queue=0x1 critical blocked after=e0 dependency=80 submission=10 batching=20 gpuQueue=20 execution=40 notify=10\n"
+              "critical-path nodes=2 dependency=0 submission=10 batching=20 gpuQueue=20 execution=130 notify=10\n",
+              out.str());
+}
+
+TEST(EventsStreamGraphTest, givenCommandDependingOnOtherQueueWhenStallsAreQueriedThenDependencyIsWaitedForOnGpu) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x1), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {2, 11, toId(0xa0), 1, RecordType::Flush, 0},
+        {3, 12, toId(0x100), toId(0xa0), RecordType::Submission, 1},
+        {4, 13, toId(0x200), toId(0x2), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {5, 13, toId(0x100), toId(0x200), RecordType::Dependency, 0},
+        {6, 15, toId(0x200), toId(0xb0), RecordType::Submission, 1},
+        {7, 16, toId(0xb0), 1, RecordType::Flush, 0},
+        {8, 65, toId(0x100), 20, RecordType::GpuStart, 0},
+        {9, 65, toId(0x100), 60, RecordType::GpuEnd, 0},
+        {10, 70, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {11, 85, toId(0x200), 62, RecordType::GpuStart, 0},
+        {12, 85, toId(0x200), 80, RecordType::GpuEnd, 0},
+        {13, 90, toId(0x200), 0, RecordType::StatusTransition, CL_COMPLETE}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+
+    auto stalls = graph.getStalls(1);
+    EXPECT_EQ(44u, stalls.dependencyWait);
+    EXPECT_EQ(2u, stalls.submission);
+    EXPECT_EQ(1u, stalls.batching);
+    EXPECT_EQ(2u, stalls.gpuQueue);
+    EXPECT_EQ(18u, stalls.gpuExecution);
+    EXPECT_EQ(10u, stalls.completionNotify);
+}
+
+TEST(EventsStreamGraphTest, givenMissingPhaseRecordsWhenStallsAreQueriedThenTheySumToLifetime) {
+    std::vector<RecordData> records = {
+        {1, 10, toId(0x100), toId(0x1), RecordType::Create, CL_COMMAND_NDRANGE_KERNEL},
+        {2, 15, toId(0x100), toId(0xc0), RecordType::Submission, 1},
+        {3, 20, toId(0x100), 0, RecordType::StatusTransition, CL_SUBMITTED},
+        // GPU timestamp converted slightly past observed completion
+        {4, 60, toId(0x100), 65, RecordType::GpuStart, 0},
+        {5, 60, toId(0x100), 0, RecordType::StatusTransition, CL_COMPLETE},
+        {6, 70, toId(0x200), toId(0x1), RecordType::Create, CL_COMMAND_READ_BUFFER}};
+
+    EventsStreamGraph graph;
+    graph.build(records);
+
+    auto stalls = graph.getStalls(0);
+    EXPECT_EQ(0u, stalls.dependencyWait);
+    EXPECT_EQ(5u, stalls.submission);
+    EXPECT_EQ(0u, stalls.batching);
+    EXPECT_EQ(45u, stalls.gpuQueue);
+    EXPECT_EQ(0u, stalls.gpuExecution);
+    EXPECT_EQ(0u, stalls.completionNotify);
+
+    auto notCompleted = graph.getStalls(1);
+    EXPECT_EQ(0u, notCompleted.submission + notCompleted.gpuExecution);
+}
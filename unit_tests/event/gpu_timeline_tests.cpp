@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/gpu_timeline.h"
+#include "unit_tests/mocks/mock_ostime.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+namespace {
+constexpr uint64_t period = GpuTimeline::samplingPeriod;
+constexpr double nominalResolution = 80.0;
+} // namespace
+
+TEST(GpuTimelineTest, givenNoSamplesWhenConvertingThenNominalResolutionAndCpuTimeAreUsed) {
+    GpuTimeline timeline;
+    EXPECT_EQ(8000u, timeline.convertGpuTimeStamp(100, nominalResolution));
+    EXPECT_EQ(12345u, timeline.convertCpuTime(12345));
+}
+
+TEST(GpuTimelineTest, givenTimestampBetweenSamplesWhenConvertingThenMeasuredResolutionIsUsed) {
+    GpuTimeline timeline;
+    // GPU timer runs slightly slower than nominal 80ns per tick
+    timeline.addSample({1000, 50000}, 100000);
+    timeline.addSample({1000 + period / 100, 50000 + period}, 100000 + period);
+    ASSERT_EQ(2u, timeline.getSamplesCount());
+
+    EXPECT_EQ(100000u, timeline.convertGpuTimeStamp(1000, nominalResolution));
+    EXPECT_EQ(100000u + period / 2, timeline.convertGpuTimeStamp(1000 + period / 200, nominalResolution));
+}
+
+TEST(GpuTimelineTest, givenTimestampOutsideOfSamplesWhenConvertingThenNominalResolutionIsUsed) {
+    GpuTimeline timeline;
+    timeline.addSample({1000, 50000}, 100000);
+    timeline.addSample({2000, 50000 + period}, 100000 + period);
+
+    EXPECT_EQ(100000u + period + 800u, timeline.convertGpuTimeStamp(2010, nominalResolution));
+    EXPECT_EQ(100000u - 800u, timeline.convertGpuTimeStamp(990, nominalResolution));
+}
+
+TEST(GpuTimelineTest, givenCpuTimeWhenConvertingThenOffsetOfClosestPrecedingSampleIsUsed) {
+    GpuTimeline timeline;
+    timeline.addSample({1000, 50000}, 100000);
+    timeline.addSample({2000, 50000 + period}, 100000 + period + 7);
+
+    EXPECT_EQ(100010u, timeline.convertCpuTime(50010));
+    EXPECT_EQ(100000u + period + 17, timeline.convertCpuTime(50010 + period));
+    EXPECT_EQ(99990u, timeline.convertCpuTime(49990));
+}
+
+TEST(GpuTimelineTest, givenSampleCloserThanSamplingPeriodWhenAddedThenItIsIgnored) {
+    GpuTimeline timeline;
+    timeline.addSample({1000, 50000}, 100000);
+    timeline.addSample({1001, 50001}, 100000 + period - 1);
+    EXPECT_EQ(1u, timeline.getSamplesCount());
+}
+
+TEST(GpuTimelineTest, givenGpuTimestampLowerThanLatestSampleWhenAddedThenOlderSamplesAreDropped) {
+    GpuTimeline timeline;
+    timeline.addSample({1000, 50000}, 100000);
+    timeline.addSample({2000, 50000 + period}, 100000 + period);
+    timeline.addSample({10, 50000 + 2 * period}, 100000 + 2 * period);
+
+    EXPECT_EQ(1u, timeline.getSamplesCount());
+    EXPECT_EQ(100000u + 2 * period, timeline.convertGpuTimeStamp(10, nominalResolution));
+}
+
+TEST(GpuTimelineTest, givenMoreSamplesThanLimitWhenAddedThenOldestAreDropped) {
+    GpuTimeline timeline;
+    for (uint64_t i = 0; i < GpuTimeline::maxSamplesCount + 3; i++) {
+        timeline.addSample({i * 1000, i * period}, (i + 1) * period);
+    }
+    EXPECT_EQ(GpuTimeline::maxSamplesCount, timeline.getSamplesCount());
+    EXPECT_EQ(4 * period, timeline.convertGpuTimeStamp(3000, nominalResolution));
+}
+
+TEST(GpuTimelineTest, givenRecentSampleWhenSamplingOsTimeAgainThenNoNewSampleIsTaken) {
+    GpuTimeline timeline;
+    MockOSTime osTime;
+    timeline.sample(osTime);
+    timeline.sample(osTime);
+    EXPECT_EQ(1u, timeline.getSamplesCount());
+}
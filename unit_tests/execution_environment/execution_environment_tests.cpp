@@ -13,6 +13,7 @@
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/hw_helper.h"
 #include "runtime/helpers/options.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/os_agnostic_memory_manager.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/platform/platform.h"
@@ -232,6 +233,22 @@ TEST(ExecutionEnvironment, givenMultipleDevicesWhenTheyAreCreatedTheyAllReuseThe
     EXPECT_EQ(memoryManager, device2->getMemoryManager());
 }
 
+TEST(ExecutionEnvironment, givenCpuCopyEngineDisabledWhenGetCpuCopyEngineIsCalledThenNullptrIsReturned) {
+    ExecutionEnvironment executionEnvironment;
+    EXPECT_EQ(nullptr, executionEnvironment.getCpuCopyEngine());
+}
+
+TEST(ExecutionEnvironment, givenCpuCopyEngineEnabledWhenGetCpuCopyEngineIsCalledThenEngineIsCreatedOnceWithRequestedWorkersCount) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuCopyEngine.set(true);
+    DebugManager.flags.CpuCopyEngineWorkersCount.set(2);
+    ExecutionEnvironment executionEnvironment;
+    auto cpuCopyEngine = executionEnvironment.getCpuCopyEngine();
+    ASSERT_NE(nullptr, cpuCopyEngine);
+    EXPECT_EQ(2u, cpuCopyEngine->getWorkersCount());
+    EXPECT_EQ(cpuCopyEngine, executionEnvironment.getCpuCopyEngine());
+}
+
 typedef ::testing::Test ExecutionEnvironmentHw;
 
 HWTEST_F(ExecutionEnvironmentHw, givenHwHelperInputWhenInitializingCsrThenCreatePageTableManagerIfAllowed) {
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/linear_stream.h"
+#include "runtime/helpers/blit_commands_helper.h"
+#include "runtime/helpers/timestamp_packet.h"
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/libult/ult_command_stream_receiver.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/mocks/mock_graphics_allocation.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+using BlitCommandsHelperTest = ::testing::Test;
+
+HWTEST_F(BlitCommandsHelperTest, givenCopySizeWhenAskedForBlitsCountThenRectanglesAreLimitedByMaxWidthAndHeight) {
+    constexpr auto maxWidth = BlitterConstants::maxBlitWidth;
+    constexpr auto maxHeight = BlitterConstants::maxBlitHeight;
+
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getBlitsCount(1));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getBlitsCount(maxWidth));
+    EXPECT_EQ(2u, BlitCommandsHelper<FamilyType>::getBlitsCount(maxWidth + 1));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getBlitsCount(maxWidth * 3));
+    EXPECT_EQ(2u, BlitCommandsHelper<FamilyType>::getBlitsCount(maxWidth * maxHeight + 1));
+    EXPECT_EQ(3u, BlitCommandsHelper<FamilyType>::getBlitsCount(maxWidth * (maxHeight + 1) + 1));
+}
+
+HWTEST_F(BlitCommandsHelperTest, givenCopySizeNotAlignedToMaxWidthWhenDispatchingThenRemainderIsCopiedWithSeparateBlit) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+    constexpr auto maxWidth = BlitterConstants::maxBlitWidth;
+
+    uint32_t streamBuffer[256] = {};
+    LinearStream linearStream(streamBuffer, sizeof(streamBuffer));
+
+    BlitProperties blitProperties;
+    blitProperties.srcGpuAddress = 0x10000;
+    blitProperties.dstGpuAddress = 0x800000;
+    blitProperties.copySize = 2 * maxWidth + 7;
+
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(blitProperties, linearStream);
+    EXPECT_EQ(2 * sizeof(XY_SRC_COPY_BLT), linearStream.getUsed());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(linearStream);
+
+    auto itor = find<XY_SRC_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), itor);
+    auto bltCmd = genCmdCast<XY_SRC_COPY_BLT *>(*itor);
+    EXPECT_EQ(maxWidth, bltCmd->getDestinationX2CoordinateRight());
+    EXPECT_EQ(2u, bltCmd->getDestinationY2CoordinateBottom());
+    EXPECT_EQ(maxWidth, bltCmd->getDestinationPitch());
+    EXPECT_EQ(maxWidth, bltCmd->getSourcePitch());
+    EXPECT_EQ(blitProperties.srcGpuAddress, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(blitProperties.dstGpuAddress, bltCmd->getDestinationBaseAddress());
+    EXPECT_EQ(XY_SRC_COPY_BLT::RASTER_OPERATION_SRC, bltCmd->getRasterOperation());
+    EXPECT_EQ(XY_SRC_COPY_BLT::COLOR_DEPTH_8_BIT_COLOR, bltCmd->getColorDepth());
+
+    itor = find<XY_SRC_COPY_BLT *>(++itor, hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), itor);
+    bltCmd = genCmdCast<XY_SRC_COPY_BLT *>(*itor);
+    EXPECT_EQ(7u, bltCmd->getDestinationX2CoordinateRight());
+    EXPECT_EQ(1u, bltCmd->getDestinationY2CoordinateBottom());
+    EXPECT_EQ(7u, bltCmd->getDestinationPitch());
+    EXPECT_EQ(blitProperties.srcGpuAddress + 2 * maxWidth, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(blitProperties.dstGpuAddress + 2 * maxWidth, bltCmd->getDestinationBaseAddress());
+}
+
+HWTEST_F(BlitCommandsHelperTest, whenProgrammingMiFlushDwThenQwordImmediateDataIsWrittenToGivenAddress) {
+    using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
+
+    uint32_t streamBuffer[64] = {};
+    LinearStream linearStream(streamBuffer, sizeof(streamBuffer));
+
+    BlitCommandsHelper<FamilyType>::programMiFlushDw(linearStream, 0x1230, 0x55);
+    EXPECT_EQ(sizeof(MI_FLUSH_DW), linearStream.getUsed());
+
+    auto miFlushDwCmd = genCmdCast<MI_FLUSH_DW *>(streamBuffer);
+    ASSERT_NE(nullptr, miFlushDwCmd);
+    EXPECT_EQ(MI_FLUSH_DW::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD, miFlushDwCmd->getPostSyncOperation());
+    EXPECT_EQ(0x1230u, miFlushDwCmd->getDestinationAddress());
+    EXPECT_EQ(0x55u, miFlushDwCmd->getImmediateData());
+}
+
+HWTEST_F(BlitCommandsHelperTest, givenDependenciesWhenBlitBufferIsCalledThenSemaphoresBlitAndPostSyncWritesAreProgrammed) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+    using MI_BATCH_BUFFER_END = typename FamilyType::MI_BATCH_BUFFER_END;
+
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.storeMakeResidentAllocations = true;
+
+    TimestampPacketContainer dependency;
+    dependency.add(csr.getTimestampPacketAllocator()->getTag());
+    TimestampPacketContainer output;
+    output.add(csr.getTimestampPacketAllocator()->getTag());
+
+    char srcMemory[64] = {};
+    char dstMemory[64] = {};
+    MockGraphicsAllocation srcAllocation(srcMemory, sizeof(srcMemory));
+    MockGraphicsAllocation dstAllocation(dstMemory, sizeof(dstMemory));
+
+    BlitProperties blitProperties;
+    blitProperties.srcAllocation = &srcAllocation;
+    blitProperties.dstAllocation = &dstAllocation;
+    blitProperties.srcGpuAddress = srcAllocation.getGpuAddress();
+    blitProperties.dstGpuAddress = dstAllocation.getGpuAddress();
+    blitProperties.copySize = sizeof(srcMemory);
+    blitProperties.outputTimestampPacket = &output;
+    blitProperties.timestampPacketDependencies.push_back(&dependency);
+
+    auto initialTaskCount = csr.peekTaskCount();
+    auto newTaskCount = csr.blitBuffer(blitProperties);
+    EXPECT_EQ(initialTaskCount + 1, newTaskCount);
+    EXPECT_EQ(newTaskCount, csr.peekTaskCount());
+    EXPECT_EQ(newTaskCount, csr.peekLatestFlushedTaskCount());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream);
+    auto &cmdList = hwParser.cmdList;
+
+    auto itor = find<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itor);
+    auto dependencyAddress = dependency.peekNodes()[0]->tag->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd);
+    EXPECT_EQ(dependencyAddress, genCmdCast<MI_SEMAPHORE_WAIT *>(*itor)->getSemaphoreGraphicsAddress());
+
+    itor = find<XY_SRC_COPY_BLT *>(itor, cmdList.end());
+    ASSERT_NE(cmdList.end(), itor);
+
+    itor = find<MI_FLUSH_DW *>(itor, cmdList.end());
+    ASSERT_NE(cmdList.end(), itor);
+    auto miFlushDwCmd = genCmdCast<MI_FLUSH_DW *>(*itor);
+    auto outputAddress = output.peekNodes()[0]->tag->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd);
+    EXPECT_EQ(outputAddress, miFlushDwCmd->getDestinationAddress());
+    EXPECT_EQ(0u, miFlushDwCmd->getImmediateData());
+
+    itor = find<MI_FLUSH_DW *>(++itor, cmdList.end());
+    ASSERT_NE(cmdList.end(), itor);
+    miFlushDwCmd = genCmdCast<MI_FLUSH_DW *>(*itor);
+    EXPECT_EQ(csr.getTagAllocation()->getGpuAddress(), miFlushDwCmd->getDestinationAddress());
+    EXPECT_EQ(newTaskCount, miFlushDwCmd->getImmediateData());
+
+    itor = find<MI_BATCH_BUFFER_END *>(itor, cmdList.end());
+    EXPECT_NE(cmdList.end(), itor);
+
+    EXPECT_TRUE(csr.isMadeResident(&srcAllocation));
+    EXPECT_TRUE(csr.isMadeResident(&dstAllocation));
+    EXPECT_TRUE(csr.isMadeResident(csr.getTagAllocation()));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/cross_thread_data_tracker.h"
+#include "runtime/indirect_heap/indirect_heap.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace OCLRT;
+
+struct CrossThreadDataTrackerTest : public ::testing::Test {
+    void SetUp() override {
+        memset(heapMemory, 0, sizeof(heapMemory));
+        for (uint32_t i = 0; i < crossThreadDataDwords; i++) {
+            crossThreadData[i] = i;
+        }
+        layout = {16, 3, {{64, 1, 1}}, true};
+    }
+
+    // emulates full copy done by sendIndirectState
+    CrossThreadDataTracker::IndirectDataCopy copyToHeap(IndirectHeap &ioh, uint32_t taskCount) {
+        CrossThreadDataTracker::IndirectDataCopy copy;
+        copy.layout = layout;
+        copy.heapBufferId = ioh.getBufferId();
+        copy.heapOffset = ioh.getUsed();
+        copy.sizePerThreadData = 32;
+        copy.sizePerThreadDataTotal = 128;
+        memcpy(ioh.getSpace(sizeof(crossThreadData)), crossThreadData, sizeof(crossThreadData));
+        tracker.storeIndirectData(copy, crossThreadData, sizeof(crossThreadData), &tagAddress, taskCount);
+        return copy;
+    }
+
+    bool reuse(IndirectHeap &ioh, uint32_t taskCount, CrossThreadDataTracker::IndirectDataCopy &copy) {
+        copy.layout = layout;
+        return tracker.reuseIndirectData(ioh, crossThreadData, sizeof(crossThreadData), &tagAddress, taskCount, copy);
+    }
+
+    static constexpr uint32_t crossThreadDataDwords = 64;
+    uint32_t crossThreadData[crossThreadDataDwords];
+    uint32_t heapMemory[1024];
+    volatile uint32_t tagAddress = 0;
+    CrossThreadDataTracker::PerThreadDataLayout layout;
+    CrossThreadDataTracker tracker;
+};
+
+constexpr uint32_t CrossThreadDataTrackerTest::crossThreadDataDwords;
+
+TEST_F(CrossThreadDataTrackerTest, givenChangedDwordsWhenDirtyDwordsArePatchedThenOnlyChangedRangesAreCopied) {
+    uint32_t destination[8] = {};
+    uint32_t shadow[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t source[8] = {0, 10, 11, 3, 4, 5, 6, 17};
+
+    EXPECT_EQ(3u, CrossThreadDataTracker::patchDirtyDwords(destination, shadow, source, sizeof(source)));
+
+    uint32_t expectedDestination[8] = {0, 10, 11, 0, 0, 0, 0, 17};
+    EXPECT_EQ(0, memcmp(expectedDestination, destination, sizeof(destination)));
+    EXPECT_EQ(0, memcmp(source, shadow, sizeof(shadow)));
+    EXPECT_EQ(0u, CrossThreadDataTracker::patchDirtyDwords(destination, shadow, source, sizeof(source)));
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenNoPreviousCopyWhenIndirectDataIsReusedThenFalseIsReturned) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    EXPECT_FALSE(reuse(ioh, 1, copy));
+    EXPECT_EQ(0u, tracker.peekReusedCount());
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenUnchangedDataWhenIndirectDataIsReusedThenPreviousCopyIsReturnedEvenIfNotCompleted) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    ioh.getSpace(64);
+    auto storedCopy = copyToHeap(ioh, 1);
+
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    EXPECT_TRUE(reuse(ioh, 2, copy));
+    EXPECT_EQ(storedCopy.heapOffset, copy.heapOffset);
+    EXPECT_EQ(storedCopy.sizePerThreadData, copy.sizePerThreadData);
+    EXPECT_EQ(storedCopy.sizePerThreadDataTotal, copy.sizePerThreadDataTotal);
+    EXPECT_EQ(1u, tracker.peekReusedCount());
+    EXPECT_EQ(0u, tracker.peekPatchedDwordsCount());
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenChangedDataAndCompletedCopyWhenIndirectDataIsReusedThenDirtyDwordsArePatchedInPlace) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    auto storedCopy = copyToHeap(ioh, 1);
+    auto usedBefore = ioh.getUsed();
+
+    tagAddress = 1;
+    crossThreadData[5] = 0xabcd;
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    EXPECT_TRUE(reuse(ioh, 2, copy));
+    EXPECT_EQ(storedCopy.heapOffset, copy.heapOffset);
+    EXPECT_EQ(usedBefore, ioh.getUsed());
+    EXPECT_EQ(1u, tracker.peekPatchedDwordsCount());
+    EXPECT_EQ(0, memcmp(ptrOffset(ioh.getCpuBase(), copy.heapOffset), crossThreadData, sizeof(crossThreadData)));
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenChangedDataAndCopyStillInUseWhenIndirectDataIsReusedThenFalseIsReturned) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    auto storedCopy = copyToHeap(ioh, 1);
+
+    crossThreadData[5] = 0xabcd;
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    EXPECT_FALSE(reuse(ioh, 2, copy));
+    EXPECT_EQ(5u, reinterpret_cast<uint32_t *>(ptrOffset(ioh.getCpuBase(), storedCopy.heapOffset))[5]);
+
+    // once reused by task 2 the copy has to be retired by task 2 before patching
+    crossThreadData[5] = 5;
+    EXPECT_TRUE(reuse(ioh, 2, copy));
+    tagAddress = 1;
+    crossThreadData[5] = 0xabcd;
+    EXPECT_FALSE(reuse(ioh, 3, copy));
+    tagAddress = 2;
+    EXPECT_TRUE(reuse(ioh, 3, copy));
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenReplacedHeapBufferWhenIndirectDataIsReusedThenFalseIsReturned) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    copyToHeap(ioh, 1);
+
+    auto bufferId = ioh.getBufferId();
+    ioh.replaceBuffer(heapMemory, sizeof(heapMemory));
+    EXPECT_NE(bufferId, ioh.getBufferId());
+
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    EXPECT_FALSE(reuse(ioh, 2, copy));
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenDifferentPerThreadDataLayoutWhenIndirectDataIsReusedThenFalseIsReturned) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    copyToHeap(ioh, 1);
+
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    layout.localWorkSize[0] = 32;
+    EXPECT_FALSE(reuse(ioh, 2, copy));
+    layout.localWorkSize[0] = 64;
+    layout.simd = 8;
+    EXPECT_FALSE(reuse(ioh, 2, copy));
+    layout.simd = 16;
+    EXPECT_TRUE(reuse(ioh, 2, copy));
+}
+
+TEST_F(CrossThreadDataTrackerTest, givenDifferentCompletionTagWhenIndirectDataIsReusedThenFalseIsReturned) {
+    IndirectHeap ioh(heapMemory, sizeof(heapMemory));
+    copyToHeap(ioh, 1);
+
+    volatile uint32_t otherTagAddress = 0;
+    CrossThreadDataTracker::IndirectDataCopy copy;
+    copy.layout = layout;
+    EXPECT_FALSE(tracker.reuseIndirectData(ioh, crossThreadData, sizeof(crossThreadData), &otherTagAddress, 2, copy));
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/local_ids_cache.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+
+using namespace OCLRT;
+
+struct LocalIdsCacheTest : public ::testing::Test {
+    size_t getLocalIdsSize(uint16_t simd, const std::array<uint16_t, 3> &lws) {
+        return getThreadsPerWG(simd, lws[0] * lws[1] * lws[2]) * getPerThreadSizeLocalIDs(simd);
+    }
+
+    void expectLocalIds(uint16_t simd, const std::array<uint16_t, 3> &lws, bool isImageOnlyKernel) {
+        auto size = getLocalIdsSize(simd, lws);
+        auto cached = static_cast<uint8_t *>(alignedMalloc(size, 32));
+        auto reference = static_cast<uint8_t *>(alignedMalloc(size, 32));
+        memset(cached, 0xff, size);
+        memset(reference, 0xff, size);
+
+        cache.setLocalIds(cached, size, simd, lws, dimensionsOrder, isImageOnlyKernel);
+        generateLocalIDs(reference, simd, lws, dimensionsOrder, isImageOnlyKernel);
+        EXPECT_EQ(0, memcmp(cached, reference, size));
+
+        alignedFree(cached);
+        alignedFree(reference);
+    }
+
+    LocalIdsCache cache;
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+};
+
+TEST_F(LocalIdsCacheTest, givenEmptyCacheWhenLocalIdsAreSetThenTheyAreGeneratedAndCached) {
+    expectLocalIds(16, {{64, 1, 1}}, false);
+    EXPECT_EQ(1u, cache.peekEntriesCount());
+    EXPECT_EQ(0u, cache.peekHitsCount());
+}
+
+TEST_F(LocalIdsCacheTest, givenCachedGeometryWhenLocalIdsAreSetAgainThenCachedLocalIdsAreCopied) {
+    expectLocalIds(8, {{4, 4, 2}}, false);
+    expectLocalIds(8, {{4, 4, 2}}, false);
+    EXPECT_EQ(1u, cache.peekEntriesCount());
+    EXPECT_EQ(1u, cache.peekHitsCount());
+}
+
+TEST_F(LocalIdsCacheTest, givenDifferentSimdOrImagesLayoutWhenLocalIdsAreSetThenSeparateEntriesAreUsed) {
+    expectLocalIds(16, {{16, 4, 1}}, false);
+    expectLocalIds(32, {{16, 4, 1}}, false);
+    expectLocalIds(16, {{16, 4, 1}}, true);
+    EXPECT_EQ(3u, cache.peekEntriesCount());
+    EXPECT_EQ(0u, cache.peekHitsCount());
+}
+
+TEST_F(LocalIdsCacheTest, givenFullCacheWhenNewGeometryIsSetThenLeastRecentlyUsedEntryIsReplaced) {
+    for (uint16_t i = 1; i <= LocalIdsCache::maxEntriesCount; i++) {
+        expectLocalIds(8, {{static_cast<uint16_t>(8 * i), 1, 1}}, false);
+    }
+    expectLocalIds(8, {{8, 1, 1}}, false);
+    EXPECT_EQ(1u, cache.peekHitsCount());
+
+    expectLocalIds(8, {{128, 1, 1}}, false);
+    EXPECT_EQ(LocalIdsCache::maxEntriesCount, cache.peekEntriesCount());
+
+    expectLocalIds(8, {{8, 1, 1}}, false);
+    EXPECT_EQ(2u, cache.peekHitsCount());
+    expectLocalIds(8, {{16, 1, 1}}, false);
+    EXPECT_EQ(2u, cache.peekHitsCount());
+}
+
+TEST_F(LocalIdsCacheTest, givenLocalIdsLargerThanMaxEntrySizeWhenLocalIdsAreSetThenTheyAreNotCached) {
+    std::array<uint16_t, 3> lws = {{512, 4, 1}};
+    ASSERT_GT(getLocalIdsSize(8, lws), LocalIdsCache::maxEntrySize);
+    expectLocalIds(8, lws, false);
+    EXPECT_EQ(0u, cache.peekEntriesCount());
+}
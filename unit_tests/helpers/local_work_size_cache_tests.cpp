@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/local_work_size_cache.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+struct LocalWorkSizeCacheTest : public ::testing::Test {
+    LocalWorkSizeCache::Key createKey(size_t gwsX) {
+        LocalWorkSizeCache::Key key;
+        key.gws = {{gwsX, 1, 1}};
+        key.workDim = 1;
+        key.simd = 32;
+        key.maxWorkGroupSize = 256;
+        return key;
+    }
+
+    LocalWorkSizeCache cache;
+    Vec3<size_t> lws = {0, 0, 0};
+};
+
+TEST_F(LocalWorkSizeCacheTest, givenEmptyCacheWhenLocalWorkSizeIsQueriedThenItIsNotFound) {
+    EXPECT_FALSE(cache.findLocalWorkSize(createKey(1024), lws));
+    EXPECT_EQ(0u, cache.peekHitsCount());
+}
+
+TEST_F(LocalWorkSizeCacheTest, givenStoredLocalWorkSizeWhenSameKeyIsQueriedThenItIsReturned) {
+    cache.storeLocalWorkSize(createKey(1024), {256, 1, 1});
+    EXPECT_EQ(1u, cache.peekEntriesCount());
+
+    EXPECT_TRUE(cache.findLocalWorkSize(createKey(1024), lws));
+    EXPECT_EQ(Vec3<size_t>(256, 1, 1), lws);
+    EXPECT_EQ(1u, cache.peekHitsCount());
+}
+
+TEST_F(LocalWorkSizeCacheTest, givenStoredLocalWorkSizeWhenKeyDiffersInAnyConstraintThenItIsNotFound) {
+    auto key = createKey(1024);
+    cache.storeLocalWorkSize(key, {256, 1, 1});
+
+    auto otherKey = key;
+    otherKey.slmTotalSize = 1024;
+    EXPECT_FALSE(cache.findLocalWorkSize(otherKey, lws));
+
+    otherKey = key;
+    otherKey.hasBarriers = true;
+    EXPECT_FALSE(cache.findLocalWorkSize(otherKey, lws));
+
+    otherKey = key;
+    otherKey.simd = 16;
+    EXPECT_FALSE(cache.findLocalWorkSize(otherKey, lws));
+
+    otherKey = key;
+    otherKey.computeWorkSizeND = true;
+    EXPECT_FALSE(cache.findLocalWorkSize(otherKey, lws));
+    EXPECT_EQ(0u, cache.peekHitsCount());
+}
+
+TEST_F(LocalWorkSizeCacheTest, givenFullCacheWhenNewLocalWorkSizeIsStoredThenLeastRecentlyUsedEntryIsReplaced) {
+    for (size_t i = 0; i < LocalWorkSizeCache::maxEntriesCount; i++) {
+        cache.storeLocalWorkSize(createKey(i + 1), {i + 1, 1, 1});
+    }
+    EXPECT_TRUE(cache.findLocalWorkSize(createKey(1), lws));
+
+    cache.storeLocalWorkSize(createKey(1000), {8, 1, 1});
+    EXPECT_EQ(LocalWorkSizeCache::maxEntriesCount, cache.peekEntriesCount());
+    EXPECT_TRUE(cache.findLocalWorkSize(createKey(1), lws));
+    EXPECT_TRUE(cache.findLocalWorkSize(createKey(1000), lws));
+    EXPECT_FALSE(cache.findLocalWorkSize(createKey(2), lws));
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/file_io.h"
+#include "runtime/helpers/local_work_size_tuner.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+using namespace OCLRT;
+
+struct LocalWorkSizeTunerTest : public ::testing::Test {
+    LocalWorkSizeTuner::Key createKey(size_t gwsX, size_t gwsY = 1) {
+        LocalWorkSizeTuner::Key key;
+        key.gws = {{gwsX, gwsY, 1}};
+        key.workDim = gwsY > 1 ? 2 : 1;
+        key.simd = 16;
+        key.maxWorkGroupSize = 256;
+        return key;
+    }
+
+    void measureAllCandidates(LocalWorkSizeTuner &tuner, const LocalWorkSizeTuner::Key &key, const Vec3<size_t> &defaultLws, const Vec3<size_t> &fastestLws) {
+        bool trialRequired = true;
+        while (true) {
+            auto lws = tuner.selectLocalWorkSize(key, defaultLws, trialRequired);
+            if (!trialRequired) {
+                break;
+            }
+            tuner.addMeasurement(key, lws, lws == fastestLws ? 100 : 200);
+        }
+    }
+};
+
+TEST_F(LocalWorkSizeTunerTest, given1DShapeWhenCandidatesAreGeneratedThenDefaultIsFirstAndAllDivideGlobalSize) {
+    auto candidates = LocalWorkSizeTuner::generateCandidates(createKey(1024), {128, 1, 1});
+    ASSERT_EQ(5u, candidates.size());
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), candidates[0]);
+    EXPECT_EQ(Vec3<size_t>(256, 1, 1), candidates[1]);
+    EXPECT_EQ(Vec3<size_t>(16, 1, 1), candidates[4]);
+}
+
+TEST_F(LocalWorkSizeTunerTest, given2DShapeWhenCandidatesAreGeneratedThenTheyFitWithinMaxWorkGroupSizeAndDivideGlobalSize) {
+    auto key = createKey(64, 48);
+    auto candidates = LocalWorkSizeTuner::generateCandidates(key, {16, 16, 1});
+    EXPECT_LT(1u, candidates.size());
+    EXPECT_GE(LocalWorkSizeTuner::maxCandidatesCount, candidates.size());
+    for (auto &lws : candidates) {
+        auto groupSize = lws.x * lws.y * lws.z;
+        EXPECT_LE(groupSize, key.maxWorkGroupSize);
+        EXPECT_GE(groupSize, key.simd);
+        EXPECT_EQ(0u, key.gws[0] % lws.x);
+        EXPECT_EQ(0u, key.gws[1] % lws.y);
+        EXPECT_EQ(1u, lws.z);
+    }
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenGlobalSizeWithoutPowerOfTwoDivisorsWhenLocalWorkSizeIsSelectedThenDefaultIsUsedWithoutTrials) {
+    LocalWorkSizeTuner tuner("");
+    bool trialRequired = true;
+    EXPECT_EQ(Vec3<size_t>(7, 1, 1), tuner.selectLocalWorkSize(createKey(7), {7, 1, 1}, trialRequired));
+    EXPECT_FALSE(trialRequired);
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(tuner.findTunedLocalWorkSize(createKey(7), lws));
+    EXPECT_EQ(Vec3<size_t>(7, 1, 1), lws);
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenNewShapeWhenLocalWorkSizeIsSelectedRepeatedlyThenEachCandidateIsTriedUntilAllTrialsAreInFlight) {
+    LocalWorkSizeTuner tuner("");
+    auto key = createKey(1024);
+    auto candidates = LocalWorkSizeTuner::generateCandidates(key, {128, 1, 1});
+    bool trialRequired = false;
+
+    for (auto &candidate : candidates) {
+        for (uint32_t i = 0; i < LocalWorkSizeTuner::measurementsPerCandidate; i++) {
+            EXPECT_EQ(candidate, tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+            EXPECT_TRUE(trialRequired);
+        }
+    }
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+    EXPECT_FALSE(trialRequired);
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_FALSE(tuner.findTunedLocalWorkSize(key, lws));
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenCancelledTrialWhenLocalWorkSizeIsSelectedAgainThenSameCandidateIsTried) {
+    LocalWorkSizeTuner tuner("");
+    auto key = createKey(1024);
+    auto candidates = LocalWorkSizeTuner::generateCandidates(key, {128, 1, 1});
+    bool trialRequired = false;
+
+    for (uint32_t i = 0; i < LocalWorkSizeTuner::measurementsPerCandidate; i++) {
+        EXPECT_EQ(candidates[0], tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+    }
+    tuner.cancelTrial(key, candidates[0]);
+    EXPECT_EQ(candidates[0], tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+    EXPECT_TRUE(trialRequired);
+    EXPECT_EQ(candidates[1], tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+    EXPECT_TRUE(trialRequired);
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenAllCandidatesMeasuredWhenLocalWorkSizeIsSelectedThenFastestIsLockedIn) {
+    LocalWorkSizeTuner tuner("");
+    auto key = createKey(1024);
+    measureAllCandidates(tuner, key, {128, 1, 1}, {64, 1, 1});
+
+    bool trialRequired = true;
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), tuner.selectLocalWorkSize(key, {128, 1, 1}, trialRequired));
+    EXPECT_FALSE(trialRequired);
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(tuner.findTunedLocalWorkSize(key, lws));
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), lws);
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenEqualDurationsWhenCandidatesAreMeasuredThenDefaultIsLockedIn) {
+    LocalWorkSizeTuner tuner("");
+    auto key = createKey(1024);
+    measureAllCandidates(tuner, key, {128, 1, 1}, {0, 0, 0});
+
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(tuner.findTunedLocalWorkSize(key, lws));
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), lws);
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenTunedShapesWhenProfileIsSavedThenNewTunerLoadsThem) {
+    std::string profilePath("local_work_size_tuner_test.lws_profile");
+    std::remove(profilePath.c_str());
+    {
+        LocalWorkSizeTuner tuner(profilePath);
+        measureAllCandidates(tuner, createKey(1024), {128, 1, 1}, {32, 1, 1});
+        measureAllCandidates(tuner, createKey(64, 64), {16, 16, 1}, {64, 4, 1});
+        EXPECT_FALSE(fileExists(profilePath));
+    }
+    EXPECT_TRUE(fileExistsHasSize(profilePath));
+
+    LocalWorkSizeTuner tuner(profilePath);
+    EXPECT_EQ(2u, tuner.peekEntriesCount());
+    Vec3<size_t> lws = {0, 0, 0};
+    EXPECT_TRUE(tuner.findTunedLocalWorkSize(createKey(1024), lws));
+    EXPECT_EQ(Vec3<size_t>(32, 1, 1), lws);
+    EXPECT_TRUE(tuner.findTunedLocalWorkSize(createKey(64, 64), lws));
+    EXPECT_EQ(Vec3<size_t>(64, 4, 1), lws);
+    EXPECT_FALSE(tuner.findTunedLocalWorkSize(createKey(2048), lws));
+    std::remove(profilePath.c_str());
+}
+
+TEST_F(LocalWorkSizeTunerTest, givenMalformedProfileWhenTunerIsCreatedThenProfileIsIgnored) {
+    std::string profilePath("local_work_size_tuner_malformed.lws_profile");
+    const char profile[] = "not a profile\n1024 1 1 1 16 256 0 0 0 0 32 1 1\n";
+    writeDataToFile(profilePath.c_str(), profile, sizeof(profile) - 1);
+
+    LocalWorkSizeTuner tuner(profilePath);
+    EXPECT_EQ(0u, tuner.peekEntriesCount());
+    std::remove(profilePath.c_str());
+}
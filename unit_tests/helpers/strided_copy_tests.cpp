@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/strided_copy.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "gtest/gtest.h"
+
+#include <tuple>
+#include <vector>
+
+using namespace OCLRT;
+
+struct StridedCopyTest : public ::testing::TestWithParam<std::tuple<size_t /*rowSize*/, size_t /*rows*/, size_t /*slices*/>> {
+    void verifyCopy(CpuCopyEngine *cpuCopyEngine, size_t srcRowPitch, size_t dstRowPitch) {
+        size_t rowSize, rowsCount, slicesCount;
+        std::tie(rowSize, rowsCount, slicesCount) = GetParam();
+        auto srcSlicePitch = srcRowPitch * rowsCount + 8;
+        auto dstSlicePitch = dstRowPitch * rowsCount;
+
+        std::vector<uint8_t> source(srcSlicePitch * slicesCount);
+        for (size_t i = 0; i < source.size(); i++) {
+            source[i] = static_cast<uint8_t>(i * 13 + 1);
+        }
+        std::vector<uint8_t> destination(dstSlicePitch * slicesCount, 0);
+
+        copyStrided(destination.data(), dstRowPitch, dstSlicePitch, source.data(), srcRowPitch, srcSlicePitch,
+                    rowSize, rowsCount, slicesCount, cpuCopyEngine);
+
+        for (size_t slice = 0; slice < slicesCount; slice++) {
+            for (size_t row = 0; row < rowsCount; row++) {
+                auto dstRow = &destination[slice * dstSlicePitch + row * dstRowPitch];
+                auto srcRow = &source[slice * srcSlicePitch + row * srcRowPitch];
+                ASSERT_EQ(0, memcmp(dstRow, srcRow, rowSize)) << "slice " << slice << " row " << row;
+                for (size_t padding = rowSize; padding < dstRowPitch; padding++) {
+                    ASSERT_EQ(0u, dstRow[padding]);
+                }
+            }
+        }
+    }
+};
+
+TEST_P(StridedCopyTest, givenPaddedRowsWhenCopiedThenOnlyRowDataIsCopied) {
+    auto rowSize = std::get<0>(GetParam());
+    verifyCopy(nullptr, rowSize + 3, rowSize + 5);
+}
+
+TEST_P(StridedCopyTest, givenPackedDestinationRowsWhenCopiedThenAllRowsAreCopied) {
+    auto rowSize = std::get<0>(GetParam());
+    verifyCopy(nullptr, rowSize + 16, rowSize);
+}
+
+TEST_P(StridedCopyTest, givenCpuCopyEngineWhenCopiedThenResultMatches) {
+    CpuCopyEngine cpuCopyEngine(3, CpuCopyEngine::defaultNonTemporalThreshold);
+    auto rowSize = std::get<0>(GetParam());
+    verifyCopy(&cpuCopyEngine, rowSize + 3, rowSize);
+}
+
+INSTANTIATE_TEST_CASE_P(StridedCopyTests,
+                        StridedCopyTest,
+                        ::testing::Values(std::make_tuple(1u, 7u, 3u),
+                                          std::make_tuple(4u, 33u, 2u),
+                                          std::make_tuple(16u, 5u, 1u),
+                                          std::make_tuple(13u, 9u, 4u),
+                                          std::make_tuple(4096u, 300u, 1u),
+                                          std::make_tuple(1024u, 256u, 9u),
+                                          std::make_tuple(8192u, 512u, 1u)));
+
+TEST(StridedCopy, givenContiguousRowsAndSlicesWhenCopiedThenWholeVolumeIsCopied) {
+    std::vector<uint8_t> source(4 * 8 * 3);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> destination(source.size(), 0);
+    copyStrided(destination.data(), 4, 32, source.data(), 4, 32, 4, 8, 3, nullptr);
+    EXPECT_EQ(source, destination);
+}
+
+TEST(StridedCopy, givenEmptyRegionWhenCopiedThenNothingIsCopied) {
+    uint8_t source[4] = {1, 2, 3, 4};
+    uint8_t destination[4] = {};
+    copyStrided(destination, 4, 4, source, 4, 4, 0, 1, 1, nullptr);
+    copyStrided(destination, 4, 4, source, 4, 4, 4, 0, 1, nullptr);
+    copyStrided(destination, 4, 4, source, 4, 4, 4, 1, 0, nullptr);
+    EXPECT_EQ(0u, destination[0]);
+}
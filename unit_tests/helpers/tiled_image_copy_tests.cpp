@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/tiled_image_copy.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(TileYOffsetTest, givenBytesWithinFirstTileWhenOffsetIsCalculatedThenColumnMajorLayoutOf16ByteColumnsIsUsed) {
+    size_t rowPitch = 2 * tileYWidthInBytes;
+    EXPECT_EQ(0u, getTileYOffset(0, 0, rowPitch));
+    EXPECT_EQ(15u, getTileYOffset(15, 0, rowPitch));
+    EXPECT_EQ(16u, getTileYOffset(0, 1, rowPitch));
+    EXPECT_EQ(31u * 16u, getTileYOffset(0, 31, rowPitch));
+    EXPECT_EQ(512u, getTileYOffset(16, 0, rowPitch));
+    EXPECT_EQ(7u * 512u + 31u * 16u + 15u, getTileYOffset(127, 31, rowPitch));
+}
+
+TEST(TileYOffsetTest, givenBytesOutsideFirstTileWhenOffsetIsCalculatedThenTilesAreLaidOutInRowMajorOrder) {
+    size_t rowPitch = 3 * tileYWidthInBytes;
+    EXPECT_EQ(tileYSize, getTileYOffset(128, 0, rowPitch));
+    EXPECT_EQ(2 * tileYSize + 5, getTileYOffset(261, 0, rowPitch));
+    EXPECT_EQ(3 * tileYSize, getTileYOffset(0, 32, rowPitch));
+    EXPECT_EQ(4 * tileYSize + 512u + 16u, getTileYOffset(144, 33, rowPitch));
+}
+
+struct TiledImageCopyTest : public ::testing::Test {
+    void SetUp() override {
+        tiled.resize(tiledRowPitch * qPitch * slicesCount);
+        for (size_t slice = 0; slice < slicesCount; slice++) {
+            for (size_t y = 0; y < qPitch; y++) {
+                for (size_t x = 0; x < tiledRowPitch; x++) {
+                    tiled[slice * qPitch * tiledRowPitch + getTileYOffset(x, y, tiledRowPitch)] = getPattern(x, slice * qPitch + y);
+                }
+            }
+        }
+    }
+
+    static uint8_t getPattern(size_t x, size_t y) {
+        return static_cast<uint8_t>(x * 7 + y * 13 + (x >> 8));
+    }
+
+    static constexpr size_t tiledRowPitch = 3 * tileYWidthInBytes;
+    static constexpr size_t qPitch = 2 * tileYHeight;
+    static constexpr size_t slicesCount = 3;
+    std::vector<uint8_t> tiled;
+};
+
+constexpr size_t TiledImageCopyTest::tiledRowPitch;
+constexpr size_t TiledImageCopyTest::qPitch;
+constexpr size_t TiledImageCopyTest::slicesCount;
+
+TEST_F(TiledImageCopyTest, givenUnalignedRegionWhenCopiedFromTileYThenLinearDataMatchesSurface) {
+    std::array<size_t, 3> origin = {{13, 29, 1}};
+    std::array<size_t, 3> region = {{150, 9, 2}};
+    size_t rowPitch = 160;
+    size_t slicePitch = rowPitch * 10;
+    std::vector<uint8_t> linear(slicePitch * region[2], 0xcd);
+
+    copyFromTileY(linear.data(), rowPitch, slicePitch, tiled.data(), tiledRowPitch, qPitch, origin, region);
+
+    for (size_t slice = 0; slice < region[2]; slice++) {
+        for (size_t y = 0; y < region[1]; y++) {
+            for (size_t x = 0; x < region[0]; x++) {
+                auto expected = getPattern(origin[0] + x, (origin[2] + slice) * qPitch + origin[1] + y);
+                ASSERT_EQ(expected, linear[slice * slicePitch + y * rowPitch + x]) << x << " " << y << " " << slice;
+            }
+            for (size_t x = region[0]; x < rowPitch; x++) {
+                ASSERT_EQ(0xcd, linear[slice * slicePitch + y * rowPitch + x]);
+            }
+        }
+    }
+}
+
+TEST_F(TiledImageCopyTest, givenUnalignedRegionWhenCopiedToTileYThenOnlyRegionIsModified) {
+    std::array<size_t, 3> origin = {{5, 30, 0}};
+    std::array<size_t, 3> region = {{200, 4, 2}};
+    size_t rowPitch = region[0];
+    size_t slicePitch = rowPitch * region[1];
+    std::vector<uint8_t> linear(slicePitch * region[2]);
+    for (size_t i = 0; i < linear.size(); i++) {
+        linear[i] = static_cast<uint8_t>(i * 3 + 1);
+    }
+    auto expectedTiled = tiled;
+    for (size_t slice = 0; slice < region[2]; slice++) {
+        for (size_t y = 0; y < region[1]; y++) {
+            for (size_t x = 0; x < region[0]; x++) {
+                auto tiledRow = (origin[2] + slice) * qPitch + origin[1] + y;
+                expectedTiled[getTileYOffset(origin[0] + x, tiledRow, tiledRowPitch)] = linear[slice * slicePitch + y * rowPitch + x];
+            }
+        }
+    }
+
+    copyToTileY(tiled.data(), tiledRowPitch, qPitch, linear.data(), rowPitch, slicePitch, origin, region);
+
+    EXPECT_EQ(expectedTiled, tiled);
+}
+
+TEST_F(TiledImageCopyTest, givenDataWrittenToTileYWhenReadBackThenItIsUnchanged) {
+    std::array<size_t, 3> origin = {{16, 0, 2}};
+    std::array<size_t, 3> region = {{tiledRowPitch - 16, qPitch, 1}};
+    std::vector<uint8_t> source(region[0] * region[1]);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = static_cast<uint8_t>(i ^ (i >> 7));
+    }
+    std::vector<uint8_t> destination(source.size(), 0);
+
+    copyToTileY(tiled.data(), tiledRowPitch, qPitch, source.data(), region[0], source.size(), origin, region);
+    copyFromTileY(destination.data(), region[0], destination.size(), tiled.data(), tiledRowPitch, qPitch, origin, region);
+
+    EXPECT_EQ(source, destination);
+}
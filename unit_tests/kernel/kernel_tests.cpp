@@ -542,6 +542,8 @@ class CommandStreamReceiverMock : public CommandStreamReceiver {
 
     void flushBatchedSubmissions() override {}
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties) override { return taskCount; }
+
     CommandStreamReceiverType getType() override {
         return CommandStreamReceiverType::CSR_HW;
     }
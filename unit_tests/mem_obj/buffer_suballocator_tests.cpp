@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/mem_obj/buffer.h"
+#include "runtime/mem_obj/buffer_suballocator.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/os_interface/os_context.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+
+#include "test.h"
+
+#include <memory>
+
+using namespace OCLRT;
+
+struct BufferSuballocatorTest : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableBufferSuballocation.set(true);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        context = std::make_unique<MockContext>(device.get());
+    }
+
+    Buffer *createBuffer(size_t size, cl_mem_flags flags = CL_MEM_READ_WRITE, void *hostPtr = nullptr) {
+        cl_int retVal = CL_SUCCESS;
+        auto buffer = Buffer::create(context.get(), flags, size, hostPtr, retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        return buffer;
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockContext> context;
+};
+
+TEST_F(BufferSuballocatorTest, givenSuballocationDisabledWhenAskedIfSuballocationIsAllowedThenReturnFalse) {
+    DebugManager.flags.EnableBufferSuballocation.set(false);
+    MemoryProperties properties;
+    properties.flags = CL_MEM_READ_WRITE;
+    EXPECT_FALSE(BufferSuballocator::isSuballocationAllowed(properties, MemoryConstants::pageSize, false));
+}
+
+TEST_F(BufferSuballocatorTest, givenPropertiesRequiringOwnAllocationWhenAskedIfSuballocationIsAllowedThenReturnFalse) {
+    MemoryProperties properties;
+    properties.flags = CL_MEM_READ_WRITE;
+    EXPECT_TRUE(BufferSuballocator::isSuballocationAllowed(properties, BufferSuballocator::maxSuballocationSize, false));
+    EXPECT_FALSE(BufferSuballocator::isSuballocationAllowed(properties, BufferSuballocator::maxSuballocationSize + 1, false));
+    EXPECT_FALSE(BufferSuballocator::isSuballocationAllowed(properties, MemoryConstants::pageSize, true));
+
+    properties.flags = CL_MEM_USE_HOST_PTR;
+    EXPECT_FALSE(BufferSuballocator::isSuballocationAllowed(properties, MemoryConstants::pageSize, false));
+
+    properties.flags = CL_MEM_READ_WRITE;
+    properties.flags_intel = CL_MEM_LOCALLY_UNCACHED_RESOURCE;
+    EXPECT_FALSE(BufferSuballocator::isSuballocationAllowed(properties, MemoryConstants::pageSize, false));
+}
+
+TEST_F(BufferSuballocatorTest, givenSmallBuffersWhenCreatedThenTheyShareBackingAllocationAtAlignedDisjointRanges) {
+    std::unique_ptr<Buffer> buffer1(createBuffer(100));
+    std::unique_ptr<Buffer> buffer2(createBuffer(300));
+    ASSERT_NE(nullptr, buffer1);
+    ASSERT_NE(nullptr, buffer2);
+
+    auto &suballocator = context->getBufferSuballocator();
+    EXPECT_EQ(1u, suballocator.peekBackingAllocationsCount());
+    EXPECT_EQ(buffer1->getGraphicsAllocation(), buffer2->getGraphicsAllocation());
+    EXPECT_EQ(BufferSuballocator::backingAllocationSize, buffer1->getGraphicsAllocation()->getUnderlyingBufferSize());
+
+    EXPECT_TRUE(isAligned<BufferSuballocator::suballocationAlignment>(buffer1->getOffset()));
+    EXPECT_TRUE(isAligned<BufferSuballocator::suballocationAlignment>(buffer2->getOffset()));
+    auto begin1 = buffer1->getOffset();
+    auto begin2 = buffer2->getOffset();
+    EXPECT_TRUE(begin1 + buffer1->getSize() <= begin2 || begin2 + buffer2->getSize() <= begin1);
+
+    auto backingStorage = buffer1->getGraphicsAllocation()->getUnderlyingBuffer();
+    EXPECT_EQ(ptrOffset(backingStorage, begin1), buffer1->getCpuAddress());
+    EXPECT_EQ(ptrOffset(backingStorage, begin2), buffer2->getCpuAddress());
+}
+
+TEST_F(BufferSuballocatorTest, givenBufferLargerThanSuballocationLimitWhenCreatedThenItHasOwnAllocation) {
+    std::unique_ptr<Buffer> buffer(createBuffer(BufferSuballocator::maxSuballocationSize + MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, buffer);
+
+    EXPECT_EQ(0u, buffer->getOffset());
+    EXPECT_EQ(0u, context->getBufferSuballocator().peekBackingAllocationsCount());
+}
+
+TEST_F(BufferSuballocatorTest, givenCopyHostPtrFlagWhenSuballocatedBufferIsCreatedThenDataIsCopiedToItsRange) {
+    char hostData[64];
+    memset(hostData, 0x5a, sizeof(hostData));
+    std::unique_ptr<Buffer> placeholder(createBuffer(256));
+    std::unique_ptr<Buffer> buffer(createBuffer(sizeof(hostData), CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, hostData));
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_NE(0u, buffer->getOffset());
+
+    EXPECT_EQ(0, memcmp(hostData, ptrOffset(buffer->getGraphicsAllocation()->getUnderlyingBuffer(), buffer->getOffset()), sizeof(hostData)));
+}
+
+TEST_F(BufferSuballocatorTest, givenSuballocatedBufferWhenQueryingMemOffsetThenZeroIsReturnedAndSubBufferReportsItsOrigin) {
+    std::unique_ptr<Buffer> placeholder(createBuffer(256));
+    std::unique_ptr<Buffer> buffer(createBuffer(1024));
+    ASSERT_NE(0u, buffer->getOffset());
+
+    size_t memOffset = 1;
+    EXPECT_EQ(CL_SUCCESS, buffer->getMemObjectInfo(CL_MEM_OFFSET, sizeof(memOffset), &memOffset, nullptr));
+    EXPECT_EQ(0u, memOffset);
+
+    cl_int retVal = CL_SUCCESS;
+    cl_buffer_region region = {256, 128};
+    std::unique_ptr<Buffer> subBuffer(buffer->createSubBuffer(CL_MEM_READ_WRITE, &region, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(buffer->getOffset() + region.origin, subBuffer->getOffset());
+
+    EXPECT_EQ(CL_SUCCESS, subBuffer->getMemObjectInfo(CL_MEM_OFFSET, sizeof(memOffset), &memOffset, nullptr));
+    EXPECT_EQ(region.origin, memOffset);
+}
+
+TEST_F(BufferSuballocatorTest, givenSuballocatedBufferUsedByGpuWhenReleasedThenRangeIsReusedOnlyAfterCompletion) {
+    auto &csr = *device->getDefaultEngine().commandStreamReceiver;
+    auto contextId = device->getDefaultEngine().osContext->getContextId();
+    auto &suballocator = context->getBufferSuballocator();
+
+    std::unique_ptr<Buffer> buffer(createBuffer(1024));
+    auto backingAllocation = buffer->getGraphicsAllocation();
+    auto releasedOffset = buffer->getOffset();
+
+    *csr.getTagAddress() = 0;
+    backingAllocation->updateTaskCount(5, contextId);
+    buffer.reset();
+    EXPECT_EQ(1u, suballocator.peekPendingFreesCount());
+
+    std::unique_ptr<Buffer> bufferDuringGpuWork(createBuffer(1024));
+    EXPECT_NE(releasedOffset, bufferDuringGpuWork->getOffset());
+    EXPECT_EQ(1u, suballocator.peekPendingFreesCount());
+
+    *csr.getTagAddress() = 5;
+    std::unique_ptr<Buffer> bufferAfterGpuWork(createBuffer(1024));
+    EXPECT_EQ(0u, suballocator.peekPendingFreesCount());
+    EXPECT_EQ(releasedOffset, bufferAfterGpuWork->getOffset());
+    EXPECT_EQ(1u, suballocator.peekBackingAllocationsCount());
+}
+
+TEST_F(BufferSuballocatorTest, givenFullBackingAllocationWhenNextBufferIsCreatedThenNewBackingAllocationIsAdded) {
+    constexpr size_t bufferSize = BufferSuballocator::maxSuballocationSize;
+    constexpr size_t buffersPerBacking = BufferSuballocator::backingAllocationSize / bufferSize;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for (size_t i = 0; i < buffersPerBacking; i++) {
+        buffers.emplace_back(createBuffer(bufferSize));
+    }
+    auto &suballocator = context->getBufferSuballocator();
+    EXPECT_EQ(1u, suballocator.peekBackingAllocationsCount());
+
+    buffers.emplace_back(createBuffer(bufferSize));
+    EXPECT_EQ(2u, suballocator.peekBackingAllocationsCount());
+    EXPECT_NE(buffers[0]->getGraphicsAllocation(), buffers.back()->getGraphicsAllocation());
+}
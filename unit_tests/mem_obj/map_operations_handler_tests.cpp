@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,7 +15,12 @@ using namespace OCLRT;
 
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
+    using MapOperationsHandler::coveredSegments;
     using MapOperationsHandler::mappedPointers;
+
+    MapInfo &getLastAddedMapInfo(void *mappedPtr) {
+        return std::prev(mappedPointers.upper_bound(mappedPtr))->second;
+    }
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -73,27 +78,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -103,7 +108,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(1u, mockHandler.size());
@@ -115,11 +120,58 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.getLastAddedMapInfo(mappedPtrs[0].ptr).readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenOverlappingReadOnlyPtrsWhenRemovingThemThenWriteMappingIsRejectedUntilLastOneIsRemoved) {
+    mapFlags = CL_MAP_READ;
+    mockHandler.add((void *)0x1000, 0x100, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
+    mockHandler.add((void *)0x1080, 0x100, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
+    EXPECT_EQ(3u, mockHandler.coveredSegments.size());
+
+    MapInfo writeInfo((void *)0x1100, 0x10, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    writeInfo.readOnly = false;
+    EXPECT_TRUE(mockHandler.isOverlapping(writeInfo));
+
+    mockHandler.remove((void *)0x1000);
+    EXPECT_EQ(1u, mockHandler.coveredSegments.size());
+    EXPECT_TRUE(mockHandler.isOverlapping(writeInfo));
+
+    writeInfo.ptr = (void *)0x1000;
+    EXPECT_FALSE(mockHandler.isOverlapping(writeInfo));
+
+    mockHandler.remove((void *)0x1080);
+    EXPECT_EQ(0u, mockHandler.coveredSegments.size());
+    writeInfo.ptr = (void *)0x1100;
+    EXPECT_FALSE(mockHandler.isOverlapping(writeInfo));
+}
+
+TEST_F(MapOperationsHandlerTests, givenMultipleMappedPtrsWhenAskingForOverlapThenOnlyRangesBetweenThemAreFree) {
+    mapFlags = CL_MAP_WRITE;
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(mockHandler.add(mappedPtrs[i].ptr, 0x100, mapFlags, mappedPtrs[i].size, mappedPtrs[i].offset, 0));
+    }
+    EXPECT_EQ(3u, mockHandler.coveredSegments.size());
+
+    MapInfo requestedInfo((void *)0x1100, 0x100, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    requestedInfo.readOnly = false;
+    EXPECT_FALSE(mockHandler.isOverlapping(requestedInfo));
+
+    requestedInfo.ptrLength = 0xF00;
+    EXPECT_TRUE(mockHandler.isOverlapping(requestedInfo));
+
+    requestedInfo.ptr = (void *)0x30FF;
+    requestedInfo.ptrLength = 1;
+    EXPECT_TRUE(mockHandler.isOverlapping(requestedInfo));
+
+    mockHandler.remove(mappedPtrs[1].ptr);
+    requestedInfo.ptr = (void *)0x1100;
+    requestedInfo.ptrLength = 0x1000;
+    EXPECT_FALSE(mockHandler.isOverlapping(requestedInfo));
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -142,6 +142,33 @@ TEST(MemObj, givenMemObjWhenReleaseAllocatedPtrIsCalledTwiceThenItDoesntCrash) {
     EXPECT_EQ(nullptr, memObj.getAllocatedMapPtr());
 }
 
+TEST(MemObj, givenMemObjWhenPointerIsMappedThenMapOperationsHandlerIsCreatedOnFirstMap) {
+    struct MockMemObjWithMapHandler : public MemObj {
+        using MemObj::MemObj;
+        using MemObj::mapOperationsHandler;
+    };
+    uint8_t hostPtr[16] = {};
+    MockContext context;
+
+    MockMemObjWithMapHandler memObj(&context, CL_MEM_OBJECT_BUFFER, CL_MEM_USE_HOST_PTR,
+                                    sizeof(hostPtr), nullptr, hostPtr, nullptr, true, false, false);
+    MapInfo mapInfo;
+    EXPECT_FALSE(memObj.findMappedPtr(hostPtr, mapInfo));
+    memObj.removeMappedPtr(hostPtr);
+    EXPECT_EQ(0u, memObj.getMappedPtrsCount());
+    EXPECT_EQ(nullptr, memObj.mapOperationsHandler.load());
+
+    cl_map_flags mapFlags = CL_MAP_READ;
+    MemObjSizeArray size = {{sizeof(hostPtr), 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    EXPECT_TRUE(memObj.addMappedPtr(hostPtr, sizeof(hostPtr), mapFlags, size, offset, 0));
+    auto mapOperationsHandler = memObj.mapOperationsHandler.load();
+    EXPECT_NE(nullptr, mapOperationsHandler);
+    EXPECT_EQ(mapOperationsHandler, &memObj.getMapOperationsHandler());
+    EXPECT_EQ(1u, memObj.getMappedPtrsCount());
+    EXPECT_TRUE(memObj.findMappedPtr(hostPtr, mapInfo));
+}
+
 TEST(MemObj, givenNotReadyGraphicsAllocationWhenMemObjDestroysAllocationAsyncThenAllocationIsAddedToMemoryManagerAllocationList) {
     MockContext context;
     MockMemoryManager memoryManager(*context.getDevice(0)->getExecutionEnvironment());
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct CpuCopyEngineTest : public ::testing::Test {
+    void fillPattern(std::vector<uint8_t> &data, uint8_t seed) {
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<uint8_t>(i * 31 + seed);
+        }
+    }
+
+    ::testing::AssertionResult isFilledWithPattern(const uint8_t *data, size_t size, const uint8_t *pattern, size_t patternSize) {
+        for (size_t i = 0; i < size; i++) {
+            if (data[i] != pattern[i % patternSize]) {
+                return ::testing::AssertionFailure() << "mismatch at byte " << i;
+            }
+        }
+        return ::testing::AssertionSuccess();
+    }
+};
+
+TEST_F(CpuCopyEngineTest, givenMisalignedPointersAndSizesWhenNonTemporalCopyIsDoneThenDataMatchesSource) {
+    std::vector<uint8_t> source(1024);
+    fillPattern(source, 7);
+    for (size_t dstOffset : {0u, 1u, 15u}) {
+        for (size_t size : {0u, 3u, 16u, 63u, 64u, 65u, 1000u}) {
+            std::vector<uint8_t> destination(1024 + 16, 0);
+            CpuCopyEngine::copyNonTemporal(destination.data() + dstOffset, source.data() + 5, size);
+            EXPECT_EQ(0, memcmp(destination.data() + dstOffset, source.data() + 5, size)) << dstOffset << " " << size;
+            EXPECT_EQ(0u, destination[dstOffset + size]);
+        }
+    }
+}
+
+TEST_F(CpuCopyEngineTest, givenNoWorkersWhenLargeCopyIsDoneThenCallingThreadCopiesAllData) {
+    CpuCopyEngine cpuCopyEngine(0, CpuCopyEngine::defaultNonTemporalThreshold);
+    EXPECT_EQ(0u, cpuCopyEngine.getWorkersCount());
+
+    std::vector<uint8_t> source(4 * CpuCopyEngine::minChunkSize + 13);
+    std::vector<uint8_t> destination(source.size(), 0);
+    fillPattern(source, 1);
+    cpuCopyEngine.copy(destination.data(), source.data(), source.size());
+    EXPECT_EQ(source, destination);
+}
+
+TEST_F(CpuCopyEngineTest, givenWorkersWhenLargeCopyIsDoneThenAllChunksAreCopied) {
+    CpuCopyEngine cpuCopyEngine(3, 2 * CpuCopyEngine::minChunkSize);
+    EXPECT_EQ(3u, cpuCopyEngine.getWorkersCount());
+
+    for (size_t size : {CpuCopyEngine::minChunkSize - 1, 3 * CpuCopyEngine::minChunkSize + 5, 9 * CpuCopyEngine::minChunkSize + 1}) {
+        std::vector<uint8_t> source(size);
+        std::vector<uint8_t> destination(size + 1, 0);
+        fillPattern(source, static_cast<uint8_t>(size));
+        cpuCopyEngine.copy(destination.data() + 1, source.data(), size);
+        EXPECT_EQ(0, memcmp(destination.data() + 1, source.data(), size)) << size;
+        EXPECT_EQ(0u, destination[0]);
+    }
+}
+
+TEST_F(CpuCopyEngineTest, givenMultipleThreadsWhenTheyCopyConcurrentlyThenEachCopyIsComplete) {
+    CpuCopyEngine cpuCopyEngine(2, CpuCopyEngine::defaultNonTemporalThreshold);
+    const size_t size = 4 * CpuCopyEngine::minChunkSize;
+    std::vector<std::vector<uint8_t>> sources(4, std::vector<uint8_t>(size));
+    std::vector<std::vector<uint8_t>> destinations(4, std::vector<uint8_t>(size, 0));
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < sources.size(); i++) {
+        fillPattern(sources[i], static_cast<uint8_t>(i));
+        threads.push_back(std::thread([&, i]() {
+            cpuCopyEngine.copy(destinations[i].data(), sources[i].data(), size);
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < sources.size(); i++) {
+        EXPECT_EQ(sources[i], destinations[i]);
+    }
+}
+
+TEST_F(CpuCopyEngineTest, givenMisalignedDestinationWhenPatternIsFilledThenEachPatternSizeIsReplicatedFromFirstByte) {
+    std::vector<uint8_t> pattern(CpuCopyEngine::maxFillPatternSize);
+    fillPattern(pattern, 3);
+    for (bool nonTemporal : {false, true}) {
+        for (size_t patternSize = 1; patternSize <= CpuCopyEngine::maxFillPatternSize; patternSize *= 2) {
+            for (size_t dstOffset : {0u, 1u, 8u, 15u}) {
+                for (size_t size : {0u, 5u, 128u, 1000u, 4096u}) {
+                    size_t alignedSize = size - size % patternSize;
+                    std::vector<uint8_t> destination(4096 + 32, 0);
+                    CpuCopyEngine::fillPattern(destination.data() + dstOffset, alignedSize, pattern.data(), patternSize, nonTemporal);
+                    EXPECT_TRUE(isFilledWithPattern(destination.data() + dstOffset, alignedSize, pattern.data(), patternSize))
+                        << patternSize << " " << dstOffset << " " << alignedSize;
+                    EXPECT_EQ(0u, destination[dstOffset + alignedSize]);
+                    if (dstOffset > 0) {
+                        EXPECT_EQ(0u, destination[dstOffset - 1]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(CpuCopyEngineTest, givenWorkersWhenLargeFillIsDoneThenEachChunkStartsWithFirstPatternByte) {
+    CpuCopyEngine cpuCopyEngine(3, 2 * CpuCopyEngine::minChunkSize);
+    std::vector<uint8_t> pattern(CpuCopyEngine::maxFillPatternSize);
+    fillPattern(pattern, 11);
+
+    for (size_t patternSize : {1u, 4u, 128u}) {
+        for (size_t size : {CpuCopyEngine::minChunkSize - patternSize, 3 * CpuCopyEngine::minChunkSize + 2 * patternSize}) {
+            std::vector<uint8_t> destination(size + 2, 0);
+            cpuCopyEngine.fill(destination.data() + 1, size, pattern.data(), patternSize);
+            EXPECT_TRUE(isFilledWithPattern(destination.data() + 1, size, pattern.data(), patternSize)) << patternSize << " " << size;
+            EXPECT_EQ(0u, destination[0]);
+            EXPECT_EQ(0u, destination[size + 1]);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,10 @@
 #include "unit_tests/mocks/mock_physical_address_allocator.h"
 #include "gtest/gtest.h"
 
+#include <map>
+#include <thread>
+#include <vector>
+
 using namespace OCLRT;
 
 TEST(PhysicalAddressAllocator, givenPhysicalAddressesAllocatorWhenReservingFirstPageThenNonZeroAddressIsReturned) {
@@ -76,3 +80,45 @@ TEST(PhysicalAddressAllocator, givenPhysicalAddressesAllocatorWhenReservingInter
     EXPECT_NE(physAddress, physAddress1);
     EXPECT_EQ(0u, physAddress3 & MemoryConstants::page64kMask);
 }
+
+TEST(PhysicalAddressAllocator, givenPhysicalAddressesAllocatorWhenReservingConsecutive4kPagesAtOnceThenContiguousRangeIsReturned) {
+    MockPhysicalAddressAllocator allocator;
+
+    auto physAddress = allocator.reserve4kPages(MemoryBanks::MainBank, 16);
+    EXPECT_EQ(allocator.initialPageAddress, physAddress);
+
+    auto physAddress1 = allocator.reserve4kPage(MemoryBanks::MainBank);
+    EXPECT_EQ(physAddress + 16 * MemoryConstants::pageSize, physAddress1);
+}
+
+TEST(PhysicalAddressAllocator, givenPagesReservedFromManyThreadsWhenReservingThenReturnedPagesDoNotOverlap) {
+    MockPhysicalAddressAllocator allocator;
+    const int pagesPerThread = 1000;
+    std::vector<uint64_t> addresses[4];
+
+    std::vector<std::thread> threads;
+    for (auto &threadAddresses : addresses) {
+        threads.emplace_back([&allocator, &threadAddresses, pagesPerThread] {
+            for (int i = 0; i < pagesPerThread; i++) {
+                threadAddresses.push_back(i % 2 ? allocator.reserve64kPage(MemoryBanks::MainBank) : allocator.reserve4kPage(MemoryBanks::MainBank));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::map<uint64_t, size_t> pages;
+    for (auto &threadAddresses : addresses) {
+        for (size_t i = 0; i < threadAddresses.size(); i++) {
+            pages[threadAddresses[i]] = i % 2 ? MemoryConstants::pageSize64k : MemoryConstants::pageSize;
+        }
+    }
+    ASSERT_EQ(4u * pagesPerThread, pages.size());
+    uint64_t end = 0;
+    for (auto &page : pages) {
+        EXPECT_LE(end, page.first);
+        EXPECT_EQ(0u, page.first % page.second);
+        end = page.first + page.second;
+    }
+}
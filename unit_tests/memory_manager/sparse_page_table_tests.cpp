@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub_mem_dump/page_table_entry_bits.h"
+#include "runtime/memory_manager/memory_banks.h"
+#include "runtime/memory_manager/sparse_page_table.h"
+#include "unit_tests/mocks/mock_physical_address_allocator.h"
+#include "gtest/gtest.h"
+
+#include <tuple>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+using PageWalkEntry = std::tuple<uint64_t, size_t, size_t, uint64_t>;
+
+template <typename Table>
+std::vector<PageWalkEntry> walk(Table &table, uintptr_t vm, size_t size, uint64_t entryBits) {
+    std::vector<PageWalkEntry> entries;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        entries.emplace_back(physAddress, size, offset, entryBits);
+    };
+    table.pageWalk(vm, size, 0, entryBits, walker, MemoryBanks::MainBank);
+    return entries;
+}
+
+struct Mapping {
+    uintptr_t vm;
+    size_t size;
+    uint64_t entryBits;
+};
+} // namespace
+
+template <typename BaseTable>
+struct SparsePageTableFixture : public ::testing::Test {
+    MockPhysicalAddressAllocator referenceAllocator;
+    MockPhysicalAddressAllocator allocator;
+    BaseTable referenceTable{&referenceAllocator};
+    SparsePageTable<BaseTable> table{&allocator};
+
+    void expectSameMapping(const Mapping &mapping) {
+        EXPECT_EQ(referenceTable.map(mapping.vm, mapping.size, mapping.entryBits, MemoryBanks::MainBank),
+                  table.map(mapping.vm, mapping.size, mapping.entryBits, MemoryBanks::MainBank));
+        EXPECT_EQ(walk(referenceTable, mapping.vm, mapping.size, mapping.entryBits),
+                  walk(table, mapping.vm, mapping.size, mapping.entryBits));
+        EXPECT_EQ(referenceAllocator.mainAllocator.load(), allocator.mainAllocator.load());
+    }
+};
+
+using SparsePPGTTTest = SparsePageTableFixture<std::conditional<is64bit, PML4, PDPE>::type>;
+using SparseGGTTTest = SparsePageTableFixture<PDPE>;
+
+TEST_F(SparsePPGTTTest, givenOverlappingMappingsWithDifferentEntryBitsWhenMappedThenResultsAreSameAsInPageTable) {
+    const uint64_t bits = (1 << PageTableEntry::presentBit) | (1 << PageTableEntry::writableBit);
+    const uintptr_t base = is64bit ? 0x7f0000000000u : 0x10000000u;
+    Mapping mappings[] = {
+        {base + 0x1000, 3 * MemoryConstants::pageSize, bits},
+        {base + 0x10, 1, bits},
+        {base + 0x1100, 0x2000, 0x0},
+        {base, 0x400000, bits},
+        {base + 0x1ff000, 0x2000, PageTableEntry::nonValidBits},
+        {base + 0x3ff800, 0x1000, 0x5},
+        {base + 0x2000, 0x1000, bits},
+        {base + 0x800000, 0x1000, PageTableEntry::nonValidBits},
+        {base + 0x7ff000, 0x3000, bits},
+    };
+    for (auto &mapping : mappings) {
+        expectSameMapping(mapping);
+    }
+}
+
+TEST_F(SparseGGTTTest, givenMappingsAtBothEndsOfGGTTWhenMappedThenResultsAreSameAsInPageTable) {
+    expectSameMapping({0xffffe000u, 0x2000, 0x3});
+    expectSameMapping({0x12345u, 0x10, 0x3});
+    expectSameMapping({0xfffff800u, 0x400, 0x7});
+}
+
+TEST_F(SparsePPGTTTest, givenLargeMappingWhenMappedThenPhysicalRangesAreReservedAtOncePerNode) {
+    size_t size = 64 * MemoryConstants::megaByte;
+    auto physAddress = table.map(0x40000000, size, 0x3, MemoryBanks::MainBank);
+
+    EXPECT_EQ(allocator.initialPageAddress, physAddress);
+    EXPECT_EQ(allocator.initialPageAddress + size, allocator.mainAllocator.load());
+    EXPECT_EQ(size / (SparsePPGTT::pagesPerNode * MemoryConstants::pageSize), table.getNodesCount());
+    EXPECT_EQ(table.getNodesCount(), table.getRangesCount());
+
+    auto entries = walk(table, 0x40000000, size, PageTableEntry::nonValidBits);
+    ASSERT_EQ(size / MemoryConstants::pageSize, entries.size());
+    EXPECT_EQ(PageWalkEntry(physAddress + size - MemoryConstants::pageSize, MemoryConstants::pageSize, size - MemoryConstants::pageSize, 0x3), entries.back());
+    EXPECT_EQ(allocator.initialPageAddress + size, allocator.mainAllocator.load());
+}
+
+TEST_F(SparsePPGTTTest, givenEntryBitsChangedInMiddleOfRangeWhenMappedThenRangeIsSplitAndMergedBack) {
+    table.map(0x100000, 16 * MemoryConstants::pageSize, 0x3, MemoryBanks::MainBank);
+    EXPECT_EQ(1u, table.getRangesCount());
+
+    table.map(0x104000, 4 * MemoryConstants::pageSize, 0x7, MemoryBanks::MainBank);
+    EXPECT_EQ(3u, table.getRangesCount());
+
+    table.map(0x104000, 4 * MemoryConstants::pageSize, 0x3, MemoryBanks::MainBank);
+    EXPECT_EQ(1u, table.getRangesCount());
+}
@@ -237,6 +237,8 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
         }
     }
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties) override { return taskCount; }
+
     void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool quickKmdSleep, bool forcePowerSavingMode) override {
     }
 
@@ -28,6 +28,7 @@ class MockKernel : public Kernel {
     using Kernel::isSchedulerKernel;
     using Kernel::kernelArgRequiresCacheFlush;
     using Kernel::kernelArguments;
+    using Kernel::localWorkSizeTuner;
     using Kernel::numberOfBindingTableStates;
     using Kernel::platformSupportCacheFlushAfterWalker;
     using Kernel::svmAllocationsRequireCacheFlush;
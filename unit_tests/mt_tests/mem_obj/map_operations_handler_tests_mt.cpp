@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/mem_obj/map_operations_handler.h"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct MapOperationsHandlerMtTests : public ::testing::Test {
+    static constexpr uint32_t threadsCount = 4;
+    static constexpr uint32_t regionsPerThread = 2048;
+    static constexpr size_t regionSize = 0x100;
+    static constexpr uint32_t iterationsCount = 4;
+
+    void *getRegionPtr(uint32_t thread, uint32_t region) {
+        // regions of all threads are interleaved, so every lookup crosses ranges owned by other threads,
+        // gap after each region keeps its end from touching the next one
+        return ptrOffset(baseAddress, (region * threadsCount + thread) * 2 * regionSize);
+    }
+
+    void *baseAddress = reinterpret_cast<void *>(0x100000);
+    MapOperationsHandler handler;
+    std::atomic<uint32_t> failuresCount{0};
+};
+
+TEST_F(MapOperationsHandlerMtTests, givenThousandsOfMappedRegionsWhenMappingAndUnmappingConcurrentlyThenEveryDisjointWriteMappingSucceeds) {
+    auto mapUnmap = [&](uint32_t thread) {
+        cl_map_flags mapFlags = CL_MAP_WRITE;
+        MemObjSizeArray size = {{regionSize, 1, 1}};
+        MemObjOffsetArray offset = {{0, 0, 0}};
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            for (uint32_t region = 0; region < regionsPerThread; region++) {
+                if (!handler.add(getRegionPtr(thread, region), regionSize, mapFlags, size, offset, 0)) {
+                    failuresCount++;
+                }
+            }
+            for (uint32_t region = 0; region < regionsPerThread; region++) {
+                MapInfo mapInfo;
+                if (!handler.find(getRegionPtr(thread, region), mapInfo) || mapInfo.ptrLength != regionSize) {
+                    failuresCount++;
+                }
+                handler.remove(getRegionPtr(thread, region));
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadsCount; thread++) {
+        threads.emplace_back(mapUnmap, thread);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    RecordProperty("mapUnmapDurationUs", static_cast<int>(duration.count()));
+
+    EXPECT_EQ(0u, failuresCount.load());
+    EXPECT_EQ(0u, handler.size());
+}
+
+TEST_F(MapOperationsHandlerMtTests, givenWriteMappedRegionWhenOtherThreadsMapOverlappingRangesConcurrentlyThenOnlyOneWriteMappingIsAccepted) {
+    std::atomic<uint32_t> acceptedCount{0};
+    auto mapSameRange = [&](uint32_t thread) {
+        cl_map_flags mapFlags = CL_MAP_WRITE;
+        MemObjSizeArray size = {{regionSize, 1, 1}};
+        MemObjOffsetArray offset = {{0, 0, 0}};
+        if (handler.add(ptrOffset(baseAddress, thread), regionSize, mapFlags, size, offset, 0)) {
+            acceptedCount++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadsCount; thread++) {
+        threads.emplace_back(mapSameRange, thread);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1u, acceptedCount.load());
+    EXPECT_EQ(1u, handler.size());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2018 Intel Corporation
+ * Copyright (C) 2017-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,12 @@ TEST(DrmMapperTests, engineNodeMapPass) {
     EXPECT_EQ(expected, flag);
 }
 
+TEST(DrmMapperTests, givenBcsEngineTypeWhenAskedForEngineFlagThenReturnBlt) {
+    unsigned int flag = DrmEngineMapper::engineNodeMap(EngineType::ENGINE_BCS);
+    unsigned int expected = I915_EXEC_BLT;
+    EXPECT_EQ(expected, flag);
+}
+
 TEST(DrmMapperTests, engineNodeMapNegative) {
-    EXPECT_THROW(DrmEngineMapper::engineNodeMap(EngineType::ENGINE_BCS), std::exception);
+    EXPECT_THROW(DrmEngineMapper::engineNodeMap(EngineType::ENGINE_VCS), std::exception);
 }
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/mapped_file.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(MappedFileTest, givenMappedFileWhenDataIsWrittenThenItIsStoredInFile) {
+    const char *fileName = "mapped_file_test.bin";
+    {
+        auto mappedFile = MappedFile::create(fileName, 4096);
+        ASSERT_NE(nullptr, mappedFile);
+        EXPECT_EQ(4096u, mappedFile->getSize());
+        memcpy(mappedFile->getData(), "stream", 6);
+    }
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName);
+
+    ASSERT_EQ(4096u, content.size());
+    EXPECT_EQ(0, memcmp(content.data(), "stream", 6));
+    EXPECT_EQ(0, content[6]);
+}
+
+TEST(MappedFileTest, givenZeroSizeOrInvalidPathWhenMappedFileIsCreatedThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, MappedFile::create("mapped_file_test.bin", 0));
+    EXPECT_EQ(nullptr, MappedFile::create("not_existing_directory/mapped_file_test.bin", 4096));
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/os_interface/linux/page_write_tracker_linux.h"
+#include "runtime/mem_obj/buffer.h"
+#include "runtime/sharings/sharing.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace OCLRT;
+
+struct PageWriteTrackerTests : public ::testing::Test {
+    void SetUp() override {
+        // separate mapping without huge pages, so writes to other memory don't mark tracked pages
+        auto mapping = mmap(nullptr, memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(MAP_FAILED, mapping);
+        madvise(mapping, memorySize, MADV_NOHUGEPAGE);
+        memory = reinterpret_cast<uint8_t *>(mapping);
+    }
+    void TearDown() override {
+        if (memory) {
+            munmap(memory, memorySize);
+        }
+    }
+
+    static constexpr size_t memorySize = 8 * MemoryConstants::pageSize;
+    uint8_t *memory = nullptr;
+};
+
+constexpr size_t PageWriteTrackerTests::memorySize;
+
+TEST_F(PageWriteTrackerTests, givenTrackedMemoryWithoutWritesWhenAskedForWrittenRangesThenNothingIsReturned) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    auto tracker = PageWriteTracker::create(memory, memorySize);
+    ASSERT_NE(nullptr, tracker);
+    volatile uint8_t readValue = memory[MemoryConstants::pageSize];
+    (void)readValue;
+    tracker->stop();
+
+    EXPECT_TRUE(tracker->getWrittenRanges().empty());
+}
+
+TEST_F(PageWriteTrackerTests, givenWritesToTrackedMemoryWhenAskedForWrittenRangesThenOnlyWrittenPagesAreReturned) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    auto tracker = PageWriteTracker::create(memory, memorySize);
+    ASSERT_NE(nullptr, tracker);
+
+    memory[2 * MemoryConstants::pageSize + 5] = 1;
+    memory[3 * MemoryConstants::pageSize] = 2;
+    memory[3 * MemoryConstants::pageSize + 1] = 3;
+    memory[6 * MemoryConstants::pageSize + 100] = 4;
+    tracker->stop();
+
+    auto writtenRanges = tracker->getWrittenRanges();
+    ASSERT_EQ(2u, writtenRanges.size());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, writtenRanges[0].offset);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, writtenRanges[0].size);
+    EXPECT_EQ(6 * MemoryConstants::pageSize, writtenRanges[1].offset);
+    EXPECT_EQ(MemoryConstants::pageSize, writtenRanges[1].size);
+    EXPECT_EQ(1u, memory[2 * MemoryConstants::pageSize + 5]);
+    EXPECT_EQ(3u, memory[3 * MemoryConstants::pageSize + 1]);
+    EXPECT_EQ(4u, memory[6 * MemoryConstants::pageSize + 100]);
+}
+
+TEST_F(PageWriteTrackerTests, givenRangeNotAlignedToPagesWhenTrackingThenPartialPagesAreReportedAsWritten) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    auto offset = MemoryConstants::pageSize / 2;
+    auto size = 4 * MemoryConstants::pageSize;
+    auto tracker = PageWriteTracker::create(memory + offset, size);
+    ASSERT_NE(nullptr, tracker);
+    tracker->stop();
+
+    auto writtenRanges = tracker->getWrittenRanges();
+    ASSERT_EQ(2u, writtenRanges.size());
+    EXPECT_EQ(0u, writtenRanges[0].offset);
+    EXPECT_EQ(MemoryConstants::pageSize - offset, writtenRanges[0].size);
+    EXPECT_EQ(size - offset, writtenRanges[1].offset);
+    EXPECT_EQ(offset, writtenRanges[1].size);
+}
+
+TEST_F(PageWriteTrackerTests, givenRangeWithoutWholePageWhenCreatingTrackerThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, PageWriteTracker::create(memory + 1, MemoryConstants::pageSize));
+}
+
+TEST_F(PageWriteTrackerTests, givenStoppedTrackerWhenMemoryIsWrittenThenWriteIsNotReported) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    auto tracker = PageWriteTracker::create(memory, memorySize);
+    ASSERT_NE(nullptr, tracker);
+    tracker->stop();
+
+    memory[MemoryConstants::pageSize] = 1;
+    EXPECT_TRUE(tracker->getWrittenRanges().empty());
+}
+
+TEST_F(PageWriteTrackerTests, givenSoftDirtyBitsNotSupportedWhenCreatingTrackerThenNullptrIsReturned) {
+    if (PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    EXPECT_EQ(nullptr, PageWriteTracker::create(memory, memorySize));
+}
+
+TEST_F(PageWriteTrackerTests, givenSystemCallWritingToTrackedMemoryWhenAskedForWrittenRangesThenWrittenPageIsReturned) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    int pipeFileDescriptors[2] = {};
+    ASSERT_EQ(0, pipe(pipeFileDescriptors));
+    const char data[] = "abc";
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(data)), write(pipeFileDescriptors[1], data, sizeof(data)));
+
+    auto tracker = PageWriteTracker::create(memory, memorySize);
+    ASSERT_NE(nullptr, tracker);
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(data)), read(pipeFileDescriptors[0], memory + 3 * MemoryConstants::pageSize, sizeof(data)));
+    tracker->stop();
+    close(pipeFileDescriptors[0]);
+    close(pipeFileDescriptors[1]);
+
+    auto writtenRanges = tracker->getWrittenRanges();
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(3 * MemoryConstants::pageSize, writtenRanges[0].offset);
+    EXPECT_EQ(MemoryConstants::pageSize, writtenRanges[0].size);
+    EXPECT_EQ(0, memcmp(memory + 3 * MemoryConstants::pageSize, data, sizeof(data)));
+}
+
+TEST_F(PageWriteTrackerTests, givenTwoActiveTrackersWhenTheirMemoryIsWrittenThenEachReportsItsOwnWrites) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    auto firstTracker = PageWriteTracker::create(memory, memorySize / 2);
+    ASSERT_NE(nullptr, firstTracker);
+    auto secondTracker = PageWriteTracker::create(memory + memorySize / 2, memorySize / 2);
+    ASSERT_NE(nullptr, secondTracker);
+
+    memory[MemoryConstants::pageSize] = 1;
+    memory[memorySize / 2 + 2 * MemoryConstants::pageSize] = 2;
+    firstTracker->stop();
+    memory[memorySize / 2 + 3 * MemoryConstants::pageSize] = 3;
+    secondTracker->stop();
+
+    auto writtenRanges = firstTracker->getWrittenRanges();
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(MemoryConstants::pageSize, writtenRanges[0].offset);
+    writtenRanges = secondTracker->getWrittenRanges();
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, writtenRanges[0].offset);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, writtenRanges[0].size);
+}
+
+struct MapWriteTrackingTests : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableMapWriteTracking.set(true);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        context = std::make_unique<MockContext>(device.get());
+        cmdQ = std::make_unique<MockCommandQueue>(context.get(), device.get(), nullptr);
+
+        cl_int retVal = CL_SUCCESS;
+        buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+        // sharing handler disallows mapping on CPU, map goes through read and unmap through write buffer
+        buffer->setSharingHandler(new SharingHandler());
+    }
+
+    static constexpr size_t bufferSize = 4 * MemoryConstants::pageSize;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockCommandQueue> cmdQ;
+    std::unique_ptr<Buffer> buffer;
+};
+
+constexpr size_t MapWriteTrackingTests::bufferSize;
+
+TEST_F(MapWriteTrackingTests, givenWriteToSinglePageOfMappedBufferWhenUnmappingThenOnlyThisPageIsWrittenBack) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    cl_int retVal = CL_SUCCESS;
+    auto mappedPtr = reinterpret_cast<uint8_t *>(cmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 0, bufferSize, 0, nullptr, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    mappedPtr[2 * MemoryConstants::pageSize + 10] = 0x5a;
+    retVal = cmdQ->enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(1u, cmdQ->writeBufferCounter);
+    EXPECT_FALSE(cmdQ->writeBufferBlocking);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cmdQ->writeBufferOffset);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->writeBufferSize);
+    EXPECT_EQ(mappedPtr + 2 * MemoryConstants::pageSize, cmdQ->writeBufferPtr);
+}
+
+TEST_F(MapWriteTrackingTests, givenWritesToSeparatePagesOfMappedBufferWhenUnmappingThenEachRangeIsWrittenBackWithoutBlocking) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    cl_int retVal = CL_SUCCESS;
+    auto mappedPtr = reinterpret_cast<uint8_t *>(cmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 0, bufferSize, 0, nullptr, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    mappedPtr[0] = 0x5a;
+    mappedPtr[3 * MemoryConstants::pageSize] = 0x5a;
+    retVal = cmdQ->enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(2u, cmdQ->writeBufferCounter);
+    EXPECT_FALSE(cmdQ->writeBufferBlocking);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, cmdQ->writeBufferOffset);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->writeBufferSize);
+}
+
+TEST_F(MapWriteTrackingTests, givenMappedBufferNotWrittenByHostWhenUnmappingThenNothingIsWrittenBack) {
+    if (!PageWriteTrackerLinux::isSoftDirtySupported()) {
+        return;
+    }
+    cl_int retVal = CL_SUCCESS;
+    auto mappedPtr = cmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 0, bufferSize, 0, nullptr, nullptr, retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = cmdQ->enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, cmdQ->writeBufferCounter);
+}
+
+TEST_F(MapWriteTrackingTests, givenNonBlockingMapWhenUnmappingThenWholeMappedRangeIsWrittenBack) {
+    cl_int retVal = CL_SUCCESS;
+    auto mappedPtr = cmdQ->enqueueMapBuffer(buffer.get(), CL_FALSE, CL_MAP_WRITE, 0, bufferSize, 0, nullptr, nullptr, retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = cmdQ->enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, cmdQ->writeBufferCounter);
+    EXPECT_EQ(0u, cmdQ->writeBufferOffset);
+    EXPECT_EQ(bufferSize, cmdQ->writeBufferSize);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018 Intel Corporation
+ * Copyright (C) 2018-2019 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,12 @@ TEST(WddmMapperTests, givenRcsEngineTypeWhenAskedForNodeOrdinalThenReturn3d) {
     EXPECT_EQ(expected, gpuNode);
 }
 
+TEST(WddmMapperTests, givenBcsEngineTypeWhenAskedForNodeOrdinalThenReturnBlt) {
+    GPUNODE_ORDINAL gpuNode = WddmEngineMapper::engineNodeMap(EngineType::ENGINE_BCS);
+    GPUNODE_ORDINAL expected = GPUNODE_BLT;
+    EXPECT_EQ(expected, gpuNode);
+}
+
 TEST(WddmMapperTests, givenNotSupportedEngineWhenAskedForNodeThenAbort) {
-    EXPECT_THROW(WddmEngineMapper::engineNodeMap(EngineType::ENGINE_BCS), std::exception);
+    EXPECT_THROW(WddmEngineMapper::engineNodeMap(EngineType::ENGINE_VCS), std::exception);
 }
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/utilities/object_pool.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace OCLRT;
+
+typedef api_tests SubBufferTest;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double subBufferMultiplier = 1.5000;
+
+// creates and releases sub-buffers carved out of one pool buffer, the way suballocators do
+long long measureSubBuffersCreateRelease(cl_mem parentBuffer, size_t subBuffersCount) {
+    long long times[3] = {0, 0, 0};
+    std::vector<cl_mem> subBuffers(subBuffersCount);
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t subBufferId = 0; subBufferId < subBuffersCount; subBufferId++) {
+            cl_buffer_region region = {subBufferId * MemoryConstants::cacheLineSize, MemoryConstants::cacheLineSize};
+            subBuffers[subBufferId] = clCreateSubBuffer(parentBuffer, CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region, nullptr);
+        }
+        for (auto subBuffer : subBuffers) {
+            clReleaseMemObject(subBuffer);
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST_F(SubBufferTest, givenPoolBufferWhenSubBuffersAreCreatedAndReleasedWithObjectPoolingThenRateIsNotLowerThanWithoutPooling) {
+    const size_t subBuffersCount = 4096;
+    auto parentBuffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, subBuffersCount * MemoryConstants::cacheLineSize, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    bool objectPooling = DebugManager.flags.EnableObjectPooling.get();
+    DebugManager.flags.EnableObjectPooling.set(false);
+    auto heapTime = measureSubBuffersCreateRelease(parentBuffer, subBuffersCount);
+    DebugManager.flags.EnableObjectPooling.set(true);
+    auto pooledTime = measureSubBuffersCreateRelease(parentBuffer, subBuffersCount);
+    DebugManager.flags.EnableObjectPooling.set(objectPooling);
+    PooledObjects::trim();
+    clReleaseMemObject(parentBuffer);
+
+    std::cout << "sub-buffers created and released per ms, heap: " << subBuffersCount * 1000000 / (heapTime + 1)
+              << " pooled: " << subBuffersCount * 1000000 / (pooledTime + 1) << std::endl;
+
+    double previousRatio = -1.0;
+    uint64_t hash = getHash(__FUNCTION__, strlen(__FUNCTION__));
+    bool success = getTestRatio(hash, previousRatio);
+    double ratio = static_cast<double>(pooledTime) / static_cast<double>(heapTime);
+
+    EXPECT_LE(pooledTime, static_cast<long long>(heapTime * subBufferMultiplier)) << "pooled: " << pooledTime << " heap: " << heapTime;
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, subBufferMultiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/local_ids_cache.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+// compares per-thread data generation rate for repeated dispatches with and without LocalIdsCache
+struct LocalIdsPerfTest : public ::testing::TestWithParam<uint16_t> {
+    static const int dispatchesCount = 10000;
+    const uint16_t simd = 16;
+    const std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    template <typename Dispatch>
+    long long measure(Dispatch dispatch) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            for (int dispatchId = 0; dispatchId < dispatchesCount; dispatchId++) {
+                dispatch();
+            }
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+};
+
+TEST_P(LocalIdsPerfTest, givenRepeatedDispatchGeometryWhenLocalIdsAreCachedThenDispatchRateIsNotLower) {
+    std::array<uint16_t, 3> localWorkgroupSize = {{GetParam(), 1, 1}};
+    auto size = getThreadsPerWG(simd, GetParam()) * getPerThreadSizeLocalIDs(simd);
+    auto buffer = alignedMalloc(size, 32);
+    LocalIdsCache cache;
+
+    auto generatedTime = measure([&]() {
+        generateLocalIDs(buffer, simd, localWorkgroupSize, dimensionsOrder, false);
+    });
+    auto cachedTime = measure([&]() {
+        cache.setLocalIds(buffer, size, simd, localWorkgroupSize, dimensionsOrder, false);
+    });
+    alignedFree(buffer);
+
+    std::string testName = std::string(__FUNCTION__) + std::to_string(GetParam());
+    uint64_t hash = Hash::hash(testName.c_str(), testName.size());
+    double previousRatio = -1.0;
+    bool success = getTestRatio(hash, previousRatio);
+    double ratio = static_cast<double>(cachedTime) / static_cast<double>(generatedTime);
+
+    EXPECT_LE(cachedTime, static_cast<long long>(generatedTime * multiplier)) << "cached: " << cachedTime << " generated: " << generatedTime;
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+
+INSTANTIATE_TEST_CASE_P(LocalIdsPerfTests,
+                        LocalIdsPerfTest,
+                        ::testing::Values(static_cast<uint16_t>(256), static_cast<uint16_t>(1024)));
+} // namespace ULT
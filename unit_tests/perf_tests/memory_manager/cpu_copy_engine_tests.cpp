@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <tuple>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+
+// compares copy bandwidth of CpuCopyEngine against single threaded memcpy for given copy size and workers count
+struct CpuCopyEnginePerfTest : public ::testing::TestWithParam<std::tuple<size_t /*size in MB*/, uint32_t /*workers*/>> {
+    static const int copiesCount = 4;
+
+    template <typename Copy>
+    long long measure(Copy copy) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            for (int copyId = 0; copyId < copiesCount; copyId++) {
+                copy();
+            }
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    static double getBandwidth(size_t size, long long time) {
+        return static_cast<double>(size) * copiesCount / static_cast<double>(time);
+    }
+};
+
+TEST_P(CpuCopyEnginePerfTest, givenLargeCopyWhenCpuCopyEngineIsUsedThenBandwidthIsNotLowerThanMemcpy) {
+    size_t size = std::get<0>(GetParam()) * MemoryConstants::megaByte;
+    uint32_t workersCount = std::get<1>(GetParam());
+    auto source = alignedMalloc(size, MemoryConstants::pageSize);
+    auto destination = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(source, 1, size);
+    memset(destination, 0, size);
+    CpuCopyEngine cpuCopyEngine(workersCount, CpuCopyEngine::defaultNonTemporalThreshold);
+
+    auto memcpyTime = measure([&]() {
+        memcpy(destination, source, size);
+    });
+    auto engineTime = measure([&]() {
+        cpuCopyEngine.copy(destination, source, size);
+    });
+    alignedFree(source);
+    alignedFree(destination);
+
+    std::cout << "size: " << std::get<0>(GetParam()) << "MB workers: " << workersCount
+              << " memcpy: " << getBandwidth(size, memcpyTime) << " GB/s"
+              << " engine: " << getBandwidth(size, engineTime) << " GB/s" << std::endl;
+
+    std::string testName = std::string(__FUNCTION__) + std::to_string(std::get<0>(GetParam())) + "_" + std::to_string(workersCount);
+    uint64_t hash = Hash::hash(testName.c_str(), testName.size());
+    double previousRatio = -1.0;
+    bool success = getTestRatio(hash, previousRatio);
+    double ratio = static_cast<double>(engineTime) / static_cast<double>(memcpyTime);
+
+    EXPECT_LE(engineTime, static_cast<long long>(memcpyTime * multiplier)) << "engine: " << engineTime << " memcpy: " << memcpyTime;
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+
+INSTANTIATE_TEST_CASE_P(CpuCopyEnginePerfTests,
+                        CpuCopyEnginePerfTest,
+                        ::testing::Combine(::testing::Values(static_cast<size_t>(4), static_cast<size_t>(64), static_cast<size_t>(256)),
+                                           ::testing::Values(0u, 1u, 3u, 7u)));
+} // namespace ULT
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/memory_manager/memory_banks.h"
+#include "runtime/memory_manager/sparse_page_table.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <iostream>
+#include <memory>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+
+// compares time of mapping large allocation in fresh PPGTT for sparse and full page table
+struct SparsePageTablePerfTest : public ::testing::TestWithParam<size_t /*size in GB*/> {
+    const uintptr_t gpuAddress = is64bit ? 0x100000000u : 0x0u;
+
+    template <typename Table>
+    long long measureMap(size_t size) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            PhysicalAddressAllocator allocator;
+            auto table = std::make_unique<Table>(&allocator);
+            Timer t;
+            t.start();
+            table->map(gpuAddress, size, 0x3, MemoryBanks::MainBank);
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+};
+
+TEST_P(SparsePageTablePerfTest, givenLargeAllocationWhenMappedInSparsePageTableThenTimeIsNotHigherThanInPageTable) {
+    if (!is64bit && GetParam() > 2) {
+        return;
+    }
+    auto size = static_cast<size_t>(GetParam() * MemoryConstants::gigaByte);
+
+    auto pageTableTime = measureMap<std::conditional<is64bit, PML4, PDPE>::type>(size);
+    auto sparseTime = measureMap<SparsePPGTT>(size);
+
+    std::cout << "size: " << GetParam() << "GB page table: " << pageTableTime << " sparse: " << sparseTime << std::endl;
+
+    std::string testName = std::string(__FUNCTION__) + std::to_string(GetParam());
+    uint64_t hash = Hash::hash(testName.c_str(), testName.size());
+    double previousRatio = -1.0;
+    bool success = getTestRatio(hash, previousRatio);
+    double ratio = static_cast<double>(sparseTime) / static_cast<double>(pageTableTime);
+
+    EXPECT_LE(sparseTime, static_cast<long long>(pageTableTime * multiplier)) << "sparse: " << sparseTime << " page table: " << pageTableTime;
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+
+INSTANTIATE_TEST_CASE_P(SparsePageTablePerfTests,
+                        SparsePageTablePerfTest,
+                        ::testing::Values(static_cast<size_t>(1), static_cast<size_t>(4), static_cast<size_t>(16)));
+} // namespace ULT
@@ -500,3 +500,42 @@ __kernel void CopyImage3dToBuffer16Bytes(__read_only image3d_t input,
         *(__global uint4*)(dst + DstOffset + x * 16) = c;
     }
 }
+
+uint FindDescriptor(const __global uint4* pDescriptors, uint descriptorsCount, uint gid)
+{
+    uint low = 0;
+    uint high = descriptorsCount - 1;
+    while (low < high) {
+        uint mid = (low + high + 1) >> 1;
+        if (pDescriptors[mid].w <= gid) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+__kernel void CopyBufferToBufferScatter(
+    const __global uchar* pSrc,
+    __global uchar* pDst,
+    const __global uint4* pDescriptors,
+    uint descriptorsCount)
+{
+    uint gid = get_global_id(0);
+    uint4 descriptor = pDescriptors[FindDescriptor(pDescriptors, descriptorsCount, gid)];
+    uint byteIndex = gid - descriptor.w;
+    pDst[ descriptor.y + byteIndex ] = pSrc[ descriptor.x + byteIndex ];
+}
+
+__kernel void FillBufferScatter(
+    __global uchar* pDst,
+    const __global uint4* pDescriptors,
+    uint descriptorsCount)
+{
+    uint gid = get_global_id(0);
+    uint4 descriptor = pDescriptors[FindDescriptor(pDescriptors, descriptorsCount, gid)];
+    uint byteIndex = gid - descriptor.w;
+    const __global uchar* pPattern = (const __global uchar*)(pDescriptors + descriptorsCount) + descriptor.x;
+    pDst[ descriptor.y + byteIndex ] = pPattern[ byteIndex % descriptor.z ];
+}
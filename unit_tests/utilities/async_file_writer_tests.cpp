@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/async_file_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+TEST(AsyncFileWriterTest, givenWritesSpanningManyChunksWhenDrainedThenOutputContainsThemInOrder) {
+    std::stringstream output;
+    std::string expected;
+    AsyncFileWriter writer(output, 16, 2);
+    for (int i = 0; i < 100; i++) {
+        auto data = std::to_string(i) + std::string(i % 40, 'x');
+        writer.write(data.c_str(), data.size());
+        expected += data;
+    }
+    writer.drain();
+    EXPECT_EQ(expected, output.str());
+    EXPECT_EQ(16u, writer.getChunkSize());
+    EXPECT_LE(writer.getAllocatedChunksCount(), 2u);
+}
+
+TEST(AsyncFileWriterTest, givenPartiallyFilledChunkWhenFlushedThenItIsWrittenWithoutWaitingForMoreData) {
+    std::stringstream output;
+    AsyncFileWriter writer(output, 1024, 4);
+    writer.write("abc", 3);
+    writer.flush();
+    writer.write("def", 3);
+    writer.drain();
+    EXPECT_EQ("abcdef", output.str());
+    EXPECT_LE(writer.getAllocatedChunksCount(), 4u);
+}
+
+TEST(AsyncFileWriterTest, givenPendingDataWhenWriterIsDestroyedThenDataIsWritten) {
+    std::stringstream output;
+    {
+        AsyncFileWriter writer(output, 4, 1);
+        writer.write("0123456789", 10);
+    }
+    EXPECT_EQ("0123456789", output.str());
+}
+
+TEST(AsyncFileWriterTest, givenWritesFromManyThreadsThenEachWriteIsKeptWhole) {
+    std::stringstream output;
+    const size_t recordSize = 8;
+    const int recordsPerThread = 1000;
+    {
+        AsyncFileWriter writer(output, 60, 3);
+        std::vector<std::thread> threads;
+        for (char id = 'a'; id < 'e'; id++) {
+            threads.emplace_back([&writer, id, recordSize] {
+                std::string record(recordSize, id);
+                for (int i = 0; i < recordsPerThread; i++) {
+                    writer.write(record.c_str(), record.size());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    auto written = output.str();
+    ASSERT_EQ(4 * recordsPerThread * recordSize, written.size());
+    for (size_t offset = 0; offset < written.size(); offset += recordSize) {
+        EXPECT_EQ(std::string(recordSize, written[offset]), written.substr(offset, recordSize));
+    }
+}
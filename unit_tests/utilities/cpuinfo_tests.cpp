@@ -58,4 +58,25 @@ TEST(CpuInfo, cpuidex) {
     uint32_t cpuRegsInfo[4];
     uint32_t subleaf = 0;
     cpuInfo.cpuidex(cpuRegsInfo, 4, subleaf);
-}
\ No newline at end of file
+}
+
+TEST(CpuInfo, givenOsxsaveSupportedWhenXgetbvIsCalledThenX87AndSseStatesAreReported) {
+    const CpuInfo &cpuInfo = CpuInfo::getInstance();
+
+    uint32_t cpuRegsInfo[4];
+    cpuInfo.cpuid(cpuRegsInfo, 1u);
+    if ((cpuRegsInfo[2] & BIT(27)) == 0) {
+        return;
+    }
+    auto mask = BIT(0) | BIT(1);
+    EXPECT_EQ(mask, cpuInfo.xgetbv(0u) & mask);
+}
+
+TEST(CpuInfo, givenAvx512BwSupportedThenAvx512FAndAvx2AreSupported) {
+    const CpuInfo &cpuInfo = CpuInfo::getInstance();
+    if (!cpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw)) {
+        return;
+    }
+    EXPECT_TRUE(cpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_TRUE(cpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+}
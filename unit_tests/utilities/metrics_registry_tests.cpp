@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/utilities/metrics_registry.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+namespace {
+struct MockMetricsRegistry : MetricsRegistry {
+    using MetricsRegistry::allocations;
+    using MetricsRegistry::counters;
+};
+} // namespace
+
+TEST(HistogramTest, givenSmallValuesWhenBucketIsSelectedThenEachValueHasOwnBucket) {
+    for (uint64_t value = 0; value < 2 * Histogram::subBucketsCount; value++) {
+        auto bucketIndex = Histogram::getBucketIndex(value);
+        EXPECT_EQ(value, bucketIndex);
+        EXPECT_EQ(value, Histogram::getBucketUpperBound(bucketIndex));
+    }
+}
+
+TEST(HistogramTest, givenLargeValueWhenBucketIsSelectedThenUpperBoundIsWithinPrecision) {
+    uint64_t values[] = {100, 1000, 123456789, 0x8000000000000000, UINT64_MAX};
+    for (auto value : values) {
+        auto bucketIndex = Histogram::getBucketIndex(value);
+        EXPECT_LT(bucketIndex, Histogram::bucketsCount);
+        auto upperBound = Histogram::getBucketUpperBound(bucketIndex);
+        EXPECT_LE(value, upperBound);
+        EXPECT_LE(upperBound - value, value / Histogram::subBucketsCount);
+    }
+    EXPECT_EQ(UINT64_MAX, Histogram::getBucketUpperBound(Histogram::bucketsCount - 1));
+}
+
+TEST(HistogramTest, givenEmptyHistogramWhenQueriedThenZerosAreReturned) {
+    Histogram histogram;
+    EXPECT_EQ(0u, histogram.getCount());
+    EXPECT_EQ(0u, histogram.getMin());
+    EXPECT_EQ(0u, histogram.getMax());
+    EXPECT_EQ(0u, histogram.getPercentile(50.0));
+}
+
+TEST(HistogramTest, givenRecordedValuesWhenPercentilesAreQueriedThenTheyAreWithinPrecision) {
+    Histogram histogram;
+    for (uint64_t value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(1000u, histogram.getCount());
+    EXPECT_EQ(500500u, histogram.getSum());
+    EXPECT_EQ(1u, histogram.getMin());
+    EXPECT_EQ(1000u, histogram.getMax());
+
+    auto p50 = histogram.getPercentile(50.0);
+    EXPECT_LE(500u, p50);
+    EXPECT_GE(500u + 500u / Histogram::subBucketsCount, p50);
+    auto p99 = histogram.getPercentile(99.0);
+    EXPECT_LE(990u, p99);
+    EXPECT_GE(1000u, p99);
+    EXPECT_EQ(1000u, histogram.getPercentile(100.0));
+}
+
+TEST(HistogramTest, givenValuesRecordedFromManyThreadsThenNoneIsLost) {
+    Histogram histogram;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&histogram] {
+            for (uint64_t value = 0; value < 1000; value++) {
+                histogram.record(value);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(4000u, histogram.getCount());
+    EXPECT_EQ(0u, histogram.getMin());
+    EXPECT_EQ(999u, histogram.getMax());
+}
+
+TEST(MetricsRegistryTest, givenMetricsDisabledWhenAskedForEnabledInstanceThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableMetrics.set(false);
+    EXPECT_EQ(nullptr, MetricsRegistry::getEnabledInstance());
+    EXPECT_EQ(nullptr, MetricsRegistry::getEnabledApiHistogram("clFinish"));
+}
+
+TEST(MetricsRegistryTest, givenApiNameWhenHistogramIsRequestedAgainThenSameHistogramIsReturned) {
+    MetricsRegistry metricsRegistry;
+    auto &finishHistogram = metricsRegistry.getApiHistogram("clFinish");
+    auto &flushHistogram = metricsRegistry.getApiHistogram("clFlush");
+    EXPECT_NE(&finishHistogram, &flushHistogram);
+    EXPECT_EQ(&finishHistogram, &metricsRegistry.getApiHistogram(std::string("clFinish").c_str()));
+    EXPECT_EQ(2u, metricsRegistry.getApiHistogramsCount());
+}
+
+TEST(MetricsScopeTest, givenHistogramWhenScopeEndsThenDurationIsRecorded) {
+    Histogram histogram;
+    {
+        MetricsScope scope(&histogram);
+    }
+    {
+        MetricsScope scope(nullptr);
+    }
+    EXPECT_EQ(1u, histogram.getCount());
+}
+
+TEST(MetricsRegistryTest, givenCollectedMetricsWhenDumpingThenTextReportIsWritten) {
+    MockMetricsRegistry metricsRegistry;
+    metricsRegistry.counters[static_cast<uint32_t>(MetricCounter::Flushes)] = 3;
+    metricsRegistry.counters[static_cast<uint32_t>(MetricCounter::CpuCopiedBytes)] = 4096;
+    auto bufferIndex = static_cast<uint32_t>(GraphicsAllocation::AllocationType::BUFFER);
+    metricsRegistry.allocations[bufferIndex].count = 2;
+    metricsRegistry.allocations[bufferIndex].bytes = 8192;
+    metricsRegistry.getHistogram(MetricHistogram::ResidencyListSize).record(5);
+    metricsRegistry.getApiHistogram("clFinish").record(10);
+    metricsRegistry.getApiHistogram("clFinish").record(20);
+
+    EXPECT_EQ(3u, metricsRegistry.getCounter(MetricCounter::Flushes));
+    EXPECT_EQ(2u, metricsRegistry.getAllocationsCount(bufferIndex));
+    EXPECT_EQ(8192u, metricsRegistry.getAllocatedBytes(bufferIndex));
+
+    std::stringstream output;
+    metricsRegistry.dump(output);
+
+    std::string expected = "counter flushes 3\n"
+                           "counter cpuCopiedBytes 4096\n"
+                           "allocations BUFFER count=2 bytes=8192\n"
+                           "histogram residencyListSize count=1 mean=5 min=5 p50=5 p90=5 p99=5 max=5\n"
+                           "histogram waitTimeNs count=0 mean=0 min=0 p50=0 p90=0 p99=0 max=0\n"
+                           "api clFinish count=2 mean=15 min=10 p50=10 p90=20 p99=20 max=20\n";
+    EXPECT_EQ(expected, output.str());
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/object_pool.h"
+#include "runtime/event/user_event.h"
+#include "runtime/helpers/task_information.h"
+#include "runtime/mem_obj/buffer.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_csr.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(ObjectPoolTest, givenEmptyPoolWhenBlockIsAllocatedThenSlabIsCreated) {
+    ObjectPool pool(64, 4);
+    EXPECT_EQ(0u, pool.peekSlabsCount());
+
+    auto block = pool.allocate();
+    EXPECT_NE(nullptr, block);
+    EXPECT_EQ(1u, pool.peekSlabsCount());
+    EXPECT_EQ(1u, pool.peekUsedBlocksCount());
+
+    pool.free(block);
+    EXPECT_EQ(0u, pool.peekUsedBlocksCount());
+    EXPECT_TRUE(pool.trim());
+}
+
+TEST(ObjectPoolTest, givenSlabThatCantBeAllocatedWhenBlockIsAllocatedWithNothrowThenNullptrIsReturned) {
+    ObjectPool pool(std::numeric_limits<size_t>::max() / 4, 1);
+    EXPECT_EQ(nullptr, pool.allocate(std::nothrow));
+    EXPECT_EQ(0u, pool.peekSlabsCount());
+    EXPECT_EQ(0u, pool.peekUsedBlocksCount());
+}
+
+TEST(ObjectPoolTest, givenBlockSizeSmallerThanAlignmentWhenPoolIsCreatedThenBlockSizeIsAligned) {
+    ObjectPool pool(1, 4);
+    EXPECT_EQ(alignof(std::max_align_t), pool.getBlockSize());
+}
+
+TEST(ObjectPoolTest, givenReleasedBlockWhenBlockIsAllocatedThenSameBlockIsReused) {
+    ObjectPool pool(128, 4);
+    auto block = pool.allocate();
+    pool.free(block);
+
+    auto reusedBlock = pool.allocate();
+    EXPECT_EQ(block, reusedBlock);
+    EXPECT_EQ(1u, pool.peekSlabsCount());
+
+    pool.free(reusedBlock);
+    EXPECT_TRUE(pool.trim());
+}
+
+TEST(ObjectPoolTest, givenExhaustedSlabWhenBlockIsAllocatedThenNewSlabIsCreatedAndBlocksAreUnique) {
+    ObjectPool pool(64, 4);
+    std::set<void *> blocks;
+    for (int i = 0; i < 5; i++) {
+        blocks.insert(pool.allocate());
+    }
+    EXPECT_EQ(5u, blocks.size());
+    EXPECT_EQ(2u, pool.peekSlabsCount());
+
+    for (auto block : blocks) {
+        pool.free(block);
+    }
+    EXPECT_TRUE(pool.trim());
+    EXPECT_EQ(0u, pool.peekSlabsCount());
+}
+
+TEST(ObjectPoolTest, givenBlockInUseWhenTrimIsCalledThenSlabsAreNotReleased) {
+    ObjectPool pool(64, 4);
+    auto block = pool.allocate();
+    EXPECT_FALSE(pool.trim());
+    EXPECT_EQ(1u, pool.peekSlabsCount());
+
+    pool.free(block);
+    EXPECT_TRUE(pool.trim());
+}
+
+TEST(ObjectPoolTest, givenNullptrWhenFreeIsCalledThenNothingHappens) {
+    ObjectPool pool(64, 4);
+    pool.free(nullptr);
+    EXPECT_EQ(0u, pool.peekUsedBlocksCount());
+}
+
+TEST(ObjectPoolTest, givenMultipleThreadsWhenBlocksAreAllocatedAndFreedThenPoolStaysConsistent) {
+    ObjectPool pool(64, 16);
+    auto worker = [&pool]() {
+        for (int i = 0; i < 1000; i++) {
+            auto block = pool.allocate();
+            memset(block, i, 64);
+            pool.free(block);
+        }
+    };
+    std::thread t1(worker);
+    std::thread t2(worker);
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(0u, pool.peekUsedBlocksCount());
+    EXPECT_TRUE(pool.trim());
+}
+
+TEST(PooledObjectsTest, givenSizeWhenPoolIsQueriedThenSmallestFittingSizeClassIsReturned) {
+    EXPECT_EQ(PooledObjects::minBlockSize, PooledObjects::getPoolForSize(1)->getBlockSize());
+    EXPECT_EQ(PooledObjects::minBlockSize * 2, PooledObjects::getPoolForSize(PooledObjects::minBlockSize + 1)->getBlockSize());
+    EXPECT_EQ(PooledObjects::maxBlockSize, PooledObjects::getPoolForSize(PooledObjects::maxBlockSize)->getBlockSize());
+    EXPECT_EQ(nullptr, PooledObjects::getPoolForSize(PooledObjects::maxBlockSize + 1));
+}
+
+TEST(PooledObjectsTest, givenPoolingDisabledWhenObjectIsAllocatedThenPoolIsNotUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(false);
+
+    auto pool = PooledObjects::getPoolForSize(PooledObjects::minBlockSize);
+    auto usedBlocks = pool->peekUsedBlocksCount();
+
+    auto ptr = PooledObjects::allocate(8);
+    EXPECT_EQ(usedBlocks, pool->peekUsedBlocksCount());
+    PooledObjects::free(ptr);
+}
+
+TEST(PooledObjectsTest, givenSizeThatCantBeAllocatedWhenObjectIsAllocatedWithNothrowThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(true);
+    EXPECT_EQ(nullptr, PooledObjects::allocate(std::numeric_limits<size_t>::max() / 2, std::nothrow));
+}
+
+TEST(PooledObjectsTest, givenPoolingEnabledWhenObjectIsAllocatedAndFreedThenMemoryIsRecycled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(true);
+
+    auto pool = PooledObjects::getPoolForSize(PooledObjects::minBlockSize);
+    auto usedBlocks = pool->peekUsedBlocksCount();
+
+    auto ptr = PooledObjects::allocate(8);
+    EXPECT_EQ(usedBlocks + 1, pool->peekUsedBlocksCount());
+    PooledObjects::free(ptr);
+    EXPECT_EQ(usedBlocks, pool->peekUsedBlocksCount());
+
+    auto recycledPtr = PooledObjects::allocate(8);
+    EXPECT_EQ(ptr, recycledPtr);
+    PooledObjects::free(recycledPtr);
+    PooledObjects::trim();
+}
+
+TEST(PooledObjectsTest, givenPoolingEnabledWhenObjectIsFreedAfterPoolingIsDisabledThenBlockReturnsToPool) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(true);
+
+    auto ptr = PooledObjects::allocate(PooledObjects::maxBlockSize / 2);
+    auto pool = PooledObjects::getPoolForSize(PooledObjects::maxBlockSize);
+    EXPECT_EQ(1u, pool->peekUsedBlocksCount());
+
+    DebugManager.flags.EnableObjectPooling.set(false);
+    PooledObjects::free(ptr);
+    EXPECT_EQ(0u, pool->peekUsedBlocksCount());
+    PooledObjects::trim();
+}
+
+TEST(PooledObjectsTest, givenPoolingEnabledWhenEventIsReleasedThenNextEventReusesItsMemory) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(true);
+    MockContext context;
+
+    auto event = new UserEvent(&context);
+    void *eventMemory = event;
+    event->release();
+
+    auto nextEvent = new UserEvent(&context);
+    EXPECT_EQ(eventMemory, static_cast<void *>(nextEvent));
+    nextEvent->release();
+    PooledObjects::trim();
+}
+
+TEST(PooledObjectsTest, givenPoolingEnabledWhenCommandIsDeletedThenNextCommandReusesItsMemory) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(true);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    std::unique_ptr<MockCommandQueue> cmdQ(new MockCommandQueue(nullptr, device.get(), nullptr));
+    MockCommandStreamReceiver csr(*device->getExecutionEnvironment());
+
+    auto command = new CommandMarker(*cmdQ.get(), csr, CL_COMMAND_MARKER, 0);
+    void *commandMemory = command;
+    delete command;
+
+    std::unique_ptr<Command> nextCommand(new CommandMarker(*cmdQ.get(), csr, CL_COMMAND_MARKER, 0));
+    EXPECT_EQ(commandMemory, static_cast<void *>(nextCommand.get()));
+    nextCommand.reset();
+    PooledObjects::trim();
+}
+
+TEST(PooledObjectsTest, givenPoolingEnabledWhenSubBufferIsReleasedThenNextSubBufferReusesItsMemoryAndParentIsNotPooled) {
+    DebugManagerStateRestore restore;
+    MockContext context;
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> parentBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, parentBuffer);
+
+    auto getPooledBlocksCount = []() {
+        size_t usedBlocksCount = 0;
+        for (auto blockSize = PooledObjects::minBlockSize; blockSize <= PooledObjects::maxBlockSize; blockSize <<= 1) {
+            usedBlocksCount += PooledObjects::getPoolForSize(blockSize)->peekUsedBlocksCount();
+        }
+        return usedBlocksCount;
+    };
+    DebugManager.flags.EnableObjectPooling.set(true);
+    auto usedBlocksCount = getPooledBlocksCount();
+
+    cl_buffer_region region = {0, MemoryConstants::cacheLineSize};
+    auto subBuffer = parentBuffer->createSubBuffer(CL_MEM_READ_WRITE, &region, retVal);
+    ASSERT_NE(nullptr, subBuffer);
+    EXPECT_EQ(usedBlocksCount + 1, getPooledBlocksCount());
+    void *subBufferMemory = subBuffer;
+    subBuffer->release();
+    EXPECT_EQ(usedBlocksCount, getPooledBlocksCount());
+
+    region.origin = MemoryConstants::cacheLineSize;
+    auto nextSubBuffer = parentBuffer->createSubBuffer(CL_MEM_READ_WRITE, &region, retVal);
+    EXPECT_EQ(subBufferMemory, static_cast<void *>(nextSubBuffer));
+    nextSubBuffer->release();
+
+    parentBuffer.reset();
+    PooledObjects::trim();
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/trace_recorder.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+TEST(TraceRingBufferTest, givenCapacityNotPowerOfTwoWhenRingBufferIsCreatedThenCapacityIsRoundedUp) {
+    TraceRingBuffer ringBuffer(5, 1);
+    EXPECT_EQ(8u, ringBuffer.getCapacity());
+    EXPECT_EQ(1u, ringBuffer.getThreadId());
+}
+
+TEST(TraceRingBufferTest, givenMoreEventsThanCapacityWhenCopyingEventsThenOnlyMostRecentEventsAreReturnedInOrder) {
+    TraceRingBuffer ringBuffer(4, 1);
+    for (uint64_t i = 0; i < 6; i++) {
+        ringBuffer.record({"event", i, 1, i, TraceCategory::Api});
+    }
+    EXPECT_EQ(6u, ringBuffer.getRecordedEventsCount());
+
+    // oldest slot is the one next event is written to, it is never returned from full buffer
+    std::vector<TraceEvent> events;
+    ringBuffer.copyEvents(events);
+    ASSERT_EQ(3u, events.size());
+    for (uint64_t i = 0; i < 3; i++) {
+        EXPECT_EQ(i + 3, events[i].start);
+    }
+}
+
+TEST(TraceRingBufferTest, givenBufferNotFullWhenCopyingEventsThenAllEventsAreReturned) {
+    TraceRingBuffer ringBuffer(4, 1);
+    for (uint64_t i = 0; i < 3; i++) {
+        ringBuffer.record({"event", i, 1, i, TraceCategory::Api});
+    }
+
+    std::vector<TraceEvent> events;
+    ringBuffer.copyEvents(events);
+    ASSERT_EQ(3u, events.size());
+    for (uint64_t i = 0; i < 3; i++) {
+        EXPECT_EQ(i, events[i].start);
+    }
+}
+
+TEST(TraceScopeTest, givenTracingDisabledWhenAskedForEnabledInstanceThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableTracing.set(false);
+    EXPECT_EQ(nullptr, TraceRecorder::getEnabledInstance());
+}
+
+TEST(TraceScopeTest, givenRecorderWhenScopeEndsThenCompleteEventIsRecorded) {
+    TraceRecorder recorder(16);
+    auto timestampBefore = TraceRecorder::getTimestamp();
+    {
+        TraceScope scope(TraceCategory::FlushTask, "flushTask", 7, &recorder);
+    }
+    auto timestampAfter = TraceRecorder::getTimestamp();
+
+    std::vector<TraceEvent> events;
+    recorder.getRingBufferForCurrentThread().copyEvents(events);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_STREQ("flushTask", events[0].name);
+    EXPECT_EQ(TraceCategory::FlushTask, events[0].category);
+    EXPECT_EQ(7u, events[0].argument);
+    EXPECT_LE(timestampBefore, events[0].start);
+    EXPECT_LE(events[0].start + events[0].duration, timestampAfter);
+}
+
+TEST(TraceScopeTest, givenNoRecorderWhenScopeEndsThenNothingIsRecorded) {
+    TraceRecorder recorder(16);
+    {
+        TraceScope scope(TraceCategory::Wait, "wait", 0, nullptr);
+    }
+    EXPECT_EQ(0u, recorder.getRingBuffersCount());
+}
+
+TEST(TraceRecorderTest, givenEventsFromManyThreadsWhenRecordedThenEachThreadGetsOwnRingBuffer) {
+    TraceRecorder recorder(16);
+    recorder.record(TraceCategory::Api, "clFinish", 0, 1, 0);
+    std::thread worker([&recorder] {
+        recorder.record(TraceCategory::Allocation, "allocate", 2, 3, 0);
+        recorder.record(TraceCategory::Allocation, "allocate", 4, 5, 0);
+    });
+    worker.join();
+    recorder.record(TraceCategory::Api, "clFlush", 6, 7, 0);
+
+    EXPECT_EQ(2u, recorder.getRingBuffersCount());
+    EXPECT_EQ(2u, recorder.getRingBufferForCurrentThread().getRecordedEventsCount());
+}
+
+TEST(TraceRecorderTest, givenTwoRecordersWhenRecordingOnSameThreadThenEventsAreNotMixed) {
+    TraceRecorder recorder1(16);
+    TraceRecorder recorder2(16);
+    recorder1.record(TraceCategory::Api, "first", 0, 1, 0);
+    recorder2.record(TraceCategory::Api, "second", 0, 1, 0);
+    recorder1.record(TraceCategory::Api, "third", 0, 1, 0);
+
+    EXPECT_EQ(2u, recorder1.getRingBufferForCurrentThread().getRecordedEventsCount());
+    EXPECT_EQ(1u, recorder2.getRingBufferForCurrentThread().getRecordedEventsCount());
+}
+
+TEST(TraceRecorderTest, givenRecordedEventsWhenDumpingThenChromeTraceJsonIsWritten) {
+    TraceRecorder recorder(16);
+    recorder.record(TraceCategory::Api, "clEnqueueNDRangeKernel", 1500, 4250, 0);
+    recorder.record(TraceCategory::System, "ioctl", 2000, 2007, 0x40);
+
+    std::stringstream output;
+    recorder.dump(output);
+
+    std::string expected = "{\"traceEvents\":[\n"
+                           "{\"name\":\"clEnqueueNDRangeKernel\",\"cat\":\"api\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":1.500,\"dur\":2.750,\"args\":{\"value\":0}},\n"
+                           "{\"name\":\"ioctl\",\"cat\":\"system\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":2.000,\"dur\":0.007,\"args\":{\"value\":64}}\n"
+                           "],\"displayTimeUnit\":\"ns\"}\n";
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(TraceRecorderTest, givenNoEventsWhenDumpingThenEmptyTraceIsWritten) {
+    TraceRecorder recorder(16);
+    std::stringstream output;
+    recorder.dump(output);
+    EXPECT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n", output.str());
+}
+
+TEST(TraceRecorderTest, givenGpuTrackEventsWhenDumpingThenAsyncEventsOfGpuProcessAreWritten) {
+    TraceRecorder recorder(16);
+    recorder.record(TraceCategory::GpuExecution, "CL_COMMAND_NDRANGE_KERNEL", 1000, 3000, 5, 1);
+
+    std::stringstream output;
+    recorder.dump(output);
+
+    std::string expected = "{\"traceEvents\":[\n"
+                           "{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpuExecution\",\"ph\":\"b\",\"id\":1,\"pid\":1,\"tid\":1,\"ts\":1.000,\"args\":{\"value\":5}},\n"
+                           "{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpuExecution\",\"ph\":\"e\",\"id\":1,\"pid\":1,\"tid\":1,\"ts\":3.000,\"args\":{\"value\":5}},\n"
+                           "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"GPU\"}}\n"
+                           "],\"displayTimeUnit\":\"ns\"}\n";
+    EXPECT_EQ(expected, output.str());
+}